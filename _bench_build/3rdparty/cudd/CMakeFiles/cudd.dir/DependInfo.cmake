@@ -0,0 +1,108 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/cudd/cudd/cuddAPI.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAPI.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAPI.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddAbs.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddAbs.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddAbs.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddApply.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddApply.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddApply.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddFind.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddFind.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddFind.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddInv.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddInv.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddInv.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddIte.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddIte.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddIte.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddNeg.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddNeg.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddNeg.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAddWalsh.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddWalsh.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAddWalsh.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAndAbs.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAndAbs.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAndAbs.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddAnneal.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAnneal.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddAnneal.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddApa.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddApa.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddApa.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddApprox.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddApprox.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddApprox.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddBddAbs.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddAbs.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddAbs.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddBddCorr.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddCorr.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddCorr.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddBddIte.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddIte.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBddIte.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddBridge.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBridge.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddBridge.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddCache.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCache.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCache.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddCheck.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCheck.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCheck.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddClip.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddClip.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddClip.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddCof.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCof.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCof.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddCompose.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCompose.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddCompose.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddDecomp.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddDecomp.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddDecomp.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddEssent.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddEssent.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddEssent.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddExact.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddExact.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddExact.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddExport.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddExport.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddExport.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddGenCof.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGenCof.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGenCof.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddGenetic.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGenetic.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGenetic.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddGroup.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGroup.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddGroup.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddHarwell.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddHarwell.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddHarwell.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddInit.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddInit.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddInit.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddInteract.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddInteract.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddInteract.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddLCache.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLCache.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLCache.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddLevelQ.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLevelQ.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLevelQ.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddLinear.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLinear.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLinear.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddLiteral.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLiteral.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddLiteral.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddMatMult.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddMatMult.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddMatMult.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddPriority.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddPriority.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddPriority.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddRead.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddRead.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddRead.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddRef.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddRef.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddRef.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddReorder.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddReorder.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddReorder.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSat.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSat.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSat.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSign.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSign.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSign.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSolve.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSolve.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSolve.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSplit.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSplit.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSplit.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSubsetHB.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSubsetHB.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSubsetHB.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSubsetSP.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSubsetSP.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSubsetSP.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddSymmetry.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSymmetry.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddSymmetry.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddTable.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddTable.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddTable.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddUtil.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddUtil.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddUtil.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddWindow.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddWindow.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddWindow.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddCount.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddCount.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddCount.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddFuncs.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddFuncs.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddFuncs.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddGroup.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddGroup.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddGroup.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddIsop.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddIsop.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddIsop.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddLin.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddLin.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddLin.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddMisc.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddMisc.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddMisc.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddPort.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddPort.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddPort.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddReord.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddReord.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddReord.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddSetop.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddSetop.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddSetop.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddSymm.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddSymm.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddSymm.c.o.d"
+  "/root/repo/3rdparty/cudd/cudd/cuddZddUtil.c" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddUtil.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cudd/cuddZddUtil.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpBinary.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpBinary.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpBinary.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpConvert.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpConvert.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpConvert.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpDbg.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpDbg.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpDbg.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpLoad.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpLoad.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpLoad.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpLoadCnf.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpLoadCnf.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpLoadCnf.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpNodeAdd.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeAdd.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeAdd.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpNodeBdd.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeBdd.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeBdd.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpNodeCnf.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeCnf.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpNodeCnf.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpStoreAdd.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreAdd.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreAdd.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpStoreBdd.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreBdd.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreBdd.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpStoreCnf.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreCnf.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreCnf.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpStoreMisc.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreMisc.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpStoreMisc.c.o.d"
+  "/root/repo/3rdparty/cudd/dddmp/dddmpUtil.c" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpUtil.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/dddmp/dddmpUtil.c.o.d"
+  "/root/repo/3rdparty/cudd/epd/epd.c" "3rdparty/cudd/CMakeFiles/cudd.dir/epd/epd.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/epd/epd.c.o.d"
+  "/root/repo/3rdparty/cudd/mtr/mtrBasic.c" "3rdparty/cudd/CMakeFiles/cudd.dir/mtr/mtrBasic.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/mtr/mtrBasic.c.o.d"
+  "/root/repo/3rdparty/cudd/mtr/mtrGroup.c" "3rdparty/cudd/CMakeFiles/cudd.dir/mtr/mtrGroup.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/mtr/mtrGroup.c.o.d"
+  "/root/repo/3rdparty/cudd/st/st.c" "3rdparty/cudd/CMakeFiles/cudd.dir/st/st.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/st/st.c.o.d"
+  "/root/repo/3rdparty/cudd/util/cpu_stats.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cpu_stats.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cpu_stats.c.o.d"
+  "/root/repo/3rdparty/cudd/util/cpu_time.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cpu_time.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cpu_time.c.o.d"
+  "/root/repo/3rdparty/cudd/util/cstringstream.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cstringstream.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/cstringstream.c.o.d"
+  "/root/repo/3rdparty/cudd/util/datalimit.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/datalimit.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/datalimit.c.o.d"
+  "/root/repo/3rdparty/cudd/util/pathsearch.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/pathsearch.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/pathsearch.c.o.d"
+  "/root/repo/3rdparty/cudd/util/pipefork.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/pipefork.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/pipefork.c.o.d"
+  "/root/repo/3rdparty/cudd/util/prtime.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/prtime.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/prtime.c.o.d"
+  "/root/repo/3rdparty/cudd/util/safe_mem.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/safe_mem.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/safe_mem.c.o.d"
+  "/root/repo/3rdparty/cudd/util/strsav.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/strsav.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/strsav.c.o.d"
+  "/root/repo/3rdparty/cudd/util/texpand.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/texpand.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/texpand.c.o.d"
+  "/root/repo/3rdparty/cudd/util/ucbqsort.c" "3rdparty/cudd/CMakeFiles/cudd.dir/util/ucbqsort.c.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/util/ucbqsort.c.o.d"
+  "/root/repo/3rdparty/cudd/cplusplus/cuddObj.cc" "3rdparty/cudd/CMakeFiles/cudd.dir/cplusplus/cuddObj.cc.o" "gcc" "3rdparty/cudd/CMakeFiles/cudd.dir/cplusplus/cuddObj.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
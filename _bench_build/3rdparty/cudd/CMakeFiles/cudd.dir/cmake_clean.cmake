@@ -0,0 +1,187 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cudd.dir/cplusplus/cuddObj.cc.o"
+  "CMakeFiles/cudd.dir/cplusplus/cuddObj.cc.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAPI.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAPI.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddAbs.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddAbs.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddApply.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddApply.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddFind.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddFind.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddInv.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddInv.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddIte.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddIte.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddNeg.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddNeg.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAddWalsh.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAddWalsh.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAndAbs.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAndAbs.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddAnneal.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddAnneal.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddApa.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddApa.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddApprox.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddApprox.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddBddAbs.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddBddAbs.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddBddCorr.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddBddCorr.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddBddIte.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddBddIte.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddBridge.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddBridge.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddCache.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddCache.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddCheck.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddCheck.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddClip.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddClip.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddCof.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddCof.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddCompose.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddCompose.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddDecomp.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddDecomp.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddEssent.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddEssent.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddExact.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddExact.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddExport.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddExport.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddGenCof.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddGenCof.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddGenetic.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddGenetic.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddGroup.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddGroup.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddHarwell.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddHarwell.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddInit.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddInit.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddInteract.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddInteract.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddLCache.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddLCache.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddLevelQ.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddLevelQ.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddLinear.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddLinear.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddLiteral.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddLiteral.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddMatMult.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddMatMult.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddPriority.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddPriority.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddRead.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddRead.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddRef.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddRef.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddReorder.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddReorder.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSat.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSat.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSign.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSign.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSolve.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSolve.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSplit.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSplit.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSubsetHB.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSubsetHB.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSubsetSP.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSubsetSP.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddSymmetry.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddSymmetry.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddTable.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddTable.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddUtil.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddUtil.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddWindow.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddWindow.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddCount.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddCount.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddFuncs.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddFuncs.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddGroup.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddGroup.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddIsop.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddIsop.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddLin.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddLin.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddMisc.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddMisc.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddPort.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddPort.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddReord.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddReord.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddSetop.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddSetop.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddSymm.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddSymm.c.o.d"
+  "CMakeFiles/cudd.dir/cudd/cuddZddUtil.c.o"
+  "CMakeFiles/cudd.dir/cudd/cuddZddUtil.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpBinary.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpBinary.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpConvert.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpConvert.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpDbg.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpDbg.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpLoad.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpLoad.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpLoadCnf.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpLoadCnf.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeAdd.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeAdd.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeBdd.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeBdd.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeCnf.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpNodeCnf.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreAdd.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreAdd.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreBdd.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreBdd.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreCnf.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreCnf.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreMisc.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpStoreMisc.c.o.d"
+  "CMakeFiles/cudd.dir/dddmp/dddmpUtil.c.o"
+  "CMakeFiles/cudd.dir/dddmp/dddmpUtil.c.o.d"
+  "CMakeFiles/cudd.dir/epd/epd.c.o"
+  "CMakeFiles/cudd.dir/epd/epd.c.o.d"
+  "CMakeFiles/cudd.dir/mtr/mtrBasic.c.o"
+  "CMakeFiles/cudd.dir/mtr/mtrBasic.c.o.d"
+  "CMakeFiles/cudd.dir/mtr/mtrGroup.c.o"
+  "CMakeFiles/cudd.dir/mtr/mtrGroup.c.o.d"
+  "CMakeFiles/cudd.dir/st/st.c.o"
+  "CMakeFiles/cudd.dir/st/st.c.o.d"
+  "CMakeFiles/cudd.dir/util/cpu_stats.c.o"
+  "CMakeFiles/cudd.dir/util/cpu_stats.c.o.d"
+  "CMakeFiles/cudd.dir/util/cpu_time.c.o"
+  "CMakeFiles/cudd.dir/util/cpu_time.c.o.d"
+  "CMakeFiles/cudd.dir/util/cstringstream.c.o"
+  "CMakeFiles/cudd.dir/util/cstringstream.c.o.d"
+  "CMakeFiles/cudd.dir/util/datalimit.c.o"
+  "CMakeFiles/cudd.dir/util/datalimit.c.o.d"
+  "CMakeFiles/cudd.dir/util/pathsearch.c.o"
+  "CMakeFiles/cudd.dir/util/pathsearch.c.o.d"
+  "CMakeFiles/cudd.dir/util/pipefork.c.o"
+  "CMakeFiles/cudd.dir/util/pipefork.c.o.d"
+  "CMakeFiles/cudd.dir/util/prtime.c.o"
+  "CMakeFiles/cudd.dir/util/prtime.c.o.d"
+  "CMakeFiles/cudd.dir/util/safe_mem.c.o"
+  "CMakeFiles/cudd.dir/util/safe_mem.c.o.d"
+  "CMakeFiles/cudd.dir/util/strsav.c.o"
+  "CMakeFiles/cudd.dir/util/strsav.c.o.d"
+  "CMakeFiles/cudd.dir/util/texpand.c.o"
+  "CMakeFiles/cudd.dir/util/texpand.c.o.d"
+  "CMakeFiles/cudd.dir/util/ucbqsort.c.o"
+  "CMakeFiles/cudd.dir/util/ucbqsort.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/cudd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/re2/re2/compile.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/compile.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/compile.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/parse.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/parse.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/parse.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/perl_groups.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/perl_groups.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/perl_groups.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/prog.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/prog.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/prog.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/re2.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/re2.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/re2.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/regexp.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/regexp.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/regexp.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/simplify.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/simplify.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/simplify.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/stringpiece.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/stringpiece.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/stringpiece.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/tostring.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/tostring.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/tostring.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/unicode_casefold.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/unicode_casefold.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/unicode_casefold.cc.o.d"
+  "/root/repo/3rdparty/re2/re2/unicode_groups.cc" "3rdparty/re2/CMakeFiles/re2.dir/re2/unicode_groups.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/re2/unicode_groups.cc.o.d"
+  "/root/repo/3rdparty/re2/util/rune.cc" "3rdparty/re2/CMakeFiles/re2.dir/util/rune.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/util/rune.cc.o.d"
+  "/root/repo/3rdparty/re2/util/strutil.cc" "3rdparty/re2/CMakeFiles/re2.dir/util/strutil.cc.o" "gcc" "3rdparty/re2/CMakeFiles/re2.dir/util/strutil.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
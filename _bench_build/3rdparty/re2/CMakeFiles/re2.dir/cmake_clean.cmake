@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re2.dir/re2/compile.cc.o"
+  "CMakeFiles/re2.dir/re2/compile.cc.o.d"
+  "CMakeFiles/re2.dir/re2/parse.cc.o"
+  "CMakeFiles/re2.dir/re2/parse.cc.o.d"
+  "CMakeFiles/re2.dir/re2/perl_groups.cc.o"
+  "CMakeFiles/re2.dir/re2/perl_groups.cc.o.d"
+  "CMakeFiles/re2.dir/re2/prog.cc.o"
+  "CMakeFiles/re2.dir/re2/prog.cc.o.d"
+  "CMakeFiles/re2.dir/re2/re2.cc.o"
+  "CMakeFiles/re2.dir/re2/re2.cc.o.d"
+  "CMakeFiles/re2.dir/re2/regexp.cc.o"
+  "CMakeFiles/re2.dir/re2/regexp.cc.o.d"
+  "CMakeFiles/re2.dir/re2/simplify.cc.o"
+  "CMakeFiles/re2.dir/re2/simplify.cc.o.d"
+  "CMakeFiles/re2.dir/re2/stringpiece.cc.o"
+  "CMakeFiles/re2.dir/re2/stringpiece.cc.o.d"
+  "CMakeFiles/re2.dir/re2/tostring.cc.o"
+  "CMakeFiles/re2.dir/re2/tostring.cc.o.d"
+  "CMakeFiles/re2.dir/re2/unicode_casefold.cc.o"
+  "CMakeFiles/re2.dir/re2/unicode_casefold.cc.o.d"
+  "CMakeFiles/re2.dir/re2/unicode_groups.cc.o"
+  "CMakeFiles/re2.dir/re2/unicode_groups.cc.o.d"
+  "CMakeFiles/re2.dir/util/rune.cc.o"
+  "CMakeFiles/re2.dir/util/rune.cc.o.d"
+  "CMakeFiles/re2.dir/util/strutil.cc.o"
+  "CMakeFiles/re2.dir/util/strutil.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
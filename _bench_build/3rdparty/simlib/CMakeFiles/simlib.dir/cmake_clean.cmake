@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simlib.dir/src/explicit_lts_sim.cc.o"
+  "CMakeFiles/simlib.dir/src/explicit_lts_sim.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,152 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS libmata cudd_headers simlib_headers)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target libmata
+add_library(libmata STATIC IMPORTED)
+
+set_target_properties(libmata PROPERTIES
+  INTERFACE_COMPILE_FEATURES "cxx_std_20"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:Threads::Threads>;cudd_headers;simlib_headers"
+)
+
+if(NOT CMAKE_VERSION VERSION_LESS "3.23.0")
+  target_sources(libmata
+    INTERFACE
+      FILE_SET "HEADERS"
+      TYPE "HEADERS"
+      BASE_DIRS "${_IMPORT_PREFIX}/include"
+      FILES "${_IMPORT_PREFIX}/include/mata/alphabet.hh" "${_IMPORT_PREFIX}/include/mata/applications/strings.hh" "${_IMPORT_PREFIX}/include/mata/nfa/algorithms.hh" "${_IMPORT_PREFIX}/include/mata/nfa/builder.hh" "${_IMPORT_PREFIX}/include/mata/nfa/complement.hh" "${_IMPORT_PREFIX}/include/mata/nfa/delta.hh" "${_IMPORT_PREFIX}/include/mata/nfa/nfa.hh" "${_IMPORT_PREFIX}/include/mata/nfa/plumbing.hh" "${_IMPORT_PREFIX}/include/mata/nfa/range.hh" "${_IMPORT_PREFIX}/include/mata/nfa/result-cache.hh" "${_IMPORT_PREFIX}/include/mata/nfa/types.hh" "${_IMPORT_PREFIX}/include/mata/nft/algorithms.hh" "${_IMPORT_PREFIX}/include/mata/nft/builder.hh" "${_IMPORT_PREFIX}/include/mata/nft/complement.hh" "${_IMPORT_PREFIX}/include/mata/nft/delta.hh" "${_IMPORT_PREFIX}/include/mata/nft/nft.hh" "${_IMPORT_PREFIX}/include/mata/nft/plumbing.hh" "${_IMPORT_PREFIX}/include/mata/nft/types.hh" "${_IMPORT_PREFIX}/include/mata/parser/binary.hh" "${_IMPORT_PREFIX}/include/mata/parser/inter-aut.hh" "${_IMPORT_PREFIX}/include/mata/parser/mintermization.hh" "${_IMPORT_PREFIX}/include/mata/parser/parser.hh" "${_IMPORT_PREFIX}/include/mata/parser/re2parser.hh" "${_IMPORT_PREFIX}/include/mata/parser/regex-derivatives.hh" "${_IMPORT_PREFIX}/include/mata/utils/assert.hh" "${_IMPORT_PREFIX}/include/mata/utils/budget.hh" "${_IMPORT_PREFIX}/include/mata/utils/closed-set.hh" "${_IMPORT_PREFIX}/include/mata/utils/ord-vector.hh" "${_IMPORT_PREFIX}/include/mata/utils/parallel.hh" "${_IMPORT_PREFIX}/include/mata/utils/profiling.hh" "${_IMPORT_PREFIX}/include/mata/utils/sparse-set.hh" "${_IMPORT_PREFIX}/include/mata/utils/synchronized-iterator.hh" "${_IMPORT_PREFIX}/include/mata/utils/two-dimensional-map.hh" "${_IMPORT_PREFIX}/include/mata/utils/utils.hh"
+  )
+endif()
+
+# Create imported target cudd_headers
+add_library(cudd_headers INTERFACE IMPORTED)
+
+set_target_properties(cudd_headers PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+if(NOT CMAKE_VERSION VERSION_LESS "3.23.0")
+  target_sources(cudd_headers
+    INTERFACE
+      FILE_SET "HEADERS"
+      TYPE "HEADERS"
+      BASE_DIRS "${_IMPORT_PREFIX}/include"
+      FILES "${_IMPORT_PREFIX}/include/mata/cudd/cudd.h" "${_IMPORT_PREFIX}/include/mata/cudd/cuddObj.hh"
+  )
+endif()
+
+# Create imported target simlib_headers
+add_library(simlib_headers INTERFACE IMPORTED)
+
+set_target_properties(simlib_headers PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+if(NOT CMAKE_VERSION VERSION_LESS "3.23.0")
+  target_sources(simlib_headers
+    INTERFACE
+      FILE_SET "HEADERS"
+      TYPE "HEADERS"
+      BASE_DIRS "${_IMPORT_PREFIX}/include"
+      FILES "${_IMPORT_PREFIX}/include/mata/simlib/explicit_lts.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/abstract_transl.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/binary_relation.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/caching_allocator.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/convert.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/shared_counter.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/shared_list.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/simlib.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/smart_set.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/splitting_relation.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/transl_weak.hh" "${_IMPORT_PREFIX}/include/mata/simlib/util/two_way_dict.hh"
+  )
+endif()
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/mataTargets-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/data-structures.cc" "benchmarks/CMakeFiles/mata-bench.dir/data-structures.cc.o" "gcc" "benchmarks/CMakeFiles/mata-bench.dir/data-structures.cc.o.d"
+  "/root/repo/benchmarks/delta.cc" "benchmarks/CMakeFiles/mata-bench.dir/delta.cc.o" "gcc" "benchmarks/CMakeFiles/mata-bench.dir/delta.cc.o.d"
+  "/root/repo/benchmarks/operations.cc" "benchmarks/CMakeFiles/mata-bench.dir/operations.cc.o" "gcc" "benchmarks/CMakeFiles/mata-bench.dir/operations.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/CMakeFiles/libmata.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
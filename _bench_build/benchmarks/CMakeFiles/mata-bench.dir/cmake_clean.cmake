@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mata-bench.dir/data-structures.cc.o"
+  "CMakeFiles/mata-bench.dir/data-structures.cc.o.d"
+  "CMakeFiles/mata-bench.dir/delta.cc.o"
+  "CMakeFiles/mata-bench.dir/delta.cc.o.d"
+  "CMakeFiles/mata-bench.dir/operations.cc.o"
+  "CMakeFiles/mata-bench.dir/operations.cc.o.d"
+  "mata-bench"
+  "mata-bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mata-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,164 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_bench_build/src/cmake_install.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_bench_build/benchmarks/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_bench_build/src/libmata.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata" TYPE FILE FILES "/root/repo/include/mata/alphabet.hh")
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/applications" TYPE FILE FILES "/root/repo/include/mata/applications/strings.hh")
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/nfa" TYPE FILE FILES
+    "/root/repo/include/mata/nfa/algorithms.hh"
+    "/root/repo/include/mata/nfa/builder.hh"
+    "/root/repo/include/mata/nfa/complement.hh"
+    "/root/repo/include/mata/nfa/delta.hh"
+    "/root/repo/include/mata/nfa/nfa.hh"
+    "/root/repo/include/mata/nfa/plumbing.hh"
+    "/root/repo/include/mata/nfa/range.hh"
+    "/root/repo/include/mata/nfa/result-cache.hh"
+    "/root/repo/include/mata/nfa/types.hh"
+    )
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/nft" TYPE FILE FILES
+    "/root/repo/include/mata/nft/algorithms.hh"
+    "/root/repo/include/mata/nft/builder.hh"
+    "/root/repo/include/mata/nft/complement.hh"
+    "/root/repo/include/mata/nft/delta.hh"
+    "/root/repo/include/mata/nft/nft.hh"
+    "/root/repo/include/mata/nft/plumbing.hh"
+    "/root/repo/include/mata/nft/types.hh"
+    )
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/parser" TYPE FILE FILES
+    "/root/repo/include/mata/parser/binary.hh"
+    "/root/repo/include/mata/parser/inter-aut.hh"
+    "/root/repo/include/mata/parser/mintermization.hh"
+    "/root/repo/include/mata/parser/parser.hh"
+    "/root/repo/include/mata/parser/re2parser.hh"
+    "/root/repo/include/mata/parser/regex-derivatives.hh"
+    )
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/utils" TYPE FILE FILES
+    "/root/repo/include/mata/utils/assert.hh"
+    "/root/repo/include/mata/utils/budget.hh"
+    "/root/repo/include/mata/utils/closed-set.hh"
+    "/root/repo/include/mata/utils/ord-vector.hh"
+    "/root/repo/include/mata/utils/parallel.hh"
+    "/root/repo/include/mata/utils/profiling.hh"
+    "/root/repo/include/mata/utils/sparse-set.hh"
+    "/root/repo/include/mata/utils/synchronized-iterator.hh"
+    "/root/repo/include/mata/utils/two-dimensional-map.hh"
+    "/root/repo/include/mata/utils/utils.hh"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/cudd" TYPE FILE FILES
+    "/root/repo/3rdparty/cudd/include/mata/cudd/cudd.h"
+    "/root/repo/3rdparty/cudd/include/mata/cudd/cuddObj.hh"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/simlib" TYPE FILE FILES "/root/repo/3rdparty/simlib/include/mata/simlib/explicit_lts.hh")
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mata/simlib/util" TYPE FILE FILES
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/abstract_transl.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/binary_relation.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/caching_allocator.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/convert.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/shared_counter.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/shared_list.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/simlib.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/smart_set.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/splitting_relation.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/transl_weak.hh"
+    "/root/repo/3rdparty/simlib/include/mata/simlib/util/two_way_dict.hh"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/mata/mataTargets.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/mata/mataTargets.cmake"
+         "/root/repo/_bench_build/CMakeFiles/Export/d51ebc8b4423358da0dc8a8a8cf38d40/mataTargets.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/mata/mataTargets-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/mata/mataTargets.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/mata" TYPE FILE FILES "/root/repo/_bench_build/CMakeFiles/Export/d51ebc8b4423358da0dc8a8a8cf38d40/mataTargets.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/mata" TYPE FILE FILES "/root/repo/_bench_build/CMakeFiles/Export/d51ebc8b4423358da0dc8a8a8cf38d40/mataTargets-release.cmake")
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/mata" TYPE FILE FILES "/root/repo/_bench_build/mataConfig.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_bench_build/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
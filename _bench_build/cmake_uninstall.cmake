@@ -0,0 +1,21 @@
+if(NOT EXISTS "/root/repo/_bench_build/install_manifest.txt")
+  message(FATAL_ERROR "Cannot find install manifest: /root/repo/_bench_build/install_manifest.txt.\n Did you install the library?")
+endif()
+
+file(READ "/root/repo/_bench_build/install_manifest.txt" files)
+string(REGEX REPLACE "\n" ";" files "${files}")
+foreach(file ${files})
+  message(STATUS "Uninstalling $ENV{DESTDIR}${file}")
+  if(IS_SYMLINK "$ENV{DESTDIR}${file}" OR EXISTS "$ENV{DESTDIR}${file}")
+    execute_process(
+      COMMAND "/usr/bin/cmake" -E remove "$ENV{DESTDIR}${file}"
+      RESULT_VARIABLE rm_retval
+      OUTPUT_VARIABLE rm_out
+      )
+    if(NOT "${rm_retval}" STREQUAL 0)
+      message(FATAL_ERROR "Problem when removing $ENV{DESTDIR}${file}")
+    endif()
+  else(IS_SYMLINK "$ENV{DESTDIR}${file}" OR EXISTS "$ENV{DESTDIR}${file}")
+    message(STATUS "File $ENV{DESTDIR}${file} does not exist.")
+  endif()
+endforeach()
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/alphabet.cc" "src/CMakeFiles/libmata.dir/alphabet.cc.o" "gcc" "src/CMakeFiles/libmata.dir/alphabet.cc.o.d"
+  "/root/repo/src/applications/strings/noodlification.cc" "src/CMakeFiles/libmata.dir/applications/strings/noodlification.cc.o" "gcc" "src/CMakeFiles/libmata.dir/applications/strings/noodlification.cc.o.d"
+  "/root/repo/src/applications/strings/replace.cc" "src/CMakeFiles/libmata.dir/applications/strings/replace.cc.o" "gcc" "src/CMakeFiles/libmata.dir/applications/strings/replace.cc.o.d"
+  "/root/repo/src/applications/strings/segmentation.cc" "src/CMakeFiles/libmata.dir/applications/strings/segmentation.cc.o" "gcc" "src/CMakeFiles/libmata.dir/applications/strings/segmentation.cc.o.d"
+  "/root/repo/src/applications/strings/strings.cc" "src/CMakeFiles/libmata.dir/applications/strings/strings.cc.o" "gcc" "src/CMakeFiles/libmata.dir/applications/strings/strings.cc.o.d"
+  "/root/repo/src/binary.cc" "src/CMakeFiles/libmata.dir/binary.cc.o" "gcc" "src/CMakeFiles/libmata.dir/binary.cc.o.d"
+  "/root/repo/src/budget.cc" "src/CMakeFiles/libmata.dir/budget.cc.o" "gcc" "src/CMakeFiles/libmata.dir/budget.cc.o.d"
+  "/root/repo/_bench_build/src/config.cc" "src/CMakeFiles/libmata.dir/config.cc.o" "gcc" "src/CMakeFiles/libmata.dir/config.cc.o.d"
+  "/root/repo/src/inter-aut.cc" "src/CMakeFiles/libmata.dir/inter-aut.cc.o" "gcc" "src/CMakeFiles/libmata.dir/inter-aut.cc.o.d"
+  "/root/repo/src/mintermization.cc" "src/CMakeFiles/libmata.dir/mintermization.cc.o" "gcc" "src/CMakeFiles/libmata.dir/mintermization.cc.o.d"
+  "/root/repo/src/nfa/builder.cc" "src/CMakeFiles/libmata.dir/nfa/builder.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/builder.cc.o.d"
+  "/root/repo/src/nfa/complement.cc" "src/CMakeFiles/libmata.dir/nfa/complement.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/complement.cc.o.d"
+  "/root/repo/src/nfa/concatenation.cc" "src/CMakeFiles/libmata.dir/nfa/concatenation.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/concatenation.cc.o.d"
+  "/root/repo/src/nfa/delta.cc" "src/CMakeFiles/libmata.dir/nfa/delta.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/delta.cc.o.d"
+  "/root/repo/src/nfa/epsilon.cc" "src/CMakeFiles/libmata.dir/nfa/epsilon.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/epsilon.cc.o.d"
+  "/root/repo/src/nfa/inclusion.cc" "src/CMakeFiles/libmata.dir/nfa/inclusion.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/inclusion.cc.o.d"
+  "/root/repo/src/nfa/nfa.cc" "src/CMakeFiles/libmata.dir/nfa/nfa.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/nfa.cc.o.d"
+  "/root/repo/src/nfa/operations.cc" "src/CMakeFiles/libmata.dir/nfa/operations.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/operations.cc.o.d"
+  "/root/repo/src/nfa/product.cc" "src/CMakeFiles/libmata.dir/nfa/product.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/product.cc.o.d"
+  "/root/repo/src/nfa/range.cc" "src/CMakeFiles/libmata.dir/nfa/range.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/range.cc.o.d"
+  "/root/repo/src/nfa/reachability.cc" "src/CMakeFiles/libmata.dir/nfa/reachability.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/reachability.cc.o.d"
+  "/root/repo/src/nfa/result-cache.cc" "src/CMakeFiles/libmata.dir/nfa/result-cache.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/result-cache.cc.o.d"
+  "/root/repo/src/nfa/universal.cc" "src/CMakeFiles/libmata.dir/nfa/universal.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nfa/universal.cc.o.d"
+  "/root/repo/src/nft/builder.cc" "src/CMakeFiles/libmata.dir/nft/builder.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/builder.cc.o.d"
+  "/root/repo/src/nft/complement.cc" "src/CMakeFiles/libmata.dir/nft/complement.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/complement.cc.o.d"
+  "/root/repo/src/nft/composition.cc" "src/CMakeFiles/libmata.dir/nft/composition.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/composition.cc.o.d"
+  "/root/repo/src/nft/concatenation.cc" "src/CMakeFiles/libmata.dir/nft/concatenation.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/concatenation.cc.o.d"
+  "/root/repo/src/nft/inclusion.cc" "src/CMakeFiles/libmata.dir/nft/inclusion.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/inclusion.cc.o.d"
+  "/root/repo/src/nft/intersection.cc" "src/CMakeFiles/libmata.dir/nft/intersection.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/intersection.cc.o.d"
+  "/root/repo/src/nft/nft.cc" "src/CMakeFiles/libmata.dir/nft/nft.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/nft.cc.o.d"
+  "/root/repo/src/nft/operations.cc" "src/CMakeFiles/libmata.dir/nft/operations.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/operations.cc.o.d"
+  "/root/repo/src/nft/universal.cc" "src/CMakeFiles/libmata.dir/nft/universal.cc.o" "gcc" "src/CMakeFiles/libmata.dir/nft/universal.cc.o.d"
+  "/root/repo/src/parser.cc" "src/CMakeFiles/libmata.dir/parser.cc.o" "gcc" "src/CMakeFiles/libmata.dir/parser.cc.o.d"
+  "/root/repo/src/profiling.cc" "src/CMakeFiles/libmata.dir/profiling.cc.o" "gcc" "src/CMakeFiles/libmata.dir/profiling.cc.o.d"
+  "/root/repo/src/re2parser.cc" "src/CMakeFiles/libmata.dir/re2parser.cc.o" "gcc" "src/CMakeFiles/libmata.dir/re2parser.cc.o.d"
+  "/root/repo/src/regex-derivatives.cc" "src/CMakeFiles/libmata.dir/regex-derivatives.cc.o" "gcc" "src/CMakeFiles/libmata.dir/regex-derivatives.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmata.dir/alphabet.cc.o"
+  "CMakeFiles/libmata.dir/alphabet.cc.o.d"
+  "CMakeFiles/libmata.dir/applications/strings/noodlification.cc.o"
+  "CMakeFiles/libmata.dir/applications/strings/noodlification.cc.o.d"
+  "CMakeFiles/libmata.dir/applications/strings/replace.cc.o"
+  "CMakeFiles/libmata.dir/applications/strings/replace.cc.o.d"
+  "CMakeFiles/libmata.dir/applications/strings/segmentation.cc.o"
+  "CMakeFiles/libmata.dir/applications/strings/segmentation.cc.o.d"
+  "CMakeFiles/libmata.dir/applications/strings/strings.cc.o"
+  "CMakeFiles/libmata.dir/applications/strings/strings.cc.o.d"
+  "CMakeFiles/libmata.dir/binary.cc.o"
+  "CMakeFiles/libmata.dir/binary.cc.o.d"
+  "CMakeFiles/libmata.dir/budget.cc.o"
+  "CMakeFiles/libmata.dir/budget.cc.o.d"
+  "CMakeFiles/libmata.dir/config.cc.o"
+  "CMakeFiles/libmata.dir/config.cc.o.d"
+  "CMakeFiles/libmata.dir/inter-aut.cc.o"
+  "CMakeFiles/libmata.dir/inter-aut.cc.o.d"
+  "CMakeFiles/libmata.dir/mintermization.cc.o"
+  "CMakeFiles/libmata.dir/mintermization.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/builder.cc.o"
+  "CMakeFiles/libmata.dir/nfa/builder.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/complement.cc.o"
+  "CMakeFiles/libmata.dir/nfa/complement.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/concatenation.cc.o"
+  "CMakeFiles/libmata.dir/nfa/concatenation.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/delta.cc.o"
+  "CMakeFiles/libmata.dir/nfa/delta.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/epsilon.cc.o"
+  "CMakeFiles/libmata.dir/nfa/epsilon.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/inclusion.cc.o"
+  "CMakeFiles/libmata.dir/nfa/inclusion.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/nfa.cc.o"
+  "CMakeFiles/libmata.dir/nfa/nfa.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/operations.cc.o"
+  "CMakeFiles/libmata.dir/nfa/operations.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/product.cc.o"
+  "CMakeFiles/libmata.dir/nfa/product.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/range.cc.o"
+  "CMakeFiles/libmata.dir/nfa/range.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/reachability.cc.o"
+  "CMakeFiles/libmata.dir/nfa/reachability.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/result-cache.cc.o"
+  "CMakeFiles/libmata.dir/nfa/result-cache.cc.o.d"
+  "CMakeFiles/libmata.dir/nfa/universal.cc.o"
+  "CMakeFiles/libmata.dir/nfa/universal.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/builder.cc.o"
+  "CMakeFiles/libmata.dir/nft/builder.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/complement.cc.o"
+  "CMakeFiles/libmata.dir/nft/complement.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/composition.cc.o"
+  "CMakeFiles/libmata.dir/nft/composition.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/concatenation.cc.o"
+  "CMakeFiles/libmata.dir/nft/concatenation.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/inclusion.cc.o"
+  "CMakeFiles/libmata.dir/nft/inclusion.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/intersection.cc.o"
+  "CMakeFiles/libmata.dir/nft/intersection.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/nft.cc.o"
+  "CMakeFiles/libmata.dir/nft/nft.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/operations.cc.o"
+  "CMakeFiles/libmata.dir/nft/operations.cc.o.d"
+  "CMakeFiles/libmata.dir/nft/universal.cc.o"
+  "CMakeFiles/libmata.dir/nft/universal.cc.o.d"
+  "CMakeFiles/libmata.dir/parser.cc.o"
+  "CMakeFiles/libmata.dir/parser.cc.o.d"
+  "CMakeFiles/libmata.dir/profiling.cc.o"
+  "CMakeFiles/libmata.dir/profiling.cc.o.d"
+  "CMakeFiles/libmata.dir/re2parser.cc.o"
+  "CMakeFiles/libmata.dir/re2parser.cc.o.d"
+  "CMakeFiles/libmata.dir/regex-derivatives.cc.o"
+  "CMakeFiles/libmata.dir/regex-derivatives.cc.o.d"
+  "libmata.a"
+  "libmata.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libmata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+ /* config.cc -- definition of global symbols used in library
+ */
+
+#include "mata/utils/utils.hh"
+
+unsigned mata::LOG_VERBOSITY = 0;
+
+#define GIT_SHA1 "fbfd292335d202d35613fb661f573d22b57bb015"
+const std::string mata::g_GIT_SHA1 = GIT_SHA1;
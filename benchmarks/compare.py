@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Compares two JSON outputs of mata-bench and reports the benchmarks that got slower.
+
+Create the outputs by running `mata-bench --benchmark_out=<file>.json --benchmark_out_format=json` on the baseline and
+on the target version. The script exits with 1 if a benchmark of the target is slower than the baseline by more than
+the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(path, metric):
+    """Loads from @path the times of the benchmarks in nanoseconds
+
+    :param path: path to JSON output of mata-bench
+    :param metric: either 'real_time' or 'cpu_time'
+    :return: dictionary mapping names of the benchmarks to their times; benchmarks with errors are left out
+    """
+    with open(path) as output:
+        benchmarks = json.load(output)["benchmarks"]
+    units = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+    times = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred") or benchmark.get("run_type", "iteration") != "iteration":
+            continue
+        times[benchmark["name"]] = benchmark[metric] * units[benchmark.get("time_unit", "ns")]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON output of mata-bench for the baseline")
+    parser.add_argument("target", help="JSON output of mata-bench for the target")
+    parser.add_argument(
+        "--threshold", type=float, default=0.1,
+        help="relative slowdown reported as a regression (default: 0.1, that is, 10 %%)"
+    )
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time")
+    parser.add_argument("--all", action="store_true", help="print all benchmarks, not only the changed ones")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    target = load_times(args.target, args.metric)
+
+    regressions = 0
+    rows = []
+    for name in sorted(baseline.keys() & target.keys()):
+        change = target[name] / baseline[name] - 1 if baseline[name] > 0 else 0.0
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            status = "improvement"
+        elif args.all:
+            status = ""
+        else:
+            continue
+        rows.append((name, baseline[name], target[name], change, status))
+
+    name_width = max([len("benchmark")] + [len(row[0]) for row in rows])
+    print(f"{'benchmark':<{name_width}} {'baseline [ns]':>16} {'target [ns]':>16} {'change':>9}")
+    for name, baseline_time, target_time, change, status in rows:
+        print(f"{name:<{name_width}} {baseline_time:>16.0f} {target_time:>16.0f} {change:>+9.1%} {status}")
+    for name in sorted(baseline.keys() - target.keys()):
+        print(f"{name}: missing in the target")
+    for name in sorted(target.keys() - baseline.keys()):
+        print(f"{name}: missing in the baseline")
+
+    print(f"{regressions} regression(s) above {args.threshold:.0%}")
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,139 @@
+/* data-structures.cc -- Microbenchmarks of the core data structures
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "mata/nfa/delta.hh"
+#include "mata/utils/ord-vector.hh"
+#include "mata/utils/sparse-set.hh"
+#include "mata/utils/two-dimensional-map.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+using mata::utils::OrdVector;
+using mata::utils::SparseSet;
+using mata::utils::TwoDimensionalMap;
+
+namespace {
+
+/// Get a sorted set of @p size states chosen from [0, @p size * @p spread) by the PRNG seeded with @p seed.
+OrdVector<State> create_random_set(const size_t size, const size_t spread, const unsigned seed) {
+	std::mt19937 generator{seed};
+	std::uniform_int_distribution<State> distribution{0, size * spread - 1};
+	std::vector<State> states(size);
+	for (State& state : states) { state = distribution(generator); }
+	return OrdVector<State>{states};
+}
+
+void ord_vector_insert(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> states{create_random_set(size, 4, 1)};
+	std::vector<State> shuffled{states.begin(), states.end()};
+	std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{2});
+	for (auto _ : state) {
+		OrdVector<State> set{};
+		for (const State s : shuffled) { set.insert(s); }
+		benchmark::DoNotOptimize(set);
+	}
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(ord_vector_insert)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+void ord_vector_union(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> lhs{create_random_set(size, 4, 1)};
+	const OrdVector<State> rhs{create_random_set(size, 4, 2)};
+	for (auto _ : state) { benchmark::DoNotOptimize(OrdVector<State>::set_union(lhs, rhs)); }
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(ord_vector_union)->RangeMultiplier(8)->Range(8, 1 << 18)->Complexity();
+
+void ord_vector_intersection(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> lhs{create_random_set(size, 4, 1)};
+	const OrdVector<State> rhs{create_random_set(size, 4, 2)};
+	for (auto _ : state) { benchmark::DoNotOptimize(lhs.intersection(rhs)); }
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(ord_vector_intersection)->RangeMultiplier(8)->Range(8, 1 << 18)->Complexity();
+
+void ord_vector_difference(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> lhs{create_random_set(size, 4, 1)};
+	const OrdVector<State> rhs{create_random_set(size, 4, 2)};
+	for (auto _ : state) { benchmark::DoNotOptimize(lhs.difference(rhs)); }
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(ord_vector_difference)->RangeMultiplier(8)->Range(8, 1 << 18)->Complexity();
+
+void sparse_set_insert_erase(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> states{create_random_set(size, 4, 1)};
+	SparseSet<State> set{size * 4};
+	for (auto _ : state) {
+		for (const State s : states) { set.insert(s); }
+		for (const State s : states) { set.erase(s); }
+		benchmark::DoNotOptimize(set);
+	}
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(sparse_set_insert_erase)->RangeMultiplier(8)->Range(8, 1 << 18)->Complexity();
+
+void sparse_set_contains(benchmark::State& state) {
+	const auto size{static_cast<size_t>(state.range(0))};
+	const OrdVector<State> states{create_random_set(size, 4, 1)};
+	const SparseSet<State> set{states.begin(), states.end()};
+	const OrdVector<State> queries{create_random_set(size, 4, 2)};
+	for (auto _ : state) {
+		size_t num_of_found{0};
+		for (const State s : queries) { num_of_found += set.contains(s); }
+		benchmark::DoNotOptimize(num_of_found);
+	}
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(sparse_set_contains)->RangeMultiplier(8)->Range(8, 1 << 18)->Complexity();
+
+/// @tparam Map The map type. The maximal matrix size of 0 forces the hash map storage.
+template <class Map> void two_dimensional_map_insert_get(benchmark::State& state) {
+	const auto size{static_cast<State>(state.range(0))};
+	for (auto _ : state) {
+		Map map{size, size};
+		State value{0};
+		for (State first{0}; first < size; ++first) {
+			for (State second{first % 4}; second < size; second += 4) { map.insert(first, second, value++); }
+		}
+		for (State first{0}; first < size; ++first) {
+			for (State second{0}; second < size; ++second) { benchmark::DoNotOptimize(map.get(first, second)); }
+		}
+	}
+}
+BENCHMARK_TEMPLATE(two_dimensional_map_insert_get, TwoDimensionalMap<State>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(two_dimensional_map_insert_get, TwoDimensionalMap<State, true, 0>)
+	->RangeMultiplier(4)
+	->Range(16, 1024);
+
+/// Iterate synchronously over the symbol posts of @c range(0) states with @c range(1) symbols each.
+void synchronized_existential_iterator(benchmark::State& state) {
+	const auto num_of_states{static_cast<State>(state.range(0))};
+	const auto alphabet_size{static_cast<Symbol>(state.range(1))};
+	Delta delta{};
+	std::mt19937 generator{1};
+	std::bernoulli_distribution has_transition{0.5};
+	for (State source{0}; source < num_of_states; ++source) {
+		for (Symbol symbol{0}; symbol < alphabet_size; ++symbol) {
+			if (has_transition(generator)) { delta.add(source, symbol, (source + symbol) % num_of_states); }
+		}
+	}
+	SynchronizedExistentialSymbolPostIterator iterator{};
+	for (auto _ : state) {
+		iterator.reset();
+		for (State source{0}; source < num_of_states; ++source) { push_back(iterator, delta[source]); }
+		while (iterator.advance()) { benchmark::DoNotOptimize(iterator.unify_targets()); }
+	}
+}
+BENCHMARK(synchronized_existential_iterator)->ArgsProduct({{4, 32, 256}, {2, 16, 128}});
+
+} // namespace
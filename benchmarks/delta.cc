@@ -0,0 +1,82 @@
+/* delta.cc -- Microbenchmarks of the transition relation
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "mata/nfa/builder.hh"
+#include "mata/nfa/nfa.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+
+namespace {
+
+/// Create a Tabakov-Vardi NFA with @c range(0) states, @c range(1) symbols, and @c range(2) / 100 transitions per state
+///  and symbol.
+Nfa create_random_nfa(const benchmark::State& state) {
+	return builder::create_random_nfa_tabakov_vardi(
+		static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+		static_cast<double>(state.range(2)) / 100.0, 0.5, 42
+	);
+}
+
+void delta_add(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	std::vector<Transition> transitions{aut.delta.transitions().begin(), aut.delta.transitions().end()};
+	std::shuffle(transitions.begin(), transitions.end(), std::mt19937{1});
+	for (auto _ : state) {
+		Delta delta{};
+		for (const Transition& transition : transitions) { delta.add(transition); }
+		benchmark::DoNotOptimize(delta);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(transitions.size()));
+}
+BENCHMARK(delta_add)->ArgsProduct({{64, 512, 4096}, {2, 16}, {125, 400}});
+
+void delta_add_bulk(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	const size_t num_of_transitions{aut.delta.num_of_transitions()};
+	std::vector<State> sources(num_of_transitions);
+	std::vector<Symbol> symbols(num_of_transitions);
+	std::vector<State> targets(num_of_transitions);
+	aut.delta.copy_transitions_to(sources, symbols, targets);
+	for (auto _ : state) {
+		Delta delta{};
+		delta.add(sources, symbols, targets);
+		benchmark::DoNotOptimize(delta);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_of_transitions));
+}
+BENCHMARK(delta_add_bulk)->ArgsProduct({{64, 512, 4096}, {2, 16}, {125, 400}});
+
+/// Compute the post of the macrostate of all states over each symbol.
+void nfa_post(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	StateSet macrostate{};
+	for (State s{0}; s < aut.num_of_states(); s += 2) { macrostate.push_back(s); }
+	const auto alphabet_size{static_cast<Symbol>(state.range(1))};
+	for (auto _ : state) {
+		for (Symbol symbol{0}; symbol < alphabet_size; ++symbol) {
+			benchmark::DoNotOptimize(aut.post(macrostate, symbol));
+		}
+	}
+}
+BENCHMARK(nfa_post)->ArgsProduct({{64, 512, 4096}, {2, 16}, {125, 400}});
+
+void delta_transitions(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	for (auto _ : state) {
+		size_t num_of_transitions{0};
+		for (const Transition& transition : aut.delta.transitions()) {
+			benchmark::DoNotOptimize(transition);
+			++num_of_transitions;
+		}
+		benchmark::DoNotOptimize(num_of_transitions);
+	}
+}
+BENCHMARK(delta_transitions)->ArgsProduct({{64, 512, 4096}, {2, 16}, {125, 400}});
+
+} // namespace
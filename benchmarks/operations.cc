@@ -0,0 +1,128 @@
+/* operations.cc -- Microbenchmarks of the NFA operations on random Tabakov-Vardi automata
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mata/nfa/builder.hh"
+#include "mata/nfa/nfa.hh"
+#include "mata/utils/budget.hh"
+
+using namespace mata::nfa;
+using mata::utils::Budget;
+using mata::utils::BudgetExhausted;
+using mata::utils::BudgetScope;
+
+namespace {
+
+/// Benchmarks of operations creating more states or running longer are skipped, so that the families stay runnable on
+///  all sizes.
+constexpr size_t MAX_STATES{50'000};
+constexpr std::chrono::seconds MAX_TIME{5};
+
+/// Create a Tabakov-Vardi NFA with @c range(0) states, @c range(1) symbols, and @c range(2) / 100 transitions per state
+///  and symbol.
+Nfa create_random_nfa(const benchmark::State& state, const unsigned seed = 42) {
+	return builder::create_random_nfa_tabakov_vardi(
+		static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+		static_cast<double>(state.range(2)) / 100.0, 0.5, seed
+	);
+}
+
+/// Run @p operation in each iteration of @p state, or skip the benchmark if the operation exceeds the budget.
+template <class Operation> void run(benchmark::State& state, Operation operation) {
+	Budget budget{};
+	budget.set_max_states(MAX_STATES).set_timeout(MAX_TIME);
+	const BudgetScope scope{budget};
+	try {
+		for (auto _ : state) { benchmark::DoNotOptimize(operation()); }
+	} catch (const BudgetExhausted& exception) {
+		state.SkipWithError(exception.what());
+	}
+}
+
+/// Arguments of the operations exponential in the worst case. The random automata are the hardest to determinize at the
+///  transition density of about 1.25.
+void small_random_nfa_args(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgsProduct({{8, 16, 32, 64}, {2, 8}, {125, 200, 300}});
+}
+
+/// Arguments of the polynomial operations.
+void large_random_nfa_args(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgsProduct({{64, 256, 1024}, {2, 8}, {125, 200, 300}});
+}
+
+void determinize(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	run(state, [&] { return mata::nfa::determinize(aut); });
+}
+BENCHMARK(determinize)->Apply(small_random_nfa_args);
+
+void minimize(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	run(state, [&] { return mata::nfa::minimize(aut); });
+}
+BENCHMARK(minimize)->Apply(small_random_nfa_args);
+
+void reduce_simulation(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	run(state, [&] { return mata::nfa::reduce(aut); });
+}
+BENCHMARK(reduce_simulation)->Apply(large_random_nfa_args);
+
+void intersection(benchmark::State& state) {
+	const Nfa lhs{create_random_nfa(state, 1)};
+	const Nfa rhs{create_random_nfa(state, 2)};
+	run(state, [&] { return mata::nfa::intersection(lhs, rhs); });
+}
+// The product of two random automata is nearly complete.
+BENCHMARK(intersection)->ArgsProduct({{32, 64, 128}, {2, 8}, {125, 200, 300}});
+
+/// Intersection on @c range(3) threads.
+void intersection_parallel(benchmark::State& state) {
+	const Nfa lhs{create_random_nfa(state, 1)};
+	const Nfa rhs{create_random_nfa(state, 2)};
+	const auto num_of_threads{static_cast<size_t>(state.range(3))};
+	run(state, [&] { return product_parallel(lhs, rhs, ProductFinalStateCondition::And, num_of_threads); });
+}
+BENCHMARK(intersection_parallel)->ArgsProduct({{64, 128}, {2, 64}, {125}, {1, 2, 4}})->UseRealTime();
+
+void is_included_antichains(benchmark::State& state) {
+	const Nfa smaller{create_random_nfa(state, 1)};
+	const Nfa bigger{create_random_nfa(state, 2)};
+	run(state, [&] { return mata::nfa::is_included(smaller, bigger); });
+}
+BENCHMARK(is_included_antichains)->Apply(small_random_nfa_args);
+
+void is_universal_antichains(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	mata::EnumAlphabet alphabet{};
+	for (mata::Symbol symbol{0}; symbol < static_cast<mata::Symbol>(state.range(1)); ++symbol) {
+		alphabet.add_new_symbol(symbol);
+	}
+	run(state, [&] { return aut.is_universal(alphabet); });
+}
+BENCHMARK(is_universal_antichains)->Apply(small_random_nfa_args);
+
+/// Check the universality of a universal random NFA over @c range(0) symbols on @c range(1) threads.
+void is_universal_antichains_huge_alphabet(benchmark::State& state) {
+	const auto alphabet_size{static_cast<size_t>(state.range(0))};
+	// Making the initial state final and complete on all symbols keeps the random NFA universal.
+	Nfa aut{builder::create_random_nfa_tabakov_vardi(32, alphabet_size, 2.0, 0.5, 42)};
+	aut.final.insert(0);
+	mata::EnumAlphabet alphabet{};
+	for (mata::Symbol symbol{0}; symbol < static_cast<mata::Symbol>(alphabet_size); ++symbol) {
+		alphabet.add_new_symbol(symbol);
+		aut.delta.add(0, symbol, 0);
+	}
+	const ParameterMap params{{"algorithm", "antichains"}, {"threads", std::to_string(state.range(1))}};
+	run(state, [&] { return aut.is_universal(alphabet, params); });
+}
+BENCHMARK(is_universal_antichains_huge_alphabet)->ArgsProduct({{256, 4096}, {1, 2, 4}})->UseRealTime();
+
+void trim(benchmark::State& state) {
+	const Nfa aut{create_random_nfa(state)};
+	run(state, [&] { return Nfa{aut}.trim(); });
+}
+BENCHMARK(trim)->ArgsProduct({{512, 4096}, {2, 16}, {125, 400}});
+
+} // namespace
@@ -26,6 +26,11 @@ cdef extern from "<sstream>" namespace "std":
         stringstream(string) except +
         string str()
 
+cdef extern from "<span>" namespace "std":
+    cdef cppclass span[T]:
+        span()
+        span(T*, size_t)
+
 cdef extern from "mata/nfa/nfa.hh" namespace "mata::nfa":
     # Typedefs
     ctypedef uintptr_t State
@@ -75,6 +80,7 @@ cdef extern from "mata/nfa/nfa.hh" namespace "mata::nfa":
         void defragment()
         void add(CTrans) except +
         void add(State, Symbol, State) except +
+        void add(span[State], span[Symbol], span[State]) except +
         void remove(CTrans) except +
         void remove(State, Symbol, State) except +
         bool contains(State, Symbol, State)
@@ -83,6 +89,7 @@ cdef extern from "mata/nfa/nfa.hh" namespace "mata::nfa":
         size_t num_of_transitions()
         CTransitions transitions()
         vector[CTrans] get_transitions_to(State)
+        void copy_transitions_to(span[State], span[Symbol], span[State]) except +
         COrdVector[Symbol] get_used_symbols()
 
     cdef cppclass CRun "mata::nfa::Run":
@@ -174,9 +181,9 @@ cdef extern from "mata/nfa/nfa.hh" namespace "mata::nfa":
         bool is_complete(CAlphabet*) except +
         bool is_complete() except +
         bool is_universal(CAlphabet&, ParameterMap&) except +
-        bool is_in_lang(CRun&)
-        bool is_in_lang(CRun&, bool)
-        bool is_in_lang(CRun&, bool, bool)
+        bool is_in_lang(CRun&) nogil
+        bool is_in_lang(CRun&, bool) nogil
+        bool is_in_lang(CRun&, bool, bool) nogil
         StateSet read_word(CRun&)
         StateSet read_word(CRun&, bool)
         optional[State] read_word_det(CRun&)
@@ -185,7 +192,11 @@ cdef extern from "mata/nfa/nfa.hh" namespace "mata::nfa":
 
     # Automata tests
     cdef bool c_is_included "mata::nfa::is_included" (CNfa&, CNfa&, CAlphabet*, ParameterMap&)
-    cdef bool c_is_included "mata::nfa::is_included" (CNfa&, CNfa&, CRun*, CAlphabet*, ParameterMap&) except +
+    cdef bool c_is_included "mata::nfa::is_included" (CNfa&, CNfa&, CRun*, CAlphabet*, ParameterMap&) except + nogil
+    cdef CBoolVector c_is_included_many "mata::nfa::is_included_many" (
+        CNfa&, vector[const CNfa*]&, CAlphabet*, ParameterMap&, size_t
+    ) except + nogil
+    cdef CBoolVector c_is_in_lang_batch "mata::nfa::is_in_lang_batch" (CNfa&, vector[vector[Symbol]]&, size_t) except + nogil
     cdef bool c_are_equivalent "mata::nfa::are_equivalent" (CNfa&, CNfa&, CAlphabet*, ParameterMap&)
     cdef bool c_are_equivalent "mata::nfa::are_equivalent" (CNfa&, CNfa&, ParameterMap&)
 
@@ -200,15 +211,15 @@ cdef extern from "mata/nfa/algorithms.hh" namespace "mata::nfa::algorithms":
 
 cdef extern from "mata/nfa/plumbing.hh" namespace "mata::nfa::plumbing":
     cdef void get_elements(StateSet*, CBoolVector)
-    cdef void c_determinize "mata::nfa::plumbing::determinize" (CNfa*, CNfa&, umap[StateSet, State]*)
+    cdef void c_determinize "mata::nfa::plumbing::determinize" (CNfa*, CNfa&, umap[StateSet, State]*) nogil
     cdef void c_union_nondet "mata::nfa::plumbing::union_nondet" (CNfa*, CNfa&, CNfa&)
-    cdef void c_intersection "mata::nfa::plumbing::intersection" (CNfa*, CNfa&, CNfa&, Symbol, umap[pair[State, State], State]*)
+    cdef void c_intersection "mata::nfa::plumbing::intersection" (CNfa*, CNfa&, CNfa&, Symbol, umap[pair[State, State], State]*) nogil
     cdef void c_concatenate "mata::nfa::plumbing::concatenate" (CNfa*, CNfa&, CNfa&, bool, StateRenaming*, StateRenaming*)
     cdef void c_complement "mata::nfa::plumbing::complement" (CNfa*, CNfa&, CAlphabet&, ParameterMap&) except +
     cdef void c_revert "mata::nfa::plumbing::revert" (CNfa*, CNfa&)
     cdef void c_remove_epsilon "mata::nfa::plumbing::remove_epsilon" (CNfa*, CNfa&, Symbol) except +
-    cdef void c_minimize "mata::nfa::plumbing::minimize" (CNfa*, CNfa&, ParameterMap&)
-    cdef void c_reduce "mata::nfa::plumbing::reduce" (CNfa*, CNfa&, StateRenaming*, ParameterMap&)
+    cdef void c_minimize "mata::nfa::plumbing::minimize" (CNfa*, CNfa&, ParameterMap&) except + nogil
+    cdef void c_reduce "mata::nfa::plumbing::reduce" (CNfa*, CNfa&, StateRenaming*, ParameterMap&) except + nogil
     cdef void c_reduce_residual_with "mata::nfa::plumbing::reduce_residual_with" (CNfa*, CNfa&)
     cdef void c_reduce_residual_after "mata::nfa::plumbing::reduce_residual_after" (CNfa*, CNfa&)
 
@@ -4,11 +4,16 @@ from libmata.alphabets import Symbol
 import libmata.alphabets as alph
 from libmata.utils import BinaryRelation
 
+import numpy
+import numpy.typing
 import pandas
 import networkx
 
 State = int
 
+STATE_DTYPE: numpy.dtype
+SYMBOL_DTYPE: numpy.dtype
+
 def epsilon() -> Symbol:
     ...
 
@@ -245,6 +250,40 @@ class Nfa:
         :param alph.Alphabet alphabet: alphabet of the transition
         """
         ...
+    def add_transitions_from_arrays(
+            self, sources: numpy.typing.ArrayLike, symbols: numpy.typing.ArrayLike, targets: numpy.typing.ArrayLike
+    ) -> None:
+        """Adds transitions given as three arrays of the same length at once.
+
+        The i-th transition is (sources[i], symbols[i], targets[i]). The arrays are converted to contiguous NumPy
+        arrays of STATE_DTYPE and SYMBOL_DTYPE, which does not copy arrays already of these types. The transitions
+        are then added without creating a Python object per transition.
+
+        :param sources: source states
+        :param symbols: symbols
+        :param targets: target states
+        """
+        ...
+    @classmethod
+    def from_arrays(
+            cls, sources: numpy.typing.ArrayLike, symbols: numpy.typing.ArrayLike, targets: numpy.typing.ArrayLike,
+            initial_states: numpy.typing.ArrayLike = (), final_states: numpy.typing.ArrayLike = (),
+            state_number: int = 0, alphabet: alph.Alphabet = None, label: Any = None
+    ) -> Self:
+        """Constructs automaton from transitions given as three arrays of the same length.
+
+        See add_transitions_from_arrays() for the format of the arrays.
+
+        :param sources: source states
+        :param symbols: symbols
+        :param targets: target states
+        :param initial_states: initial states
+        :param final_states: final states
+        :param int state_number: minimal number of states in automaton
+        :param alph.Alphabet alphabet: alphabet corresponding to the automaton
+        :return: automaton with the given transitions
+        """
+        ...
     def remove_trans(self, tr: Transition) -> None:
         """Removes transition from the automaton.
 
@@ -309,6 +348,27 @@ class Nfa:
         :return: List of automaton transitions.
         """
         ...
+    def get_transitions_as_arrays(self) -> tuple[numpy.ndarray, numpy.ndarray, numpy.ndarray]:
+        """Get automaton transitions as three NumPy arrays of the same length.
+
+        The i-th transition is (sources[i], symbols[i], targets[i]). The transitions are ordered by source states,
+        symbols and target states, and are copied at once without creating a Python object per transition.
+
+        :return: Tuple (sources, symbols, targets) of arrays of STATE_DTYPE, SYMBOL_DTYPE and STATE_DTYPE.
+        """
+        ...
+    def get_initial_states_as_array(self) -> numpy.ndarray:
+        """Get initial states as a NumPy array of STATE_DTYPE.
+
+        :return: Array of initial states.
+        """
+        ...
+    def get_final_states_as_array(self) -> numpy.ndarray:
+        """Get final states as a NumPy array of STATE_DTYPE.
+
+        :return: Array of final states.
+        """
+        ...
     def get_trans_from_state_as_sequence(self, source: State) -> list[Transition]:
         """Get automaton transitions from state_from as a sequence.
 
@@ -501,6 +561,16 @@ class Nfa:
         :return: true if word is in language of the NFA.
         """
         ...
+    def is_in_lang_batch(self, words: Iterable[list[Symbol]], num_of_threads: int = 0) -> list[bool]:
+        """Tests if words are in language, on multiple threads without holding the GIL.
+
+        The automaton may not be modified from other threads during the call.
+
+        :param words: tested words, each a sequence of symbols.
+        :param int num_of_threads: number of threads; if 0, uses the number of hardware threads.
+        :return: list of results, true at index i if the i-th word is in language.
+        """
+        ...
     def read_word(self, word: list[Symbol], use_epsilon: bool = False) -> set[State]:
         """Read word and return the set of states the automaton ends up in.
 
@@ -758,6 +828,24 @@ def is_included(lhs: Nfa, rhs: Nfa, alphabet: alph.Alphabet = None, params: dict
     """
     ...
 
+def is_included_many(
+        bigger: Nfa, smaller: Iterable[Nfa], alphabet: alph.Alphabet = None, params: dict[str, str] = None,
+        num_of_threads: int = 0
+) -> list[bool]:
+    """Test inclusion of each of the smaller automata in the bigger automaton.
+
+    The inclusion checks run on multiple threads without holding the GIL. The automata may not be modified from
+    other threads during the call.
+
+    :param Nfa bigger: bigger automaton
+    :param list[Nfa] smaller: smaller automata
+    :param alph.Alphabet alphabet: alphabet shared by all automata
+    :param dict params: additional params, see is_included()
+    :param int num_of_threads: number of threads; if 0, uses the number of hardware threads
+    :return: list of results, true at index i if the i-th smaller automaton is included in bigger
+    """
+    ...
+
 def equivalence_check(lhs: Nfa, rhs: Nfa, alphabet: alph.Alphabet = None, params: dict[str, str] = None) -> bool:
     """Test equivalence of two automata.
 
@@ -1,5 +1,6 @@
 import shlex
 import subprocess
+import numpy
 import pandas
 import networkx as nx
 
@@ -29,11 +30,34 @@ from libmata.utils cimport COrdVector, CBinaryRelation, BinaryRelation
 
 cdef Symbol EPSILON = CEPSILON
 
+# NumPy types of arrays of states and symbols used for the bulk transfer of automata.
+STATE_DTYPE = numpy.dtype(f"u{sizeof(State)}")
+SYMBOL_DTYPE = numpy.dtype(f"u{sizeof(Symbol)}")
+
 
 def epsilon():
     return EPSILON
 
 
+cdef ParameterMap to_parameter_map(params):
+    """Converts the dictionary of parameters to the C++ parameter map."""
+    return {k.encode('utf-8'): v.encode('utf-8') if isinstance(v, str) else v for k, v in params.items()}
+
+
+cdef object states_to_array(CSparseSet[State]& states):
+    """Copies states from the sparse set to a NumPy array of STATE_DTYPE."""
+    cdef vector[State] c_states
+    cdef State state
+    for state in states:
+        c_states.push_back(state)
+    array = numpy.empty(c_states.size(), dtype=STATE_DTYPE)
+    cdef State[::1] c_array = array
+    cdef size_t i
+    for i in range(c_states.size()):
+        c_array[i] = c_states[i]
+    return array
+
+
 cdef class Run:
     """Wrapper over the run in NFA."""
     cdef mata_nfa.CRun *thisptr
@@ -363,6 +387,58 @@ cdef class Nfa:
         else:
             self.thisptr.get().delta.add(source, symbol, target)
 
+    def add_transitions_from_arrays(self, sources, symbols, targets):
+        """Adds transitions given as three arrays of the same length at once.
+
+        The i-th transition is (sources[i], symbols[i], targets[i]). The arrays are converted to contiguous NumPy
+        arrays of STATE_DTYPE and SYMBOL_DTYPE, which does not copy arrays already of these types. The transitions
+        are then added without creating a Python object per transition.
+
+        :param sources: source states
+        :param symbols: symbols
+        :param targets: target states
+        """
+        sources = numpy.ascontiguousarray(sources, dtype=STATE_DTYPE)
+        symbols = numpy.ascontiguousarray(symbols, dtype=SYMBOL_DTYPE)
+        targets = numpy.ascontiguousarray(targets, dtype=STATE_DTYPE)
+        if sources.ndim != 1 or sources.shape != symbols.shape or sources.shape != targets.shape:
+            raise ValueError("Arrays of sources, symbols and targets have to be one-dimensional of the same length")
+        cdef const State[::1] c_sources = sources
+        cdef const Symbol[::1] c_symbols = symbols
+        cdef const State[::1] c_targets = targets
+        cdef size_t num_of_transitions = c_sources.shape[0]
+        if num_of_transitions == 0:
+            return
+        self.thisptr.get().delta.add(
+            span[State](<State*>&c_sources[0], num_of_transitions),
+            span[Symbol](<Symbol*>&c_symbols[0], num_of_transitions),
+            span[State](<State*>&c_targets[0], num_of_transitions)
+        )
+
+    @classmethod
+    def from_arrays(
+            cls, sources, symbols, targets, initial_states = (), final_states = (), state_number = 0,
+            alph.Alphabet alphabet = None, label = None
+    ) -> Nfa:
+        """Constructs automaton from transitions given as three arrays of the same length.
+
+        See add_transitions_from_arrays() for the format of the arrays.
+
+        :param sources: source states
+        :param symbols: symbols
+        :param targets: target states
+        :param initial_states: initial states
+        :param final_states: final states
+        :param int state_number: minimal number of states in automaton
+        :param alph.Alphabet alphabet: alphabet corresponding to the automaton
+        :return: automaton with the given transitions
+        """
+        result = cls(state_number, alphabet, label)
+        result.add_transitions_from_arrays(sources, symbols, targets)
+        result.make_initial_states(numpy.asarray(initial_states, dtype=STATE_DTYPE))
+        result.make_final_states(numpy.asarray(final_states, dtype=STATE_DTYPE))
+        return result
+
     def remove_trans(self, Transition tr):
         """Removes transition from the automaton.
 
@@ -465,6 +541,43 @@ cdef class Nfa:
             transitions.append(Transition(c_transition.source, c_transition.symbol, c_transition.target))
         return transitions
 
+    def get_transitions_as_arrays(self):
+        """Get automaton transitions as three NumPy arrays of the same length.
+
+        The i-th transition is (sources[i], symbols[i], targets[i]). The transitions are ordered by source states,
+        symbols and target states, and are copied at once without creating a Python object per transition.
+
+        :return: Tuple (sources, symbols, targets) of arrays of STATE_DTYPE, SYMBOL_DTYPE and STATE_DTYPE.
+        """
+        cdef size_t num_of_transitions = self.thisptr.get().delta.num_of_transitions()
+        sources = numpy.empty(num_of_transitions, dtype=STATE_DTYPE)
+        symbols = numpy.empty(num_of_transitions, dtype=SYMBOL_DTYPE)
+        targets = numpy.empty(num_of_transitions, dtype=STATE_DTYPE)
+        cdef State[::1] c_sources = sources
+        cdef Symbol[::1] c_symbols = symbols
+        cdef State[::1] c_targets = targets
+        if num_of_transitions > 0:
+            self.thisptr.get().delta.copy_transitions_to(
+                span[State](&c_sources[0], num_of_transitions),
+                span[Symbol](&c_symbols[0], num_of_transitions),
+                span[State](&c_targets[0], num_of_transitions)
+            )
+        return sources, symbols, targets
+
+    def get_initial_states_as_array(self):
+        """Get initial states as a NumPy array of STATE_DTYPE.
+
+        :return: Array of initial states.
+        """
+        return states_to_array(self.thisptr.get().initial)
+
+    def get_final_states_as_array(self):
+        """Get final states as a NumPy array of STATE_DTYPE.
+
+        :return: Array of final states.
+        """
+        return states_to_array(self.thisptr.get().final)
+
     def get_trans_from_state_as_sequence(self, State source) -> list[Transition]:
         """Get automaton transitions from state_from as a sequence.
 
@@ -670,11 +783,8 @@ cdef class Nfa:
 
         :return: automaton represented as a pandas dataframe
         """
-        columns = ['source', 'symbol', 'target']
-        data = [
-            [trans.source, trans.symbol, trans.target] for trans in self.iterate()
-        ]
-        return pandas.DataFrame(data, columns=columns)
+        sources, symbols, targets = self.get_transitions_as_arrays()
+        return pandas.DataFrame({'source': sources, 'symbol': symbols, 'target': targets})
 
     def to_networkx_graph(self) -> nx.Graph:
         """Transforms the automaton into networkx.Graph
@@ -766,9 +876,32 @@ cdef class Nfa:
         :param bool match_prefix: whether to match prefix of the word.
         :return: true if word is in language of the NFA.
         """
-        run = Run()
-        run.thisptr.word = word
-        return self.thisptr.get().is_in_lang(dereference(run.thisptr), use_epsilon, match_prefix)
+        cdef CRun c_run
+        c_run.word = word
+        cdef CNfa* c_aut = self.thisptr.get()
+        cdef bool c_use_epsilon = use_epsilon
+        cdef bool c_match_prefix = match_prefix
+        cdef bool result
+        with nogil:
+            result = c_aut.is_in_lang(c_run, c_use_epsilon, c_match_prefix)
+        return result
+
+    def is_in_lang_batch(self, words, num_of_threads = 0) -> list[bool]:
+        """Tests if words are in language, on multiple threads without holding the GIL.
+
+        The automaton may not be modified from other threads during the call.
+
+        :param words: tested words, each a sequence of symbols.
+        :param int num_of_threads: number of threads; if 0, uses the number of hardware threads.
+        :return: list of results, true at index i if the i-th word is in language.
+        """
+        cdef vector[vector[Symbol]] c_words = words
+        cdef CNfa* c_aut = self.thisptr.get()
+        cdef size_t c_num_of_threads = num_of_threads
+        cdef CBoolVector c_result
+        with nogil:
+            c_result = mata_nfa.c_is_in_lang_batch(dereference(c_aut), c_words, c_num_of_threads)
+        return [c_result[i] != 0 for i in range(c_result.size())]
 
     def read_word(self, vector[Symbol] word, use_epsilon = False):
         """Read word and return the set of states the automaton ends up in.
@@ -843,7 +976,10 @@ def determinize_with_subset_map(Nfa lhs):
     """
     result = Nfa()
     cdef umap[StateSet, State] subset_map
-    mata_nfa.c_determinize(result.thisptr.get(), dereference(lhs.thisptr.get()), &subset_map)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    with nogil:
+        mata_nfa.c_determinize(c_result, dereference(c_lhs), &subset_map)
     return result, subset_map_to_dictionary(subset_map)
 
 def determinize(Nfa lhs):
@@ -853,7 +989,10 @@ def determinize(Nfa lhs):
     :return: deterministic finite automaton
     """
     result = Nfa()
-    mata_nfa.c_determinize(result.thisptr.get(), dereference(lhs.thisptr.get()), NULL)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    with nogil:
+        mata_nfa.c_determinize(c_result, dereference(c_lhs), NULL)
     return result
 
 def union(Nfa lhs, Nfa rhs):
@@ -887,9 +1026,11 @@ def intersection(Nfa lhs, Nfa rhs, Symbol first_epsilon = CEPSILON):
     :return: Intersection of lhs and rhs.
     """
     result = Nfa()
-    mata_nfa.c_intersection(
-        result.thisptr.get(), dereference(lhs.thisptr.get()), dereference(rhs.thisptr.get()), first_epsilon, NULL
-    )
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    cdef CNfa* c_rhs = rhs.thisptr.get()
+    with nogil:
+        mata_nfa.c_intersection(c_result, dereference(c_lhs), dereference(c_rhs), first_epsilon, NULL)
     return result
 
 def intersection_with_product_map(Nfa lhs, Nfa rhs, Symbol first_epsilon = CEPSILON):
@@ -911,8 +1052,11 @@ def intersection_with_product_map(Nfa lhs, Nfa rhs, Symbol first_epsilon = CEPSI
     """
     result = Nfa()
     cdef umap[pair[State, State], State] c_product_map
-    mata_nfa.c_intersection(
-        result.thisptr.get(), dereference(lhs.thisptr.get()), dereference(rhs.thisptr.get()), first_epsilon, &c_product_map)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    cdef CNfa* c_rhs = rhs.thisptr.get()
+    with nogil:
+        mata_nfa.c_intersection(c_result, dereference(c_lhs), dereference(c_rhs), first_epsilon, &c_product_map)
     return result, {tuple(k): v for k, v in c_product_map}
 
 def concatenate(Nfa lhs, Nfa rhs, use_epsilon: bool = False) -> Nfa:
@@ -1012,11 +1156,11 @@ def minimize(Nfa lhs, params = None):
     """
     params = params or {"algorithm": "brzozowski"}
     result = Nfa()
-    mata_nfa.c_minimize(result.thisptr.get(), dereference(lhs.thisptr.get()),
-        {
-            k.encode('utf-8'): v.encode('utf-8') for k, v in params.items()
-        }
-    )
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    with nogil:
+        mata_nfa.c_minimize(c_result, dereference(c_lhs), c_params)
     return result
 
 def reduce_with_state_map(Nfa aut, params = None):
@@ -1031,11 +1175,11 @@ def reduce_with_state_map(Nfa aut, params = None):
     params = params or {"algorithm": "simulation"}
     cdef StateRenaming state_map
     result = Nfa()
-    mata_nfa.c_reduce(result.thisptr.get(), dereference(aut.thisptr.get()), &state_map,
-                    {
-                        k.encode('utf-8'): v.encode('utf-8') for k, v in params.items()
-                    }
-                    )
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_aut = aut.thisptr.get()
+    with nogil:
+        mata_nfa.c_reduce(c_result, dereference(c_aut), &state_map, c_params)
 
     return result, {k: v for k, v in state_map}
 
@@ -1057,11 +1201,11 @@ def reduce(Nfa aut, params = None):
     """
     params = params or {"algorithm": "simulation"}
     result = Nfa()
-    mata_nfa.c_reduce(result.thisptr.get(), dereference(aut.thisptr.get()), NULL,
-                    {
-                        k.encode('utf-8'): v.encode('utf-8') for k, v in params.items()
-                    }
-                    )
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef CNfa* c_result = result.thisptr.get()
+    cdef CNfa* c_aut = aut.thisptr.get()
+    with nogil:
+        mata_nfa.c_reduce(c_result, dereference(c_aut), NULL, c_params)
     return result
 
 def reduce_residual_after(Nfa aut):
@@ -1123,16 +1267,13 @@ def is_included_with_cex(Nfa lhs, Nfa rhs, alph.Alphabet alphabet = None, params
     if alphabet:
         c_alphabet = alphabet.as_base()
     params = params or {'algorithm': 'antichains'}
-    result = mata_nfa.c_is_included(
-        dereference(lhs.thisptr.get()),
-        dereference(rhs.thisptr.get()),
-        run.thisptr,
-        c_alphabet,
-        {
-            k.encode('utf-8'): v.encode('utf-8') if isinstance(v, str) else v
-            for k, v in params.items()
-        }
-    )
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    cdef CNfa* c_rhs = rhs.thisptr.get()
+    cdef CRun* c_run = run.thisptr
+    cdef bool result
+    with nogil:
+        result = mata_nfa.c_is_included(dereference(c_lhs), dereference(c_rhs), c_run, c_alphabet, c_params)
     return result, run
 
 def is_included(Nfa lhs, Nfa rhs, alph.Alphabet alphabet = None, params = None):
@@ -1148,18 +1289,45 @@ def is_included(Nfa lhs, Nfa rhs, alph.Alphabet alphabet = None, params = None):
     if alphabet:
         c_alphabet = alphabet.as_base()
     params = params or {'algorithm': 'antichains'}
-    result = mata_nfa.c_is_included(
-        dereference(lhs.thisptr.get()),
-        dereference(rhs.thisptr.get()),
-        NULL,
-        c_alphabet,
-        {
-            k.encode('utf-8'): v.encode('utf-8') if isinstance(v, str) else v
-            for k, v in params.items()
-        }
-    )
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef CNfa* c_lhs = lhs.thisptr.get()
+    cdef CNfa* c_rhs = rhs.thisptr.get()
+    cdef bool result
+    with nogil:
+        result = mata_nfa.c_is_included(dereference(c_lhs), dereference(c_rhs), NULL, c_alphabet, c_params)
     return result
 
+def is_included_many(Nfa bigger, smaller, alph.Alphabet alphabet = None, params = None, num_of_threads = 0):
+    """Test inclusion of each of the smaller automata in the bigger automaton.
+
+    The inclusion checks run on multiple threads without holding the GIL. The automata may not be modified from
+    other threads during the call.
+
+    :param Nfa bigger: bigger automaton
+    :param list[Nfa] smaller: smaller automata
+    :param alph.Alphabet alphabet: alphabet shared by all automata
+    :param dict params: additional params, see is_included()
+    :param int num_of_threads: number of threads; if 0, uses the number of hardware threads
+    :return: list of results, true at index i if the i-th smaller automaton is included in bigger
+    """
+    cdef CAlphabet* c_alphabet = NULL
+    if alphabet:
+        c_alphabet = alphabet.as_base()
+    params = params or {'algorithm': 'antichains'}
+    cdef ParameterMap c_params = to_parameter_map(params)
+    cdef vector[const CNfa*] c_smaller
+    cdef Nfa aut
+    for aut in smaller:
+        c_smaller.push_back(aut.thisptr.get())
+    cdef CNfa* c_bigger = bigger.thisptr.get()
+    cdef size_t c_num_of_threads = num_of_threads
+    cdef CBoolVector c_result
+    with nogil:
+        c_result = mata_nfa.c_is_included_many(
+            dereference(c_bigger), c_smaller, c_alphabet, c_params, c_num_of_threads
+        )
+    return [c_result[i] != 0 for i in range(c_result.size())]
+
 def equivalence_check(Nfa lhs, Nfa rhs, alph.Alphabet alphabet = None, params = None) -> bool:
     """Test equivalence of two automata.
 
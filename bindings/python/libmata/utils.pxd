@@ -71,6 +71,8 @@ cdef extern from "mata/utils/utils.hh" namespace "mata":
         CBoolVector(vector[uint8_t])
 
         size_t count()
+        size_t size()
+        uint8_t& operator[](size_t)
 
 
 cdef extern from "mata/simlib/util/binary_relation.hh" namespace "Simlib::Util":
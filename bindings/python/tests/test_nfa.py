@@ -1,6 +1,8 @@
 """Basic tests for utility package and sanity checks"""
 
+import concurrent.futures
 import os
+import numpy
 import pytest
 
 import libmata.alphabets as alphabets
@@ -160,6 +162,42 @@ def test_making_initial_and_final_states():
     assert len(nfa.final_states) == 0
 
 
+def test_bulk_transfer_of_transitions():
+    """Test building and inspecting the automaton with NumPy arrays."""
+    nfa = mata_nfa.Nfa.from_arrays(
+        numpy.array([2, 0, 1, 0, 0]), [1, 1, 0, 0, 1], numpy.array([2, 2, 0, 1, 2]), initial_states=[0],
+        final_states=numpy.array([2])
+    )
+    assert nfa.num_of_states() == 3
+    assert nfa.get_num_of_transitions() == 4
+    assert nfa.has_transition(0, 0, 1)
+    assert nfa.has_transition(0, 1, 2)
+    assert nfa.has_transition(1, 0, 0)
+    assert nfa.has_transition(2, 1, 2)
+
+    sources, symbols, targets = nfa.get_transitions_as_arrays()
+    assert sources.dtype == mata_nfa.STATE_DTYPE
+    assert symbols.dtype == mata_nfa.SYMBOL_DTYPE
+    assert list(sources) == [0, 0, 1, 2]
+    assert list(symbols) == [0, 1, 0, 1]
+    assert list(targets) == [1, 2, 0, 2]
+    assert [(t.source, t.symbol, t.target) for t in nfa.get_trans_as_sequence()] == list(zip(sources, symbols, targets))
+    assert list(nfa.get_initial_states_as_array()) == [0]
+    assert list(nfa.get_final_states_as_array()) == [2]
+
+    nfa.add_transitions_from_arrays(targets, symbols, sources)
+    assert nfa.get_num_of_transitions() == 7
+    assert nfa.has_transition(1, 0, 0)
+    assert nfa.has_transition(2, 1, 0)
+
+    with pytest.raises(ValueError):
+        nfa.add_transitions_from_arrays([0, 1], [0], [0, 1])
+
+    empty = mata_nfa.Nfa.from_arrays([], [], [])
+    assert all(len(array) == 0 for array in empty.get_transitions_as_arrays())
+    assert len(empty.get_initial_states_as_array()) == 0
+
+
 def test_post(binary_alphabet):
     """Test various cases of getting post of the states
     :return:
@@ -371,6 +409,23 @@ def test_concatenate():
     assert mata_nfa.equivalence_check(result, result_in_place)
 
 
+def test_batched_inclusion(
+        fa_one_divisible_by_two, fa_one_divisible_by_four, fa_one_divisible_by_eight
+):
+    smaller = [fa_one_divisible_by_two, fa_one_divisible_by_four, fa_one_divisible_by_eight]
+    assert mata_nfa.is_included_many(fa_one_divisible_by_four, smaller) == [False, True, True]
+    assert mata_nfa.is_included_many(fa_one_divisible_by_four, smaller, num_of_threads=1) == [False, True, True]
+    assert mata_nfa.is_included_many(fa_one_divisible_by_eight, smaller, params={'algorithm': 'naive'}) == [
+        False, False, True
+    ]
+    assert mata_nfa.is_included_many(fa_one_divisible_by_two, []) == []
+
+    # Inclusion checks release the GIL, hence they can run on threads of the Python program concurrently.
+    with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+        results = list(executor.map(lambda lhs: mata_nfa.is_included(lhs, fa_one_divisible_by_four), smaller * 4))
+    assert results == [False, True, True] * 4
+
+
 def test_completeness(
         fa_one_divisible_by_two, fa_one_divisible_by_four, fa_one_divisible_by_eight
 ):
@@ -401,6 +456,11 @@ def test_in_language(
 ):
     assert fa_one_divisible_by_two.is_in_lang([1, 1])
     assert not fa_one_divisible_by_two.is_in_lang([1, 1, 1])
+    words = [[1, 1], [1, 1, 1], [], [0, 1, 0, 1, 1, 1]]
+    assert fa_one_divisible_by_two.is_in_lang_batch(words) == [fa_one_divisible_by_two.is_in_lang(w) for w in words]
+    assert fa_one_divisible_by_two.is_in_lang_batch(words, num_of_threads=2) == [True, False, True, True]
+    assert fa_one_divisible_by_two.is_in_lang_batch([]) == []
+
 
     assert fa_one_divisible_by_four.is_in_lang([1, 1, 1, 1, 0], match_prefix=True)
     assert not fa_one_divisible_by_four.is_in_lang([1, 1, 1, 0, 0], match_prefix=True)
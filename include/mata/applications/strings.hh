@@ -8,6 +8,9 @@
 #include "mata/nfa/nfa.hh"
 #include "mata/nft/nft.hh"
 
+#include <functional>
+#include <list>
+
 /**
  * Operations on NFAs/NFTs used for string constraint solving.
  */
@@ -120,6 +123,68 @@ std::optional<std::vector<Word>> get_words_of_lengths(const Nft& nft, std::vecto
  */
 std::set<Symbol> get_accepted_symbols(const Nfa& nfa);
 
+/**
+ * @brief Length abstraction of an automaton: the set of lengths of all words accepted by the automaton.
+ *
+ * The lengths of words of an automaton are the lengths of words of its one-letter (unary) abstraction, where all
+ *  symbols on transitions are renamed to a single symbol. The sets of states reachable by words of length 0, 1, 2, ...
+ *  in the unary automaton form a lasso: a prefix of @c get_loop_start() sets followed by a loop of @c get_period()
+ *  sets repeating forever (or just the prefix when the sets become empty). A length is a length of some word iff
+ *  the corresponding set of states contains a final state.
+ *
+ * The lasso is computed directly on bit vectors of states of the unary automaton, without constructing
+ *  the (determinized) one-letter automaton.
+ *
+ * Complexity: the lasso is the subset construction of the unary automaton, which is exponential in the worst case.
+ *  For an automaton with n states, the prefix has at most (n - 1)^2 + 1 sets (Chrobak), but the period is the least
+ *  common multiple of the lengths of some cycles of the automaton, which can be as large as Landau's function g(n),
+ *  i.e., e^((1 + o(1)) sqrt(n ln n)). Computing each set of the lasso takes O(n / 64 + m) time for m transitions of
+ *  the unary automaton, and the lasso stores a bit per set.
+ *
+ * The polynomial Chrobak normal form (a prefix of O(n^2) states followed by disjoint cycles of total length at most n)
+ *  describes the lengths by a union of per-cycle arithmetic progressions instead of the single loop which
+ *  @c contains(), @c get_loop_start() and @c get_period() rely on, and is not implemented here. The lasso is small
+ *  for automata whose cycle lengths have a small least common multiple, which is the common case for automata from
+ *  string constraints.
+ */
+class LengthAbstraction {
+  public:
+	/**
+	 * @brief Compute the length abstraction of @p aut.
+	 *
+	 * @param[in] aut Input automaton.
+	 */
+	explicit LengthAbstraction(const Nfa& aut);
+
+	/// Check whether @p aut accepts a word of length @p length.
+	bool contains(size_t length) const;
+	/// Check whether the set of lengths is finite.
+	bool is_finite() const;
+	/// Check whether the set of lengths is empty.
+	bool is_empty() const { return !get_min_length().has_value(); }
+	/// Get the length of the shortest word, or @c std::nullopt if there is no word.
+	std::optional<size_t> get_min_length() const;
+	/// Get the length of the longest word, or @c std::nullopt if there is no word or the set of lengths is infinite.
+	std::optional<size_t> get_max_length() const;
+
+	/// Get the length where the loop of the lasso starts (the number of sets in the prefix).
+	size_t get_loop_start() const { return loop_start_; }
+	/// Get the length of the loop of the lasso, 0 if there is no loop.
+	size_t get_period() const { return period_; }
+
+	/**
+	 * @brief Get the lengths as a set of pairs <u,v> where for each such a pair, there is a word with length u+k*v for
+	 *  all ks (see @c get_word_lengths()).
+	 */
+	std::set<std::pair<int, int>> get_word_lengths() const;
+
+  private:
+	/// Whether the i-th set of states of the lasso contains a final state.
+	BoolVector is_accepting_{};
+	size_t loop_start_{0};
+	size_t period_{0};
+}; // class LengthAbstraction.
+
 /**
  * @brief Get the lengths of all words in the automaton @p aut. The function returns a set of pairs <u,v> where for each
  * such a pair there is a word with length u+k*v for all ks. The disjunction of such formulae of all pairs hence
@@ -305,6 +370,115 @@ using SegmentWithEpsilonsCounter = std::pair<std::shared_ptr<Nfa>, VisitedEpsilo
 /// Noodles as segments enriched with EpsCntMap
 using NoodleWithEpsilonsCounter = std::vector<SegmentWithEpsilonsCounter>;
 
+/**
+ * @brief Cache of noodlification results shared between calls of the noodlification functions.
+ *
+ * String solvers noodlify the same or slightly refined automata over and over again. The cache remembers:
+ *  - the noodles computed for the given input automata and parameters, so that the concatenation, the product and
+ *    the segmentation are skipped when the same automata are noodlified again, and
+ *  - the reduced segments created by @c segs_one_initial_final(), keyed by the trimmed segments, so that the
+ *    segments which did not change in a refined segment automaton are reused instead of being reduced again.
+ *
+ * Entries are looked up by a structural hash of the automata (see @c std::hash<Nfa>), hash collisions are resolved
+ *  by @c Nfa::is_identical(). Hence, each entry keeps a copy of its key automata: the automata of the caller may be
+ *  changed or destroyed after the call, and a key made of hashes only could return noodles of different automata.
+ *  When the number of entries reaches the capacity of the cache, the least recently used entry is evicted.
+ * Segments of noodles returned from the cache are shared between all results using the cache and must not be
+ *  modified. The cache is not thread-safe.
+ */
+class NoodlificationCache {
+  public:
+	/// Numbers of cache hits, misses and evicted entries.
+	struct Statistics {
+		size_t noodles_hits{0};
+		size_t noodles_misses{0};
+		size_t segments_hits{0};
+		size_t segments_misses{0};
+		size_t evictions{0};
+	};
+
+	/**
+	 * @brief Create an empty cache.
+	 *
+	 * @param[in] max_num_of_entries Maximal number of entries (noodlification results and segments) to store.
+	 */
+	explicit NoodlificationCache(const size_t max_num_of_entries = 1024) : max_num_of_entries_{max_num_of_entries} {}
+	// The entries refer to the memos of the cache they are stored in.
+	NoodlificationCache(const NoodlificationCache&) = delete;
+	NoodlificationCache& operator=(const NoodlificationCache&) = delete;
+
+	/**
+	 * @brief Find noodles computed for @p automata with @p params.
+	 *
+	 * @param[in] automata Input automata of the noodlification.
+	 * @param[in] params Description of the noodlification (the function and its parameters).
+	 * @return Cached noodles, or @c nullptr if there are none. The noodles stay valid until the next insertion.
+	 */
+	const std::vector<Noodle>* find_noodles(const std::vector<const Nfa*>& automata, const std::string& params);
+	/// Store @p noodles computed for @p automata with @p params.
+	void insert_noodles(
+		const std::vector<const Nfa*>& automata, const std::string& params, std::vector<Noodle> noodles
+	);
+
+	/// Find noodles with counters of visited epsilons computed for @p automata with @p params.
+	const std::vector<NoodleWithEpsilonsCounter>*
+		find_noodles_with_epsilons_counter(const std::vector<const Nfa*>& automata, const std::string& params);
+	/// Store @p noodles with counters of visited epsilons computed for @p automata with @p params.
+	void insert_noodles_with_epsilons_counter(
+		const std::vector<const Nfa*>& automata,
+		const std::string& params,
+		std::vector<NoodleWithEpsilonsCounter> noodles
+	);
+
+	/**
+	 * @brief Get the trimmed and reduced @p segment with only the given initial and final state.
+	 *
+	 * @param[in] segment Untrimmed segment.
+	 * @param[in] initial_state Initial state to keep, or @c std::nullopt to keep all initial states.
+	 * @param[in] final_state Final state to keep, or @c std::nullopt to keep all final states.
+	 * @return Trimmed and reduced segment (possibly without any states), reduced only if the trimmed segment is not
+	 *  cached yet.
+	 */
+	std::shared_ptr<Nfa>
+		get_segment(const Nfa& segment, std::optional<State> initial_state, std::optional<State> final_state);
+
+	/// Get numbers of cache hits and misses.
+	const Statistics& get_statistics() const { return statistics_; }
+	/// Get the number of cached entries.
+	size_t num_of_entries() const { return num_of_entries_; }
+	/// Remove all entries from the cache (keeps the statistics).
+	void clear();
+
+  private:
+	/// Entries from the most to the least recently used, each represented by a function removing it from its memo.
+	using Recency = std::list<std::function<void()>>;
+	/// Cached value together with its key.
+	template <class Value> struct Entry {
+		std::vector<std::shared_ptr<const Nfa>> automata;
+		std::string params;
+		Value value;
+		Recency::iterator recency_it;
+	};
+	/// Entries with the same hash of their keys.
+	template <class Value> using Memo = std::unordered_map<size_t, std::list<Entry<Value>>>;
+
+	/// Find the entry for @p automata with @p params and mark it as the most recently used.
+	template <class Value>
+	const Value* find(Memo<Value>& memo, const std::vector<const Nfa*>& automata, const std::string& params);
+	template <class Value>
+	void insert(Memo<Value>& memo, const std::vector<const Nfa*>& automata, const std::string& params, Value value);
+	/// Make room for a new entry by evicting the least recently used entries.
+	void reserve_entry();
+
+	size_t max_num_of_entries_;
+	size_t num_of_entries_{0};
+	Statistics statistics_{};
+	Recency recency_{};
+	Memo<std::vector<Noodle>> noodles_{};
+	Memo<std::vector<NoodleWithEpsilonsCounter>> noodles_with_epsilons_counter_{};
+	Memo<std::shared_ptr<Nfa>> segments_{};
+}; // class NoodlificationCache.
+
 /**
  * @brief segs_one_initial_final
  *
@@ -320,7 +494,8 @@ void segs_one_initial_final(
 	const std::vector<Nfa>& segments,
 	bool include_empty,
 	const State& unused_state,
-	std::map<std::pair<State, State>, std::shared_ptr<Nfa>>& out
+	std::map<std::pair<State, State>, std::shared_ptr<Nfa>>& out,
+	NoodlificationCache* cache = nullptr
 );
 
 /**
@@ -333,9 +508,86 @@ void segs_one_initial_final(
  * @param[in] automaton Segment automaton to noodlify.
  * @param[in] epsilon Epsilon symbol to noodlify for.
  * @param[in] include_empty Whether to also include empty noodles.
+ * @param[in,out] cache Optional cache of noodlification results to reuse and fill.
  * @return A list of all (non-empty) noodles.
  */
-std::vector<Noodle> noodlify(const SegNfa& aut, Symbol epsilon, bool include_empty = false);
+std::vector<Noodle>
+	noodlify(const SegNfa& aut, Symbol epsilon, bool include_empty = false, NoodlificationCache* cache = nullptr);
+
+/**
+ * @brief Lazy generator of noodles of a segment automaton.
+ *
+ * Generates the same noodles in the same order as @c noodlify(), but one at a time, so that the caller can stop as
+ *  soon as a suitable noodle is found. Instead of enumerating all combinations of ε-transitions (one from each depth)
+ *  and throwing away those whose consecutive segments cannot be connected, the generator searches only the
+ *  combinations where each ε-transition is connected to its neighbours by a non-empty segment.
+ */
+class NoodleGenerator {
+  public:
+	/**
+	 * @brief Prepare generation of noodles of segment automaton @p aut.
+	 *
+	 * @param[in] aut Segment automaton to noodlify.
+	 * @param[in] epsilon Epsilon symbol to noodlify for.
+	 * @param[in] include_empty Whether to also include empty noodles.
+	 * @param[in,out] cache Optional cache of segments to reuse and fill.
+	 */
+	NoodleGenerator(
+		const SegNfa& aut, Symbol epsilon, bool include_empty = false, NoodlificationCache* cache = nullptr
+	);
+
+	/**
+	 * @brief Generate the next noodle.
+	 *
+	 * @return The next noodle, or @c std::nullopt if all noodles have been generated.
+	 */
+	std::optional<Noodle> next();
+
+	/**
+	 * @brief Check whether all noodles have been generated.
+	 */
+	bool finished() const { return finished_; }
+
+  private:
+	/// Marker for a depth without a chosen ε-transition.
+	static constexpr size_t NO_CHOICE{std::numeric_limits<size_t>::max()};
+
+	/// Get the segment from @p init to @p final, or @c nullptr if there is no such segment.
+	std::shared_ptr<Nfa> get_segment(State init, State final) const;
+	/// Check whether the ε-transition @p index at @p depth is connected to the chosen ε-transition at the next depth.
+	bool is_connected_to_next_depth(size_t depth, size_t index) const;
+
+	/// Single noodle of a segment automaton with a single segment, if not yet generated.
+	std::optional<Noodle> single_segment_noodle_{};
+	State unused_state_{};
+	std::map<std::pair<State, State>, std::shared_ptr<Nfa>> segments_one_initial_final_{};
+	/// ε-transitions for each depth.
+	std::vector<std::vector<Transition>> epsilon_depths_{};
+	/// Whether the ε-transition at a depth can be connected with some ε-transitions from all previous depths.
+	std::vector<BoolVector> is_connected_to_first_segment_{};
+	/// Index of the chosen ε-transition for each depth.
+	std::vector<size_t> choices_{};
+	/// Depth where the search for the next combination of ε-transitions continues.
+	size_t current_depth_{};
+	bool finished_{false};
+}; // class NoodleGenerator.
+
+/**
+ * @brief Find the first noodle (in the order of @c noodlify()) satisfying @p predicate.
+ *
+ * The noodles are generated lazily by @p generator and evaluated on @p num_of_threads worker threads. As soon as
+ *  a noodle satisfying @p predicate is found, no further noodles are generated. The result is the same as when the
+ *  noodles are evaluated sequentially.
+ *
+ * @param[in,out] generator Generator of noodles to evaluate.
+ * @param[in] predicate Predicate to evaluate on noodles. It is called concurrently from multiple threads; segments
+ *  are shared between noodles and must not be modified by @p predicate.
+ * @param[in] num_of_threads Number of worker threads. If 0, uses the number of hardware threads.
+ * @return The first noodle satisfying @p predicate, or @c std::nullopt if there is no such noodle.
+ */
+std::optional<Noodle> find_noodle(
+	NoodleGenerator& generator, const std::function<bool(const Noodle&)>& predicate, size_t num_of_threads = 0
+);
 
 /**
  * @brief Create noodles from segment automaton @p aut.
@@ -347,10 +599,15 @@ std::vector<Noodle> noodlify(const SegNfa& aut, Symbol epsilon, bool include_emp
  * @param[in] automaton Segment automaton to noodlify.
  * @param[in] epsilons Epsilon symbols to noodlify for.
  * @param[in] include_empty Whether to also include empty noodles.
+ * @param[in,out] cache Optional cache of segments to reuse and fill.
  * @return A list of all (non-empty) noodles.
  */
-std::vector<NoodleWithEpsilonsCounter>
-	noodlify_mult_eps(const SegNfa& aut, const std::set<Symbol>& epsilons, bool include_empty = false);
+std::vector<NoodleWithEpsilonsCounter> noodlify_mult_eps(
+	const SegNfa& aut,
+	const std::set<Symbol>& epsilons,
+	bool include_empty = false,
+	NoodlificationCache* cache = nullptr
+);
 
 /**
  * @brief Create noodles for left and right side of equation.
@@ -370,13 +627,15 @@ std::vector<NoodleWithEpsilonsCounter>
  * @param[in] params Additional parameters for the noodlification:
  *     - "reduce": "false", "forward", "backward", "bidirectional"; Execute forward, backward or bidirectional
  * simulation minimization before noodlification.
+ * @param[in,out] cache Optional cache of noodlification results to reuse and fill.
  * @return A list of all (non-empty) noodles.
  */
 std::vector<Noodle> noodlify_for_equation(
 	const std::vector<std::reference_wrapper<Nfa>>& lhs_automata,
 	const Nfa& rhs_automaton,
 	bool include_empty = false,
-	const ParameterMap& params = {{"reduce", "false"}}
+	const ParameterMap& params = {{"reduce", "false"}},
+	NoodlificationCache* cache = nullptr
 );
 
 /**
@@ -397,13 +656,15 @@ std::vector<Noodle> noodlify_for_equation(
  * @param[in] params Additional parameters for the noodlification:
  *     - "reduce": "false", "forward", "backward", "bidirectional"; Execute forward, backward or bidirectional
  * simulation minimization before noodlification.
+ * @param[in,out] cache Optional cache of noodlification results to reuse and fill.
  * @return A list of all (non-empty) noodles.
  */
 std::vector<Noodle> noodlify_for_equation(
 	const std::vector<Nfa*>& lhs_automata,
 	const Nfa& rhs_automaton,
 	bool include_empty = false,
-	const ParameterMap& params = {{"reduce", "false"}}
+	const ParameterMap& params = {{"reduce", "false"}},
+	NoodlificationCache* cache = nullptr
 );
 
 /**
@@ -415,13 +676,44 @@ std::vector<Noodle> noodlify_for_equation(
  * @param[in] params Additional parameters for the noodlification:
  *     - "reduce": "false", "forward", "backward", "bidirectional"; Execute forward, backward or bidirectional
  * simulation minimization before noodlification.
+ * @param[in,out] cache Optional cache of noodlification results to reuse and fill.
  * @return A list of all (non-empty) noodles together with the positions reached from the beginning of left/right side.
  */
 std::vector<NoodleWithEpsilonsCounter> noodlify_for_equation(
 	const std::vector<std::shared_ptr<Nfa>>& lhs_automata,
 	const std::vector<std::shared_ptr<Nfa>>& rhs_automata,
 	bool include_empty = false,
-	const ParameterMap& params = {{"reduce", "false"}}
+	const ParameterMap& params = {{"reduce", "false"}},
+	NoodlificationCache* cache = nullptr
+);
+
+/// Regular constraints of the variables of a string equation x_1 ... x_n = y_1 ... y_m.
+struct Equation {
+	std::vector<std::shared_ptr<Nfa>> lhs_automata; ///< Constraints of the variables on the left side.
+	std::vector<std::shared_ptr<Nfa>> rhs_automata; ///< Constraints of the variables on the right side.
+};
+
+/**
+ * @brief Create a random string equation to noodlify with @c noodlify_for_equation().
+ *
+ * The constraint of each variable is a trimmed random NFA created by @c nfa::builder::create_random_nfa_tabakov_vardi()
+ *  with the final state density 0.5.
+ *
+ * @param num_of_lhs_variables Number of variables on the left side.
+ * @param num_of_rhs_variables Number of variables on the right side.
+ * @param num_of_states Number of states of each constraint before trimming.
+ * @param alphabet_size Size of the alphabet {0, ..., alphabet_size - 1}.
+ * @param states_transitions_ratio_per_symbol Ratio between the number of transitions over a symbol and the number of
+ *  states of each constraint.
+ * @param seed Seed for the PRNG used. If no seed is given, the algorithm chooses one uniformly at random.
+ */
+Equation create_random_equation(
+	size_t num_of_lhs_variables,
+	size_t num_of_rhs_variables,
+	size_t num_of_states,
+	size_t alphabet_size,
+	double states_transitions_ratio_per_symbol,
+	const std::optional<unsigned int>& seed = std::nullopt
 );
 
 struct TransducerNoodleElement {
@@ -101,6 +101,31 @@ bool is_universal_naive(const Nfa& aut, const Alphabet& alphabet, Run* cex);
  */
 bool is_universal_antichains(const Nfa& aut, const Alphabet& alphabet, Run* cex);
 
+/// Order in which the antichain-based algorithms process the worklist of macrostates.
+enum class SearchStrategy {
+	Dfs, ///< The last reached macrostate first.
+	Bfs, ///< The first reached macrostate first.
+	SmallestFirst, ///< The macrostate with the fewest states first; small macrostates prune more.
+};
+
+/**
+ * @brief check universality based on subset construction with antichains, expanding macrostates on multiple threads.
+ *
+ * Each round takes a macrostate from the worklist and computes its posts over all symbols in parallel, so the check
+ *  scales with the size of the alphabet. The macrostates are explored in the same order on any number of threads,
+ *  hence the result and the counterexample do not depend on the number of threads.
+ *
+ * @param[in] aut Automaton which universality is checked
+ * @param[in] alphabet Alphabet of the automaton
+ * @param[out] cex Counterexample word which eventually breaks the universality
+ * @param[in] strategy Order in which the macrostates are processed.
+ * @param[in] num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @return True if the automaton is universal, otherwise false.
+ */
+bool is_universal_antichains(
+	const Nfa& aut, const Alphabet& alphabet, Run* cex, SearchStrategy strategy, size_t num_of_threads = 1
+);
+
 Simlib::Util::BinaryRelation compute_relation(
 	const Nfa& aut, const ParameterMap& params = {{"relation", "simulation"}, {"direction", "forward"}}
 );
@@ -126,6 +151,38 @@ Nfa product(
 	std::unordered_map<std::pair<State, State>, State>* product_map = nullptr
 );
 
+/**
+ * @brief Compute product of two NFAs on multiple threads, final condition is to be specified, with a possibility of
+ * using multiple epsilons.
+ *
+ * The product is explored in rounds. Each round computes the posts of the product states discovered in the previous
+ *  round on @p num_of_threads threads, looking up and creating the product states in a concurrent map of pairs. Each
+ *  thread collects the computed posts in its own fragment of the transition relation; the fragments are moved into
+ *  the product at the end.
+ *
+ * Without @p deterministic_numbering, the numbers of the product states depend on the scheduling of the threads. With
+ *  @p deterministic_numbering, the product states are renumbered in the breadth-first order (the targets of the same
+ *  symbol ordered by their pairs of original states), so that the product does not depend on the number of threads.
+ *
+ * @param[in] lhs First NFA to compute intersection for.
+ * @param[in] rhs Second NFA to compute intersection for.
+ * @param[in] final_condition The predicate that tells whether a pair of states is final (conjunction for intersection).
+ * @param[in] num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @param[in] deterministic_numbering Whether to number the product states independently of the threads.
+ * @param[in] first_epsilon The smallest epsilon.
+ * @param[out] product_map Can be used to get the mapping of the pairs of the original states to product states.
+ * @return NFA as a product of NFAs @p lhs and @p rhs with ε-transitions preserved.
+ */
+Nfa product_parallel(
+	const Nfa& lhs,
+	const Nfa& rhs,
+	const std::function<bool(State, State)>& final_condition,
+	size_t num_of_threads = 0,
+	bool deterministic_numbering = true,
+	Symbol first_epsilon = EPSILON,
+	std::unordered_map<std::pair<State, State>, State>* product_map = nullptr
+);
+
 /**
  * @brief Concatenate two NFAs.
  *
@@ -193,6 +250,44 @@ Nfa reduce_residual_with(const Nfa& nfa);
  */
 Nfa reduce_residual_after(const Nfa& nfa);
 
+/**
+ * @brief Check whether @p aut is dense enough for the bit-parallel reachability algorithms to pay off.
+ *
+ * Used by @c Nfa::get_reachable_states(), @c Nfa::get_useful_states() and @c Nfa::is_lang_empty() to switch
+ *  between the state-by-state searches and the bit-parallel ones.
+ */
+bool is_dense(const Nfa& aut);
+
+/**
+ * @brief Get states reachable from @p sources using a breadth-first search over frontiers represented as bit vectors.
+ *
+ * The search is direction-optimizing: a small frontier is expanded top-down (visiting successors of the frontier
+ *  states), a large frontier bottom-up (looking for a predecessor in the frontier for each unvisited state).
+ * @param[in] aut Automaton to search in.
+ * @param[in] sources States to start the search from.
+ * @param[in] backward Whether to search over reverted transitions, i.e., for states reaching @p sources.
+ * @return Bool vector whose `i`-th value is true iff the state `i` is reachable.
+ */
+BoolVector get_reachable_states_bit_parallel(
+	const Nfa& aut, const utils::SparseSet<State>& sources, bool backward = false
+);
+
+/**
+ * @brief Get useful states (reachable from @p initial_states and reaching @p final_states) using bit-parallel
+ *  forward and backward searches (see @c get_reachable_states_bit_parallel()).
+ *
+ * @return Bool vector whose `i`-th value is true iff the state `i` is useful, as @c Nfa::get_useful_states().
+ */
+BoolVector get_useful_states_bit_parallel(
+	const Nfa& aut, const utils::SparseSet<State>& initial_states, const utils::SparseSet<State>& final_states
+);
+
+/**
+ * @brief Check language emptiness using a bit-parallel forward search (see @c get_reachable_states_bit_parallel())
+ *  which stops as soon as a final state is reached.
+ */
+bool is_lang_empty_bit_parallel(const Nfa& aut);
+
 } // Namespace mata::nfa::algorithms.
 
 #endif // MATA_NFA_INTERNALS_HH_
@@ -67,6 +67,52 @@ Nfa create_random_nfa_tabakov_vardi(
 	const std::optional<unsigned int>& seed = std::nullopt
 );
 
+/**
+ * @brief Create an NFA accepting the words whose @p n-th symbol from the end is @p symbol.
+ *
+ * The NFA has n + 1 states while the minimal DFA has 2^n states, making the NFA the worst case of the subset
+ *  construction.
+ *
+ * @param n Position of @p symbol counted from the end of the word, at least 1.
+ * @param alphabet_size Size of the alphabet {0, ..., alphabet_size - 1}.
+ * @param symbol Symbol at the n-th position from the end.
+ */
+Nfa create_nth_from_last_nfa(size_t n, size_t alphabet_size = 2, Symbol symbol = 0);
+
+/**
+ * @brief Create a pair of NFAs whose inclusion is hard to check with antichains.
+ *
+ * The bigger NFA is the union of @c create_nth_from_last_nfa() for all symbols. It accepts all words of length at
+ *  least @p n, and its subset construction reaches alphabet_size^n pairwise incomparable macrostates. The smaller NFA
+ *  accepts all words of length at least @p n if @p included, or at least n - 1 otherwise, so that the only
+ *  counterexamples are the words of length n - 1.
+ *
+ * @param n Length of the suffixes the bigger NFA tracks, at least 1.
+ * @param alphabet_size Size of the alphabet {0, ..., alphabet_size - 1}.
+ * @param included Whether the language of the smaller NFA is included in the language of the bigger NFA.
+ * @return The pair (smaller, bigger).
+ */
+std::pair<Nfa, Nfa> create_hard_inclusion_pair(size_t n, size_t alphabet_size = 2, bool included = true);
+
+/**
+ * @brief Create a random NFA with a deep chain of epsilon transitions.
+ *
+ * States 0, ..., num_of_states - 1 form a chain of transitions over @p epsilon, so the epsilon closure of state i
+ *  contains all states from i on. Each state has one more transition over a random symbol to a random state. State 0
+ *  is initial and the last state is final.
+ *
+ * @param num_of_states Number of states (the length of the chain).
+ * @param alphabet_size Size of the alphabet {0, ..., alphabet_size - 1} of the non-epsilon transitions.
+ * @param seed Seed for the PRNG used. If no seed is given, the algorithm chooses one uniformly at random.
+ * @param epsilon Symbol used as epsilon.
+ */
+Nfa create_epsilon_chain_nfa(
+	size_t num_of_states,
+	size_t alphabet_size,
+	const std::optional<unsigned int>& seed = std::nullopt,
+	Symbol epsilon = EPSILON
+);
+
 /** Loads an automaton from Parsed object */
 // TODO this function should the same thing as the one taking IntermediateAut or be deleted
 Nfa construct(const mata::parser::ParsedSection& parsec, Alphabet* alphabet, NameStateMap* state_map = nullptr);
@@ -88,6 +134,10 @@ Nfa construct(const ParsedObject& parsed, Alphabet* alphabet = nullptr, NameStat
 /**
  * Parse NFA from the mata format in an input stream.
  *
+ * Plain explicit NFAs (see @c parse_from_mata_explicit()) are parsed line by line, without reading the whole stream
+ *  into memory first. Other input is parsed by the generic parser: from the rewound stream if it supports seeking,
+ *  otherwise from a copy of the input.
+ *
  * @param nfa_stream Input stream containing NFA in mata format.
  * @throws std::runtime_error Parsing of NFA fails.
  */
@@ -110,6 +160,47 @@ Nfa parse_from_mata(const std::string& nfa_in_mata);
  */
 Nfa parse_from_mata(const std::filesystem::path& nfa_file);
 
+/**
+ * @brief Parse an explicit NFA (@c \@NFA-explicit) from the mata format in a single pass over @p nfa_in_mata.
+ *
+ * The fast path used by @c parse_from_mata(). It avoids the generic tokenizer and the intermediate automaton: state
+ *  names are interned as views into @p nfa_in_mata and the transitions are added to the delta in bulk, in sorted
+ *  order. States are numbered in the order of their first occurrence in the input.
+ *
+ * The numbering of states may differ from the one of the generic parser (@c construct() of the parsed automaton),
+ *  which numbers the initial states first, in an unspecified order, then the states of the transitions and the final
+ *  states. Both parsers produce the same automaton up to renaming of the states, which is given by @p state_map.
+ *
+ * Only plain explicit NFAs are handled: symbols have to be numbers, and initial and final states have to be lists
+ *  of state names. For any other input (formulae, quoting, escaping, other automata types, other keys than
+ *  @c %Alphabet-auto, @c %Initial and @c %Final, invalid input, ...), @c std::nullopt is returned and the input
+ *  should be parsed with the generic parser.
+ *
+ * @param nfa_in_mata NFA in the mata format.
+ * @param state_map If specified, filled with the mapping of state names to states.
+ * @return Parsed NFA, or @c std::nullopt if the input is not a plain explicit NFA.
+ */
+std::optional<Nfa> parse_from_mata_explicit(std::string_view nfa_in_mata, NameStateMap* state_map = nullptr);
+
+/**
+ * @brief Load a corpus of NFAs in the mata format from @p nfa_files over the common @p alphabet.
+ *
+ * The files are parsed on @p num_of_threads threads, plain explicit NFAs with @c parse_from_mata_explicit(). Automata
+ *  over bitvectors are mintermized together (see @c Mintermization::mintermize()), so that they share the same
+ *  minterms, which become symbols of @p alphabet named by their numbers prefixed with "minterm:". Symbols of explicit
+ *  automata keep their names and are added to @p alphabet in the order of the files and of their occurrence in a file.
+ *
+ * @param nfa_files Paths to the files, each containing a single NFA in the mata format.
+ * @param alphabet Alphabet to translate the symbols with.
+ * @param num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @return NFAs in the order of @p nfa_files.
+ * @throws std::runtime_error Some file does not exist, parsing of some NFA fails, or a symbol of an explicit automaton
+ *  starts with the reserved prefix "minterm:".
+ */
+std::vector<Nfa> load_automata(
+	const std::vector<std::filesystem::path>& nfa_files, OnTheFlyAlphabet& alphabet, size_t num_of_threads = 0
+);
+
 /**
  * @brief Create NFA from @p regex
  *
@@ -0,0 +1,84 @@
+/** @file
+ * @brief Complement of NFAs represented by implicitly complete DFAs.
+ *
+ * @c complement() makes the determinized automaton complete by adding a sink state with a transition over every
+ *  missing symbol from every state, which is a transition per symbol of the alphabet for a state with few
+ *  transitions. The representation here keeps the determinized automaton partial instead: a missing transition over
+ *  a symbol of the alphabet implicitly leads to an accepting sink. Operations on the complement handle the sink
+ *  without creating its transitions.
+ */
+
+#ifndef MATA_NFA_COMPLEMENT_HH_
+#define MATA_NFA_COMPLEMENT_HH_
+
+#include "nfa.hh"
+
+namespace mata::nfa {
+
+/**
+ * @brief Complement of an NFA as a partial DFA with an implicit accepting sink state.
+ *
+ * The language consists of the words over @c symbols which either are accepted by @c dfa, or have a prefix that
+ *  leads in @c dfa to a state without a transition over the next symbol (such a prefix is followed by the implicit
+ *  sink, which accepts every word over @c symbols). Words containing symbols outside @c symbols are not in the
+ *  language.
+ */
+class ImplicitComplement {
+  public:
+	/// Deterministic automaton with transitions over @c symbols only, without the sink state.
+	Nfa dfa;
+	/// Symbols the complement is computed over.
+	utils::OrdVector<Symbol> symbols;
+
+	/// Whether the word of @p run is in the language.
+	bool is_in_lang(const Run& run) const;
+
+	/**
+	 * @brief Check emptiness of the language.
+	 *
+	 * @param[out] cex Word from the language if it is not empty. The path consists of the states of @c dfa read
+	 *  before the word enters the implicit sink.
+	 */
+	bool is_lang_empty(Run* cex = nullptr) const;
+
+	/// Create the complete DFA with the sink state materialized.
+	Nfa to_nfa() const;
+};
+
+/**
+ * @brief Compute the complement of @p aut over @p symbols as an implicitly complete DFA.
+ *
+ * The macrostates are constructed on the fly from the trimmed @p aut, hence every macrostate which accepts no word
+ *  is the empty one, i.e., it is the implicit sink and is not constructed.
+ */
+ImplicitComplement complement_implicit(const Nfa& aut, const utils::OrdVector<Symbol>& symbols);
+
+/**
+ * @brief Compute the intersection of @p lhs and the implicitly complete complement @p rhs.
+ *
+ * Transitions of @p lhs over symbols outside @c rhs.symbols are dropped. All symbols of @p lhs are treated as
+ *  ordinary symbols.
+ *
+ * @param[out] prod_map Mapping of pairs of the original states (lhs_state, rhs_state) to product states, where the
+ *  implicit sink of @p rhs is @c rhs.dfa.num_of_states().
+ */
+Nfa intersection(
+	const Nfa& lhs,
+	const ImplicitComplement& rhs,
+	std::unordered_map<std::pair<State, State>, State>* prod_map = nullptr
+);
+
+/**
+ * @brief Check inclusion of the language of @p smaller in the implicitly complete complement @p bigger.
+ *
+ * The pairs of states of @p smaller and the implicit sink of @p bigger are not explored if the state of @p smaller
+ *  cannot reach a transition over a symbol outside @c bigger.symbols, since the sink accepts all such continuations.
+ *  All symbols of @p smaller are treated as ordinary symbols.
+ *
+ * @param[out] cex Counterexample for the inclusion, with a path in @p smaller.
+ */
+bool is_included(const Nfa& smaller, const ImplicitComplement& bigger, Run* cex = nullptr);
+
+} // namespace mata::nfa
+
+#endif // MATA_NFA_COMPLEMENT_HH_
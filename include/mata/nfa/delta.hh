@@ -11,7 +11,9 @@
 #include "mata/utils/sparse-set.hh"
 #include "mata/utils/synchronized-iterator.hh"
 
+#include <algorithm>
 #include <iterator>
+#include <span>
 
 namespace mata::nfa {
 
@@ -134,16 +136,9 @@ class StatePost : utils::OrdVector<SymbolPost> {
 	using super::erase;
 
 	using super::find;
-	iterator find(const Symbol symbol) {
-		static SymbolPost symbol_post{};
-		symbol_post.symbol = symbol;
-		return super::find(symbol_post);
-	}
-	const_iterator find(const Symbol symbol) const {
-		static SymbolPost symbol_post{};
-		symbol_post.symbol = symbol;
-		return super::find(symbol_post);
-	}
+	// Searching by the symbol alone (not via a shared scratch @c SymbolPost) keeps concurrent readers race-free.
+	iterator find(const Symbol symbol) { return find_symbol(begin(), end(), symbol); }
+	const_iterator find(const Symbol symbol) const { return find_symbol(cbegin(), cend(), symbol); }
 
 	/// returns an iterator to the smallest epsilon, or end() if there is no epsilon
 	const_iterator first_epsilon_it(Symbol first_epsilon) const;
@@ -228,6 +223,15 @@ class StatePost : utils::OrdVector<SymbolPost> {
 	 * Count the number of all moves in @c StatePost.
 	 */
 	size_t num_of_moves() const;
+
+  private:
+	/// Find the symbol post with @p symbol in the sorted range [@p first, @p last), or return @p last.
+	template <class Iterator> static Iterator find_symbol(Iterator first, Iterator last, const Symbol symbol) {
+		const auto it{std::lower_bound(first, last, symbol, [](const SymbolPost& symbol_post, const Symbol value) {
+			return symbol_post.symbol < value;
+		})};
+		return (it == last || it->symbol != symbol) ? last : it;
+	}
 }; // class StatePost.
 
 /**
@@ -474,6 +478,23 @@ class Delta {
 	 */
 	void add(State source, Symbol symbol, const StateSet& targets);
 
+	/**
+	 * @brief Add transitions given as three parallel arrays of the same size.
+	 *
+	 * The i-th transition is (@p sources[i], @p symbols[i], @p targets[i]). The transitions are bucketed by their
+	 *  source states first, so that every state post is built at once instead of inserting transitions one by one.
+	 * @throws std::invalid_argument If the arrays differ in size.
+	 */
+	void add(std::span<const State> sources, std::span<const Symbol> symbols, std::span<const State> targets);
+
+	/**
+	 * @brief Copy all transitions into three parallel arrays, ordered by source states, symbols and target states.
+	 *
+	 * The i-th transition is written as (@p sources[i], @p symbols[i], @p targets[i]).
+	 * @throws std::invalid_argument If any of the arrays does not have exactly @c num_of_transitions() elements.
+	 */
+	void copy_transitions_to(std::span<State> sources, std::span<Symbol> symbols, std::span<State> targets) const;
+
 	using const_iterator = std::vector<StatePost>::const_iterator;
 	const_iterator cbegin() const { return state_posts_.cbegin(); }
 	const_iterator cend() const { return state_posts_.cend(); }
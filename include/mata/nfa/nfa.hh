@@ -250,7 +250,8 @@ class Nfa {
 	/**
 	 * @brief Get set of reachable states.
 	 *
-	 * Reachable states are states accessible from any initial state.
+	 * Reachable states are states accessible from any initial state. For dense automata (see
+	 *  @c algorithms::is_dense()), uses the bit-parallel search @c algorithms::get_reachable_states_bit_parallel().
 	 * @return Set of reachable states.
 	 * TODO: with the new get_useful_states, it might be useless now.
 	 */
@@ -268,7 +269,8 @@ class Nfa {
 	/**
 	 * @brief Get the useful states using a modified Tarjan's algorithm.
 	 *
-	 * A state is useful if it is reachable from an initial state and can reach a final state.
+	 * A state is useful if it is reachable from an initial state and can reach a final state. For dense automata (see
+	 *  @c algorithms::is_dense()), uses the bit-parallel searches @c algorithms::get_useful_states_bit_parallel().
 	 *
 	 * @param initial_states Optional set of initial states to consider when computing usefulness. If @c std::nullopt,
 	 * uses the NFA's initial states.
@@ -519,7 +521,8 @@ class Nfa {
 
 	/**
 	 * Check whether the language of NFA is empty.
-	 * Currently, calls is_lang_empty_scc if cex is null
+	 * Currently, calls is_lang_empty_scc if cex is null (or @c algorithms::is_lang_empty_bit_parallel() for dense
+	 *  automata, see @c algorithms::is_dense()).
 	 * @param[out] cex Counter-example path for a case the language is not empty.
 	 * @return True if the language is empty, false otherwise.
 	 */
@@ -587,6 +590,10 @@ class Nfa {
 	 * - "algorithm":
 	 *      - "antichains": The algorithm uses antichains to check the universality.
 	 *      - "naive": The algorithm uses the naive approach to check the universality.
+	 * - "strategy" (for "antichains"): Order of processing the macrostates, "dfs" (default), "bfs", or
+	 *   "smallest-first".
+	 * - "threads" (for "antichains"): Number of threads expanding the macrostates, 1 by default, 0 for the number of
+	 *   hardware threads.
 	 *
 	 * @return True if the language of the automaton is universal, false otherwise.
 	 */
@@ -602,6 +609,10 @@ class Nfa {
 	 * - "algorithm":
 	 *     - "antichains": The algorithm uses antichains to check the universality.
 	 *     - "naive": The algorithm uses the naive approach to check the universality.
+	 * - "strategy" (for "antichains"): Order of processing the macrostates, "dfs" (default), "bfs", or
+	 *   "smallest-first".
+	 * - "threads" (for "antichains"): Number of threads expanding the macrostates, 1 by default, 0 for the number of
+	 *   hardware threads.
 	 *
 	 * @return True if the language of the automaton is universal, false otherwise.
 	 */
@@ -713,6 +724,8 @@ class Nfa {
 	 * If you have an automaton with finite language (can be checked using @ref is_acyclic),
 	 * you can get all words by calling
 	 *      get_words(aut.num_of_states())
+	 *
+	 * To enumerate the words lazily (e.g., to stop after the first few words), use @c WordEnumerator.
 	 */
 	std::set<Word> get_words(size_t max_length) const;
 
@@ -800,6 +813,100 @@ class Nfa {
 	);
 }; // class Nfa.
 
+/**
+ * @brief Lazy enumerator of words in the language of an NFA in the length-lexicographic order.
+ *
+ * The NFA is determinized on the fly: the enumerator walks macrostates (sets of states reachable by the same word),
+ *  hence every accepted word is produced exactly once, regardless of the number of accepting runs over the word. The
+ *  words are searched by iterative deepening DFS, so the memory consumption is linear in the length of the currently
+ *  enumerated words. Macrostates which cannot reach a final state within the remaining length are pruned.
+ *
+ * All symbols (including epsilon symbols) are treated as ordinary symbols of the word, the same as in
+ *  @c Nfa::get_words().
+ *
+ * Usage:
+ * @code
+ * WordEnumerator enumerator{nfa, max_length};
+ * while (std::optional<Word> word{enumerator.next()}) { ... }
+ * @endcode
+ *
+ * @note The enumerator keeps a reference to the enumerated NFA. The NFA must outlive the enumerator and must not be
+ *  modified during the enumeration.
+ */
+class WordEnumerator {
+  public:
+	/**
+	 * @brief Create a lazy enumerator of words in the language of @p nfa.
+	 *
+	 * @param[in] nfa NFA whose language to enumerate.
+	 * @param[in] max_length Maximal length of enumerated words.
+	 * @param[in] max_num_of_words Maximal number of words to enumerate.
+	 */
+	explicit WordEnumerator(
+		const Nfa& nfa,
+		size_t max_length = std::numeric_limits<size_t>::max(),
+		size_t max_num_of_words = std::numeric_limits<size_t>::max()
+	);
+	WordEnumerator(const WordEnumerator&) = default;
+	WordEnumerator(WordEnumerator&&) = default;
+	WordEnumerator& operator=(const WordEnumerator&) = default;
+	WordEnumerator& operator=(WordEnumerator&&) = default;
+
+	/**
+	 * @brief Get the next word in the length-lexicographic order.
+	 *
+	 * @return The next accepted word, or @c std::nullopt if there are no more words (up to the specified limits).
+	 */
+	std::optional<Word> next();
+
+	/**
+	 * @brief Check whether the enumeration has finished (no more words will be returned).
+	 */
+	bool finished() const { return finished_ || num_of_words_ >= max_num_of_words_; }
+
+	/**
+	 * @brief Get the number of words enumerated so far.
+	 */
+	size_t num_of_words() const { return num_of_words_; }
+
+  private:
+	/// A macrostate on the DFS stack together with its (lazily computed) successor macrostates.
+	struct Frame {
+		StateSet macrostate;
+		bool expanded{false};
+		std::vector<std::pair<Symbol, StateSet>> successors{};
+		size_t next_successor{0};
+	};
+
+	/// Start the search for words of the next length. Return @c false if there are no longer words.
+	bool start_next_length();
+	/// Compute successor macrostates of @p frame over all symbols, omitting macrostates without a path to final.
+	void expand(Frame& frame) const;
+	/// Length of the shortest path from any state in @p macrostate to a final state.
+	State distance_to_final(const StateSet& macrostate) const;
+	/// Check whether @p macrostate has a transition to a state with a path to a final state.
+	bool can_be_extended(const StateSet& macrostate) const;
+
+	const Nfa* nfa_;
+	size_t max_length_;
+	size_t max_num_of_words_;
+	size_t num_of_words_{0};
+	StateSet initial_macrostate_;
+	/// Length of the shortest path to a final state for each state (@c Limits::max_state when there is none).
+	std::vector<State> distances_to_final_;
+	/// Whether the state has a transition to a state with a path to a final state.
+	BoolVector is_extendable_;
+	/// Currently searched length of words.
+	size_t current_length_{0};
+	bool started_{false};
+	bool finished_{false};
+	/// Whether some word longer than @c current_length_ might exist.
+	bool longer_words_exist_{false};
+	std::vector<Frame> stack_{};
+	/// Word read along the current DFS stack.
+	Word word_{};
+}; // class WordEnumerator.
+
 // Allow variadic number of arguments of the same type.
 //
 // Using parameter pack and variadic arguments.
@@ -893,6 +1000,29 @@ Nfa product(
 	std::unordered_map<std::pair<State, State>, State>* prod_map = nullptr
 );
 
+/**
+ * @brief Compute product of two NFAs on multiple threads.
+ *
+ * Suitable for large products, especially over large alphabets. See @c algorithms::product_parallel().
+ * @param lhs First NFA.
+ * @param rhs Second NFA.
+ * @param final_condition Condition for a product state to be final.
+ * @param num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @param deterministic_numbering Whether to number the product states independently of the scheduling of the threads.
+ * @param first_epsilon Smallest epsilon symbol.
+ * @param prod_map Mapping of pairs of the original states (lhs_state, rhs_state) to new product states (not used
+ * internally, allocated only when !=nullptr, expensive).
+ */
+Nfa product_parallel(
+	const Nfa& lhs,
+	const Nfa& rhs,
+	ProductFinalStateCondition final_condition = ProductFinalStateCondition::And,
+	size_t num_of_threads = 0,
+	bool deterministic_numbering = true,
+	Symbol first_epsilon = EPSILON,
+	std::unordered_map<std::pair<State, State>, State>* prod_map = nullptr
+);
+
 /**
  * @brief Compute a language difference as @p nfa_included \ @p nfa_excluded.
  *
@@ -1096,6 +1226,36 @@ inline bool is_included(
 	return is_included(smaller, bigger, nullptr, alphabet, params);
 }
 
+/**
+ * @brief Check inclusion of each of the automata @p smaller in @p bigger on multiple threads.
+ *
+ * The automata are only read, hence none of them may be modified during the call.
+ *
+ * @param[in] bigger Automaton to check the inclusion in.
+ * @param[in] smaller Automata to check the inclusion of.
+ * @param[in] alphabet Alphabet of all NFAs to compute with.
+ * @param[in] params Optional parameters to control the inclusion check algorithm, see @c is_included().
+ * @param[in] num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @return Vector with the result for the i-th automaton of @p smaller at index i.
+ */
+BoolVector is_included_many(
+	const Nfa& bigger,
+	const std::vector<const Nfa*>& smaller,
+	const Alphabet* alphabet = nullptr,
+	const ParameterMap& params = {{"algorithm", "antichains"}},
+	size_t num_of_threads = 0
+);
+
+/**
+ * @brief Check whether each of @p words is in the language of @p aut on multiple threads.
+ *
+ * @param[in] aut Automaton to check the membership in. It may not be modified during the call.
+ * @param[in] words Words to check.
+ * @param[in] num_of_threads Number of threads. If 0, uses the number of hardware threads.
+ * @return Vector with the result for the i-th word of @p words at index i.
+ */
+BoolVector is_in_lang_batch(const Nfa& aut, const std::vector<Word>& words, size_t num_of_threads = 0);
+
 /**
  * @brief Perform equivalence check of two NFAs: @p lhs and @p rhs.
  *
@@ -1153,6 +1313,27 @@ Nfa somewhat_simple_revert(const Nfa& aut);
 /// Removing epsilon transitions
 Nfa remove_epsilon(const Nfa& aut, Symbol epsilon = EPSILON);
 
+/**
+ * @brief Remove transitions over any of the symbols @p epsilons.
+ *
+ * Epsilon closures are computed over the condensation of the graph of epsilon transitions into strongly connected
+ *  components: the closures of components are propagated in reverse topological order using bit vectors. The symbol
+ *  posts of the result are then constructed in sorted order by merging the symbol posts of the closures.
+ *
+ * @param[in] aut Automaton to remove epsilon transitions from.
+ * @param[in] epsilons Symbols to handle as epsilons.
+ * @param[in] closure Where to apply the epsilon closures:
+ *  - @c EpsilonClosureOpt::Before: A state gets the transitions of all states in its epsilon closure and becomes final
+ *    if its epsilon closure contains a final state.
+ *  - @c EpsilonClosureOpt::After: A transition leads to all states in the epsilon closure of its target and the
+ *    initial states are extended with their epsilon closures.
+ * @return Automaton without epsilon transitions with the same language (over non-epsilon symbols) and states as @p aut.
+ * @throws std::runtime_error @p closure is neither @c EpsilonClosureOpt::Before nor @c EpsilonClosureOpt::After.
+ */
+Nfa remove_epsilon(
+	const Nfa& aut, const utils::OrdVector<Symbol>& epsilons, EpsilonClosureOpt closure = EpsilonClosureOpt::Before
+);
+
 /** Encodes a vector of strings (each corresponding to one symbol) into a
  *  @c Word instance
  */
@@ -1225,6 +1406,16 @@ template <> struct hash<mata::nfa::Transition> {
 	}
 };
 
+/**
+ * @brief A structural hasher for NFAs.
+ *
+ * Hashes the number of states, the transitions and the (sorted) initial and final states, so that automata with the
+ *  same number of states identical according to @c Nfa::is_identical() have the same hash.
+ */
+template <> struct hash<mata::nfa::Nfa> {
+	size_t operator()(const mata::nfa::Nfa& nfa) const noexcept;
+};
+
 std::ostream& operator<<(std::ostream& os, const mata::nfa::Transition& trans);
 std::ostream& operator<<(std::ostream& os, const mata::nfa::Nfa& nfa);
 } // namespace std.
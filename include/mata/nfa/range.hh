@@ -0,0 +1,129 @@
+/** @file
+ * @brief NFAs with transitions labelled by ranges of symbols.
+ *
+ * An opt-in representation for automata over large alphabets, such as Unicode code points, where a single character
+ *  class of a regular expression stands for thousands of symbols. A transition is labelled by a closed interval of
+ *  symbols instead of a single symbol. The ranges of a state are kept sorted and pairwise disjoint; operations split
+ *  ranges only where the ranges of their operands disagree.
+ */
+
+#ifndef MATA_NFA_RANGE_HH_
+#define MATA_NFA_RANGE_HH_
+
+#include <compare>
+#include <vector>
+
+#include "nfa.hh"
+
+namespace mata::nfa {
+
+/// Closed interval [@c lo, @c hi] of symbols.
+struct SymbolRange {
+	Symbol lo;
+	Symbol hi;
+
+	bool contains(const Symbol symbol) const { return lo <= symbol && symbol <= hi; }
+	/// Number of symbols in the range.
+	size_t size() const { return static_cast<size_t>(hi) - lo + 1; }
+
+	auto operator<=>(const SymbolRange&) const = default;
+};
+
+/// Transitions from a state over a range of symbols to a set of target states.
+struct RangePost {
+	SymbolRange range;
+	StateSet targets;
+
+	RangePost(const SymbolRange range, StateSet targets) : range{range}, targets{std::move(targets)} {}
+
+	bool operator==(const RangePost&) const = default;
+};
+
+/// Range posts of a single state.
+using RangeStatePost = std::vector<RangePost>;
+
+/**
+ * @brief NFA with transitions labelled by ranges of symbols.
+ *
+ * After @c normalize(), the range posts of each state are sorted by their ranges, the ranges are pairwise disjoint,
+ *  and adjacent ranges lead to different sets of targets. All operations below return normalized automata and expect
+ *  normalized operands.
+ */
+class RangeNfa {
+  public:
+	/// Range posts of the states, indexed by states.
+	std::vector<RangeStatePost> posts{};
+	utils::SparseSet<State> initial{};
+	utils::SparseSet<State> final{};
+
+	RangeNfa() = default;
+	explicit RangeNfa(const size_t num_of_states) : posts(num_of_states) {}
+
+	/// Number of states (including states without transitions referenced only as initial or final states).
+	size_t num_of_states() const;
+	/// Number of range posts.
+	size_t num_of_range_posts() const;
+
+	/**
+	 * @brief Add transitions from @p source over @p range to @p target.
+	 *
+	 * The range posts of @p source are not kept normalized, call @c normalize() after adding all transitions.
+	 */
+	void add(State source, SymbolRange range, State target);
+
+	/**
+	 * @brief Split overlapping ranges of each state at their boundaries, unite the targets of the overlapping parts and
+	 *  merge adjacent ranges with the same targets.
+	 */
+	RangeNfa& normalize();
+
+	/// Whether @p word is accepted.
+	bool is_in_lang(const Run& word) const;
+
+	/**
+	 * @brief Create a range NFA from @p nfa, merging transitions over consecutive symbols to the same targets.
+	 */
+	static RangeNfa from_nfa(const Nfa& nfa);
+
+	/**
+	 * @brief Expand the ranges into transitions over the individual symbols.
+	 *
+	 * The size of the result is proportional to the number of symbols in the ranges.
+	 */
+	Nfa to_nfa() const;
+};
+
+/**
+ * @brief Decode an automaton over bytes of the UTF-8 encoding into a range automaton over Unicode code points.
+ *
+ * The counterpart of @c Nfa::decode_utf8() which does not enumerate code points. The continuation bytes of a sequence
+ *  leading to the same targets are decoded together into a single range of code points. States of @p aut are kept,
+ *  states inside multi-byte sequences have no transitions in the result. Invalid (overlong or out of range) sequences
+ *  are skipped.
+ *
+ * @param[in] aut Automaton over bytes (symbols 0 to 255).
+ * @return Normalized range automaton over Unicode code points.
+ */
+RangeNfa decode_utf8_ranges(const Nfa& aut);
+
+/**
+ * @brief Compute the intersection (the product) of two range automata.
+ *
+ * Ranges are intersected pairwise, so the result distinguishes only the boundaries of the ranges of both operands.
+ *  Only the states reachable from the initial states are constructed.
+ */
+RangeNfa intersection(const RangeNfa& lhs, const RangeNfa& rhs);
+
+/**
+ * @brief Determinize a range automaton by the subset construction.
+ *
+ * The ranges of a macrostate are split at the boundaries of the ranges of its states.
+ *
+ * @param[in] aut Automaton to determinize.
+ * @param[out] subset_map Map assigning to subsets of states of @p aut the states of the result.
+ */
+RangeNfa determinize(const RangeNfa& aut, std::unordered_map<StateSet, State>* subset_map = nullptr);
+
+} // namespace mata::nfa
+
+#endif // MATA_NFA_RANGE_HH_
@@ -0,0 +1,112 @@
+/** @file
+ * @brief Cache of results of expensive NFA operations.
+ */
+
+#ifndef MATA_NFA_RESULT_CACHE_HH_
+#define MATA_NFA_RESULT_CACHE_HH_
+
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+
+#include "nfa.hh"
+
+namespace mata::nfa {
+
+/**
+ * @brief Memoization of @c determinize(), @c minimize(), @c reduce() and @c complement().
+ *
+ * The member functions compute the same results as the corresponding functions in @c mata::nfa, but return the
+ *  cached result when called again with a structurally identical automaton (see @c Nfa::is_identical()) with the same
+ *  number of states and the same parameters. Entries are looked up by the structural hash of the automaton (see
+ *  @c std::hash<Nfa>) combined with the operation and its parameters; hash collisions are resolved by comparing the
+ *  automata.
+ *
+ * The cache keeps at most @c max_num_of_entries entries in memory and evicts the least recently used ones. If a cache
+ *  directory is given, the entries are also stored there in the binary format (see @c mata::parser::write_binary())
+ *  and looked up when they are not in memory, so that the results survive across runs. The files are named by the
+ *  FNV-1a hash of the operation and the serialized automaton, which is stable across builds. Storing an entry is
+ *  best-effort: if the file cannot be written, the entry is kept only in memory.
+ *
+ * The cache can be shared between threads. The results are computed outside the lock, so two threads may compute
+ *  the same result at the same time.
+ */
+class ResultCache {
+  public:
+	/// Numbers of cache hits and misses.
+	struct Statistics {
+		size_t hits{0}; ///< Results found in memory.
+		size_t disk_hits{0}; ///< Results found in the cache directory.
+		size_t misses{0}; ///< Results computed.
+		size_t evictions{0}; ///< Entries evicted from memory.
+	};
+
+	/**
+	 * @brief Create an empty cache.
+	 *
+	 * @param[in] max_num_of_entries Maximal number of entries kept in memory.
+	 * @param[in] directory Directory to store the entries in. Created if it does not exist. If @c std::nullopt, the
+	 *  entries are kept only in memory.
+	 */
+	explicit ResultCache(
+		size_t max_num_of_entries = 1024, std::optional<std::filesystem::path> directory = std::nullopt
+	);
+
+	/// Cached @c mata::nfa::determinize().
+	Nfa determinize(const Nfa& aut);
+	/// Cached @c mata::nfa::minimize().
+	Nfa minimize(const Nfa& aut, const ParameterMap& params = {{"algorithm", "brzozowski"}});
+	/// Cached @c mata::nfa::reduce() (without the state renaming).
+	Nfa reduce(
+		const Nfa& aut,
+		const ParameterMap& params = {{"algorithm", "simulation"}, {"type", "after"}, {"direction", "forward"}}
+	);
+	/// Cached @c mata::nfa::complement().
+	Nfa complement(
+		const Nfa& aut, const utils::OrdVector<Symbol>& symbols,
+		const ParameterMap& params = {{"algorithm", "classical"}}
+	);
+	/// Cached @c mata::nfa::complement().
+	Nfa complement(const Nfa& aut, const Alphabet& alphabet, const ParameterMap& params = {{"algorithm", "classical"}});
+
+	/// Get numbers of cache hits and misses.
+	Statistics get_statistics() const;
+	/// Get the number of entries in memory.
+	size_t num_of_entries() const;
+	/// Remove all entries from memory (keeps the statistics and the cache directory).
+	void clear();
+
+  private:
+	struct Entry {
+		size_t hash;
+		std::string key;
+		Nfa input;
+		Nfa result;
+	};
+
+	/**
+	 * @brief Get the result of the operation described by @p key for @p aut, computing it by @p compute on a miss.
+	 */
+	Nfa get_or_compute(const std::string& key, const Nfa& aut, const std::function<Nfa()>& compute);
+	std::optional<Nfa> find_in_memory(size_t hash, const std::string& key, const Nfa& aut);
+	/// Find the entry for @p aut serialized to @p input_binary in the cache directory.
+	std::optional<Nfa> find_on_disk(const std::string& key, const Nfa& aut, const std::string& input_binary) const;
+	void insert_in_memory(size_t hash, const std::string& key, const Nfa& aut, const Nfa& result);
+	/// Store the entry in the cache directory if possible; failures to write are ignored.
+	void store_on_disk(const std::string& key, const std::string& input_binary, const Nfa& result) const;
+	std::filesystem::path entry_path(uint64_t hash) const;
+
+	size_t max_num_of_entries_;
+	std::optional<std::filesystem::path> directory_;
+	mutable std::mutex mutex_{};
+	Statistics statistics_{};
+	/// Entries from the most recently used.
+	std::list<Entry> entries_{};
+	std::unordered_map<size_t, std::vector<std::list<Entry>::iterator>> index_{};
+};
+
+} // namespace mata::nfa
+
+#endif // MATA_NFA_RESULT_CACHE_HH_
@@ -5,6 +5,8 @@
 #ifndef MATA_NFT_INTERNALS_HH_
 #define MATA_NFT_INTERNALS_HH_
 
+#include <optional>
+
 #include "mata/simlib/util/binary_relation.hh"
 #include "nft.hh"
 
@@ -70,10 +72,16 @@ bool is_included_naive(
 
 /**
  * Inclusion implemented by antichain algorithms.
+ *
+ * Works directly on jump transitions and @c DONT_CARE symbols, without unwinding them (see @c Nft::unwind_jumps()): the
+ *  product explores positions inside jump transitions, and a @c DONT_CARE step of @p smaller is explored once for each
+ *  symbol on the corresponding steps of @p bigger and once for a representative of the remaining symbols.
  * @param[in] smaller Automaton which language should be included in the bigger one
  * @param[in] bigger Automaton which language should include the smaller one
- * @param[in] alphabet Alphabet of both automata (not needed for antichain algorithm)
- * @param[out] cex A potential counterexample word which breaks inclusion
+ * @param[in] alphabet Alphabet of both automata, the symbols @c DONT_CARE stands for (computed from the transitions
+ *  when @c nullptr)
+ * @param[out] cex A potential counterexample word which breaks inclusion. The path consists of the states of
+ *  @p smaller visited by the word (positions inside jump transitions are omitted).
  * @param[out] jump_mode Specifies if the symbol on a jump transition (a transition with a length greater than 1)
  *  is interpreted as a sequence repeating the same symbol or as a single instance of the symbol followed by a sequence
  *  of @c DONT_CARE.
@@ -88,6 +96,49 @@ bool is_included_antichains(
 	JumpMode jump_mode = JumpMode::RepeatSymbol
 );
 
+/**
+ * @brief Steps between the positions of a transducer, without unwinding its jump transitions.
+ *
+ * Mirrors the semantics of @c Nft::unwind_jumps(): a transition over @c n levels reads @c n symbols (the same symbol,
+ *  or the symbol followed by @c DONT_CARE symbols), and @c DONT_CARE stands for any symbol of the alphabet, unless the
+ *  alphabet is just @c DONT_CARE itself. Transducers without levels defined for all states are read as NFAs.
+ */
+class JumpSteps {
+  public:
+	/**
+	 * @brief Position in a transducer: a state, or a point inside a jump transition.
+	 *
+	 * The position is @c remaining symbols before reaching @c state, and each of the remaining symbols is @c symbol.
+	 */
+	struct Position {
+		State state;
+		Level remaining;
+		Symbol symbol;
+
+		auto operator<=>(const Position&) const = default;
+	};
+
+	/// Label of a step: a symbol, or @c std::nullopt for a @c DONT_CARE matching any symbol of the alphabet.
+	using Label = std::optional<Symbol>;
+
+	JumpSteps(const Nft& nft, const utils::OrdVector<Symbol>& symbols, JumpMode jump_mode);
+
+	/// Append the steps (each reading a single symbol) from @p position to @p steps.
+	void append_steps(const Position& position, std::vector<std::pair<Label, Position>>& steps) const;
+	/// Whether @p position is a final state.
+	bool is_final(const Position& position) const;
+
+  private:
+	Label label(Symbol symbol) const;
+	Level jump_length(State source, State target) const;
+
+	const Nft& nft_;
+	const JumpMode jump_mode_;
+	/// Whether the levels are defined for all states.
+	const bool has_levels_;
+	const bool dont_care_is_literal_;
+};
+
 /**
  * Universality check implemented by checking emptiness of complemented automaton
  * @param[in] aut Automaton which universality is checked
@@ -106,6 +157,24 @@ bool is_universal_naive(const Nft& aut, const Alphabet& alphabet, Run* cex);
  */
 bool is_universal_antichains(const Nft& aut, const Alphabet& alphabet, Run* cex);
 
+/**
+ * Level-aware universality checking: whether the automaton accepts all words whose length is a multiple of the number
+ *  of levels.
+ *
+ * Checks inclusion of the universal transducer (a @c DONT_CARE loop over all levels) by @c is_included_antichains(),
+ *  hence jump transitions and @c DONT_CARE symbols are handled without unwinding and completing the automaton.
+ * @param[in] aut Automaton which universality is checked
+ * @param[in] alphabet Alphabet of the automaton
+ * @param[out] cex Counterexample word which eventually breaks the universality
+ * @param[in] jump_mode Specifies if the symbol on a jump transition (a transition with a length greater than 1)
+ *  is interpreted as a sequence repeating the same symbol or as a single instance of the symbol followed by a sequence
+ *  of @c DONT_CARE.
+ * @return True if the automaton is universal, otherwise false.
+ */
+bool is_universal_levels(
+	const Nft& aut, const Alphabet& alphabet, Run* cex = nullptr, JumpMode jump_mode = JumpMode::RepeatSymbol
+);
+
 Simlib::Util::BinaryRelation compute_relation(
 	const Nft& aut, const ParameterMap& params = {{"relation", "simulation"}, {"direction", "forward"}}
 );
@@ -138,6 +138,31 @@ Nft from_nfa_with_levels_zero(
  */
 Nft from_nfa_with_levels_advancing(nfa::Nfa nfa, size_t num_of_levels);
 
+/**
+ * @brief Create a random NFT in the style of the Tabakov-Vardi random NFAs.
+ *
+ * State s has the level s % num_of_levels. For each level l and each symbol, the states on level l get
+ *  round(n_l * states_transitions_ratio_per_symbol) distinct transitions to the states on the next level (l + 1) %
+ *  num_of_levels chosen uniformly at random, where n_l is the number of states on level l. State 0 is initial and
+ *  final, the other final states are chosen from the states on level 0.
+ *
+ * @param num_of_states Number of states, at least @p num_of_levels (or 0 for the empty NFT).
+ * @param num_of_levels Number of levels.
+ * @param alphabet_size Size of the alphabet {0, ..., alphabet_size - 1}.
+ * @param states_transitions_ratio_per_symbol Ratio between the number of transitions over a symbol from a level and
+ *  the number of states on the level. The value must be in range [0, num_of_states / num_of_levels].
+ * @param final_state_density Density of the final states among the states on level 0, in range [0, 1].
+ * @param seed Seed for the PRNG used. If no seed is given, the algorithm chooses one uniformly at random.
+ */
+Nft create_random_nft_tabakov_vardi(
+	size_t num_of_states,
+	size_t num_of_levels,
+	size_t alphabet_size,
+	double states_transitions_ratio_per_symbol,
+	double final_state_density,
+	const std::optional<unsigned int>& seed = std::nullopt
+);
+
 } // namespace mata::nft::builder.
 
 #endif
@@ -0,0 +1,63 @@
+/** @file
+ * @brief Complement of NFTs represented by implicitly complete deterministic transducers.
+ *
+ * @c complement() determinizes the transducer and makes it complete over all symbols at every level. The
+ *  representation here reads a single level per transition, keeps a transition over @c DONT_CARE for the symbols
+ *  which the transducer does not distinguish, and lets the remaining missing transitions lead to an implicit sink,
+ *  so that no transitions over all symbols are created for the levels.
+ */
+
+#ifndef MATA_NFT_COMPLEMENT_HH_
+#define MATA_NFT_COMPLEMENT_HH_
+
+#include "nft.hh"
+
+namespace mata::nft {
+
+/**
+ * @brief Complement of an NFT as a partial deterministic transducer with an implicit sink.
+ *
+ * Every transition of @c dft reads a single level. A transition over @c DONT_CARE is taken for the symbols from
+ *  @c symbols without an explicit transition from its source state. A symbol from @c symbols without a transition
+ *  (not even over @c DONT_CARE) leads to an implicit sink accepting all continuations up to the next level 0. The
+ *  language consists of the words over @c symbols whose length is a multiple of the number of levels.
+ */
+class ImplicitComplement {
+  public:
+	/// Deterministic transducer without the sink states.
+	Nft dft;
+	/// Symbols the complement is computed over.
+	utils::OrdVector<Symbol> symbols;
+
+	/// Whether the word of @p run is in the language.
+	bool is_in_lang(const Run& run) const;
+
+	/**
+	 * @brief Check emptiness of the language.
+	 *
+	 * @param[out] cex Word from the language if it is not empty. The path consists of the states of @c dft read
+	 *  before the word enters the implicit sink.
+	 */
+	bool is_lang_empty(Run* cex = nullptr) const;
+
+	/// Create the complete deterministic transducer over @c symbols, with the sink states materialized.
+	Nft to_nft() const;
+};
+
+/**
+ * @brief Compute the complement of @p nft over @p symbols as an implicitly complete deterministic transducer.
+ *
+ * The macrostates are sets of positions in the trimmed @p nft (states, or points inside jump transitions, see
+ *  @c algorithms::JumpSteps), constructed on the fly. Transitions over @c DONT_CARE are kept symbolic.
+ *
+ * @param[in] jump_mode Specifies if the symbol on a jump transition (a transition with a length greater than 1)
+ *  is interpreted as a sequence repeating the same symbol or as a single instance of the symbol followed by a sequence
+ *  of @c DONT_CARE symbols.
+ */
+ImplicitComplement complement_implicit(
+	const Nft& nft, const utils::OrdVector<Symbol>& symbols, JumpMode jump_mode = JumpMode::RepeatSymbol
+);
+
+} // namespace mata::nft
+
+#endif // MATA_NFT_COMPLEMENT_HH_
@@ -944,7 +944,13 @@ class Nft : public nfa::Nfa {
 		return post(StateSet{state}, words, word_levels, visited_zero_level_states, epsilon_closure_after, jump_mode);
 	}
 
-	/// Is the language of the automaton universal?
+	/**
+	 * @brief Is the language of the automaton universal?
+	 *
+	 * @param[in] params Parameters to control the universality check:
+	 * - "algorithm": "antichains" (the transitions are read as single symbols, as in an NFA), or "levels" (all words
+	 *   with a length divisible by the number of levels, see @c algorithms::is_universal_levels()).
+	 */
 	bool is_universal(
 		const Alphabet& alphabet, Run* cex = nullptr, const ParameterMap& params = {{"algorithm", "antichains"}}
 	) const;
@@ -1138,6 +1144,7 @@ class Nft : public nfa::Nfa {
 	 * If you have an automaton with finite language (can be checked using @ref is_acyclic),
 	 * you can get all words by calling
 	 *      aut.get_words(aut.num_of_states())
+	 * To enumerate the words lazily (e.g., to stop after the first few words), use @c WordEnumerator.
 	 * @param max_length Maximum length of words to be returned. Default: "no limit"; will infinitely loop if the
 	 * language is infinite.
 	 * @param jump_mode Specifies how to interpret the jump transitions.
@@ -1282,6 +1289,58 @@ class Nft : public nfa::Nfa {
 	void assert_num_of_levels_match_(const Nft& nft) const;
 }; // class Nft.
 
+/**
+ * @brief Lazy enumerator of words in the language of an NFT in the length-lexicographic order.
+ *
+ * The jump transitions of the NFT are unwound according to @c jump_mode (keeping @c DONT_CARE symbols as they are)
+ *  and the words are enumerated by @c nfa::WordEnumerator over the unwound NFT. Consequently, each word is produced
+ *  exactly once and the length of the words is the number of symbols in the word (not the number of transitions, as
+ *  in @c Nft::get_words()).
+ */
+class WordEnumerator {
+  public:
+	/**
+	 * @brief Create a lazy enumerator of words in the language of @p nft.
+	 *
+	 * @param[in] nft NFT whose language to enumerate.
+	 * @param[in] max_length Maximal length of enumerated words.
+	 * @param[in] max_num_of_words Maximal number of words to enumerate.
+	 * @param[in] jump_mode Specifies how to interpret the jump transitions.
+	 * @throws std::runtime_error If @p jump_mode is @c JumpMode::NoJump and @p nft contains jump transitions.
+	 */
+	explicit WordEnumerator(
+		const Nft& nft,
+		size_t max_length = std::numeric_limits<size_t>::max(),
+		size_t max_num_of_words = std::numeric_limits<size_t>::max(),
+		JumpMode jump_mode = JumpMode::RepeatSymbol
+	);
+	WordEnumerator(const WordEnumerator&) = delete;
+	WordEnumerator(WordEnumerator&&) = delete;
+	WordEnumerator& operator=(const WordEnumerator&) = delete;
+	WordEnumerator& operator=(WordEnumerator&&) = delete;
+
+	/**
+	 * @brief Get the next word in the length-lexicographic order.
+	 *
+	 * @return The next accepted word, or @c std::nullopt if there are no more words (up to the specified limits).
+	 */
+	std::optional<Word> next() { return enumerator_.next(); }
+
+	/**
+	 * @brief Check whether the enumeration has finished (no more words will be returned).
+	 */
+	bool finished() const { return enumerator_.finished(); }
+
+	/**
+	 * @brief Get the number of words enumerated so far.
+	 */
+	size_t num_of_words() const { return enumerator_.num_of_words(); }
+
+  private:
+	Nft unwound_nft_; ///< NFT with unwound jump transitions, owned by the enumerator.
+	nfa::WordEnumerator enumerator_;
+}; // class WordEnumerator.
+
 // Allow variadic number of arguments of the same type.
 //
 // Using parameter pack and variadic arguments.
@@ -0,0 +1,98 @@
+/** @file
+ * @brief Binary format for NFAs and NFTs.
+ *
+ * The binary format stores the automaton in a compact form which can be loaded without any parsing: a fixed-size
+ *  header followed by arrays of 64-bit little-endian integers (initial and final states, the transition relation in
+ *  compressed sparse row format, levels of NFT states) and an optional table of symbol names of an alphabet.
+ *
+ * Layout (version 1, all numbers are unsigned little-endian integers):
+ *  - header: magic bytes "MATA-BIN" (8 B), version (4 B), kind (4 B: 0 = NFA, 1 = NFT), number of states,
+ *    number of initial states, number of final states, number of symbol posts, number of targets, number of levels
+ *    of an NFT (0 for an NFA), number of alphabet entries (8 B each),
+ *  - initial states, final states,
+ *  - offsets of the symbol posts of each state (number of states + 1 entries),
+ *  - symbols of the symbol posts, offsets of the targets of each symbol post (number of symbol posts + 1 entries),
+ *  - targets,
+ *  - levels of states (NFT only),
+ *  - alphabet entries: symbol, length of the symbol name, symbol name (not padded), for each entry.
+ */
+
+#ifndef MATA_PARSER_BINARY_HH_
+#define MATA_PARSER_BINARY_HH_
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <span>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/nft/nft.hh"
+
+namespace mata::parser {
+
+/// Magic bytes at the beginning of the binary format.
+constexpr std::string_view BINARY_FORMAT_MAGIC{"MATA-BIN"};
+/// Current version of the binary format.
+constexpr uint32_t BINARY_FORMAT_VERSION{1};
+
+/**
+ * @brief Write @p nfa to @p output in the binary format.
+ *
+ * @param[in] nfa NFA to write.
+ * @param[out] output Output stream (opened in binary mode) to write to.
+ * @param[in] alphabet If specified, the symbol names of @p alphabet are stored together with the automaton.
+ */
+void write_binary(const nfa::Nfa& nfa, std::ostream& output, const OnTheFlyAlphabet* alphabet = nullptr);
+/// Write @p nfa to the file @p file in the binary format.
+void write_binary(const nfa::Nfa& nfa, const std::filesystem::path& file, const OnTheFlyAlphabet* alphabet = nullptr);
+
+/**
+ * @brief Write @p nft to @p output in the binary format.
+ *
+ * @param[in] nft NFT to write.
+ * @param[out] output Output stream (opened in binary mode) to write to.
+ * @param[in] alphabet If specified, the symbol names of @p alphabet are stored together with the automaton.
+ */
+void write_binary(const nft::Nft& nft, std::ostream& output, const OnTheFlyAlphabet* alphabet = nullptr);
+/// Write @p nft to the file @p file in the binary format.
+void write_binary(const nft::Nft& nft, const std::filesystem::path& file, const OnTheFlyAlphabet* alphabet = nullptr);
+
+/**
+ * @brief Read an NFA in the binary format from @p data.
+ *
+ * @param[in] data Binary representation of the NFA.
+ * @param[out] alphabet If specified, the stored symbol names are added to @p alphabet.
+ * @throws std::runtime_error @p data do not contain a valid NFA in the binary format.
+ */
+nfa::Nfa read_nfa_binary(std::span<const std::byte> data, OnTheFlyAlphabet* alphabet = nullptr);
+/// Read an NFA in the binary format from @p input.
+nfa::Nfa read_nfa_binary(std::istream& input, OnTheFlyAlphabet* alphabet = nullptr);
+/**
+ * @brief Read an NFA in the binary format from the file @p file.
+ *
+ * Where supported, the file is memory-mapped and the automaton is constructed directly from the mapped memory.
+ * @throws std::runtime_error @p file cannot be read or does not contain a valid NFA in the binary format.
+ */
+nfa::Nfa read_nfa_binary(const std::filesystem::path& file, OnTheFlyAlphabet* alphabet = nullptr);
+
+/**
+ * @brief Read an NFT in the binary format from @p data.
+ *
+ * @param[in] data Binary representation of the NFT.
+ * @param[out] alphabet If specified, the stored symbol names are added to @p alphabet.
+ * @throws std::runtime_error @p data do not contain a valid NFT in the binary format.
+ */
+nft::Nft read_nft_binary(std::span<const std::byte> data, OnTheFlyAlphabet* alphabet = nullptr);
+/// Read an NFT in the binary format from @p input.
+nft::Nft read_nft_binary(std::istream& input, OnTheFlyAlphabet* alphabet = nullptr);
+/**
+ * @brief Read an NFT in the binary format from the file @p file.
+ *
+ * Where supported, the file is memory-mapped and the automaton is constructed directly from the mapped memory.
+ * @throws std::runtime_error @p file cannot be read or does not contain a valid NFT in the binary format.
+ */
+nft::Nft read_nft_binary(const std::filesystem::path& file, OnTheFlyAlphabet* alphabet = nullptr);
+
+} // namespace mata::parser.
+
+#endif // MATA_PARSER_BINARY_HH_
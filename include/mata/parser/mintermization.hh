@@ -36,19 +36,65 @@ class Mintermization {
 	std::unordered_map<const FormulaGraph*, BDD> trans_to_bddvar_{};
 	std::unordered_map<const FormulaNode*, std::vector<DisjunctStatesPair>> lhs_to_disjuncts_and_states_{};
 	std::unordered_set<BDD> bdds_{}; // bdds created from transitions
+	std::vector<BDD> minterms_{}; // minterms of the incremental mintermization
+	std::vector<size_t> minterm_parents_{}; // minterms the minterms were split from (itself for the first minterm)
+	std::unordered_set<BDD> refined_predicates_{}; // bdds (and their negations) the minterms are refined by
 
 	void trans_to_bdd_nfa(const IntermediateAut& aut);
 	void trans_to_bdd_afa(const IntermediateAut& aut);
 
+	/**
+	 * Create BDD variables for @p symbol_names, the i-th name with the variable index i, so that the same symbol is
+	 * represented by the same variable in managers of different instances.
+	 */
+	void create_bdd_vars(const std::vector<std::string>& symbol_names);
+	/// Mintermize @p aut into an empty automaton @p res with a sequence of @p minterms numbered by their positions.
+	void minterms_to_aut(IntermediateAut& res, const IntermediateAut& aut, const std::vector<BDD>& minterms);
+
   public:
 	/**
-	 * Takes a set of BDDs and build a minterm tree over it.
-	 * The leaves of BDDs, which are minterms of input set, are returned
+	 * Takes a set of BDDs and computes the minterms of the input set by partition refinement.
+	 * Each BDD splits only those minterms which it neither contains nor is disjoint with. BDDs which are constant or
+	 * negations of already processed BDDs do not split any minterm and are skipped.
+	 * The minterms are not filtered by the supports of the BDDs: a non-constant BDD whose support is disjoint with the
+	 * support of a minterm always splits the minterm, so such a check could skip only the test of containment, never
+	 * the conjunctions computing the parts of the split minterm.
 	 * @param source_bdds BDDs for which minterms are computed
 	 * @return Computed minterms
 	 */
 	std::unordered_set<BDD> compute_minterms(const std::unordered_set<BDD>& source_bdds) const;
 
+	/**
+	 * Refine the minterms of the incremental mintermization by @p predicates.
+	 *
+	 * The minterms keep their positions: the part of a split minterm inside a predicate stays at the position of the
+	 * minterm, the part outside is appended. Predicates the minterms were already refined by are skipped.
+	 * @param predicates BDDs to refine the minterms by
+	 * @return Current minterms
+	 */
+	const std::vector<BDD>& refine_minterms(const std::unordered_set<BDD>& predicates);
+
+	/// Get the current minterms of the incremental mintermization.
+	const std::vector<BDD>& get_minterms() const { return minterms_; }
+
+	/**
+	 * For each current minterm, get the position of the minterm among the first @p num_of_minterms minterms it was
+	 * split from. Automata mintermized when there were @p num_of_minterms minterms are updated to the current minterms
+	 * by replacing each transition over minterm i by transitions over all current minterms j with result[j] == i.
+	 * @param num_of_minterms Number of minterms at the time of the earlier mintermization
+	 * @return Origins of the current minterms
+	 */
+	std::vector<size_t> get_minterm_origins(size_t num_of_minterms) const;
+
+	/**
+	 * Mintermize @p auts incrementally. The BDDs of the transitions of @p auts refine the minterms of the earlier
+	 * calls, and @p auts are mintermized over all current minterms, a minterm being represented by its position in
+	 * @c get_minterms(). Automata mintermized by the earlier calls can be updated with @c get_minterm_origins().
+	 * @param auts Automata to be mintermized.
+	 * @return Mintermized automata corresponding to the input automata
+	 */
+	std::vector<IntermediateAut> mintermize_incrementally(const std::vector<const IntermediateAut*>& auts);
+
 	/**
 	 * Transforms a graph representing formula at transition to bdd.
 	 * @param graph Graph to be transformed
@@ -84,6 +130,20 @@ class Mintermization {
 	std::vector<IntermediateAut> mintermize(const std::vector<const IntermediateAut*>& auts);
 	std::vector<IntermediateAut> mintermize(const std::vector<IntermediateAut>& auts);
 
+	/**
+	 * Methods mintermize given automata which have bitvector alphabet on @p num_of_threads threads.
+	 *
+	 * CUDD managers cannot be shared between threads. The automata are therefore split between the threads, each with
+	 * its own manager, where the BDDs of transitions and their minterms are computed. The minterms of all threads are
+	 * merged in the manager of this instance (as the non-empty intersections of the minterms of the threads) and
+	 * transferred back to the managers of the threads which then mintermize their automata.
+	 * @param auts Automata to be mintermized.
+	 * @param num_of_threads Number of threads. If 0, uses the number of hardware threads.
+	 * @return Mintermized automata corresponding to the input automata, sharing the same minterms.
+	 */
+	std::vector<IntermediateAut> mintermize(const std::vector<const IntermediateAut*>& auts, size_t num_of_threads);
+	std::vector<IntermediateAut> mintermize(const std::vector<IntermediateAut>& auts, size_t num_of_threads);
+
 	/**
 	 * The method performs the mintermization over @aut with given @minterms.
 	 * It is method specialized for NFA.
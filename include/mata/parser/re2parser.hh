@@ -8,6 +8,7 @@
 #include <string>
 
 #include "mata/nfa/nfa.hh"
+#include "mata/nfa/range.hh"
 
 // Encoding for the regular expression
 // FIXME: Use enum class re2::Regexp::ParseFlags from re2/regexp.h instead. It is not possible to include it here. Need
@@ -15,6 +16,17 @@
 enum class Encoding { Utf8 = 0, Latin1 = 1 << 5 };
 
 namespace mata::parser {
+
+/// Construction of the NFA from the parsed regular expression.
+enum class RegexConstruction {
+	/// Compile the regex into the RE2 program and remove its nop and capture states.
+	Prog,
+	/// Build the Glushkov (position) automaton directly from the parsed regex: for n symbol positions, the NFA has
+	///  n + 1 states and no epsilon transitions. In UTF8 encoding, the positions are bytes of the code points and only
+	///  valid UTF8 sequences are accepted (the RE2 program accepts also some invalid ones for large classes).
+	Glushkov,
+};
+
 /**
  * @brief Creates NFA from regular expression using RE2 parser
  *
@@ -36,6 +48,8 @@ namespace mata::parser {
  * @param epsilon_value symbol representing epsilon
  * @param use_reduce if set to true the result is trimmed and reduced using simulation reduction
  * @param encoding encoding of the regex, default is Latin1
+ * @param construction construction of the NFA; the Glushkov construction never creates epsilon transitions, so
+ *  @p use_epsilon and @p epsilon_value are ignored
  * @return Nfa corresponding to pattern
  */
 nfa::Nfa create_nfa(
@@ -43,7 +57,8 @@ nfa::Nfa create_nfa(
 	bool use_epsilon = false,
 	Symbol epsilon_value = 306,
 	bool use_reduce = true,
-	Encoding encoding = Encoding::Latin1
+	Encoding encoding = Encoding::Latin1,
+	RegexConstruction construction = RegexConstruction::Prog
 );
 
 // version for python binding
@@ -53,8 +68,23 @@ void create_nfa(
 	bool use_epsilon = false,
 	Symbol epsilon_value = 306,
 	bool use_reduce = true,
-	Encoding encoding = Encoding::Latin1
+	Encoding encoding = Encoding::Latin1,
+	RegexConstruction construction = RegexConstruction::Prog
 );
+/**
+ * @brief Creates NFA with transitions labelled by ranges of symbols from regular expression using RE2 parser
+ *
+ * For UTF8 encoding, the bytes of the UTF8 sequences are decoded into ranges of Unicode code points (see
+ *  @c mata::nfa::decode_utf8_ranges()), without enumerating the code points of character classes such as
+ *  @c \p{L}. For Latin1 encoding, consecutive bytes with the same targets are merged into ranges. The same
+ *  limitations as for @c create_nfa() apply.
+ *
+ * @param pattern regex as a string
+ * @param encoding encoding of the regex, default is UTF8
+ * @param use_reduce if set to true the automaton over bytes is trimmed and reduced using simulation reduction
+ * @return Range NFA corresponding to pattern
+ */
+nfa::RangeNfa create_range_nfa(const std::string& pattern, Encoding encoding = Encoding::Utf8, bool use_reduce = true);
 } // namespace mata::parser
 
 #endif // MATA_RE2PARSER_HH
@@ -0,0 +1,117 @@
+/** @file
+ * @brief Lazy matching of regular expressions based on Brzozowski derivatives.
+ */
+
+#ifndef MATA_REGEX_DERIVATIVES_HH
+#define MATA_REGEX_DERIVATIVES_HH
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/parser/re2parser.hh"
+
+namespace mata::parser {
+
+/**
+ * @brief Matcher of a regular expression which explores its deterministic automaton lazily.
+ *
+ * The regex is parsed by RE2 and translated into a term; the states of the automaton are the Brzozowski derivatives
+ *  of the term, created on demand. The terms are hash-consed and normalized (alternatives are flattened, sorted and
+ *  deduplicated), so that equal derivatives are the same state and each regex has finitely many derivatives. Nothing
+ *  is constructed for the parts of the regex which a word or an automaton never reaches.
+ *
+ * The symbols are the bytes (Latin1 encoding) or the Unicode code points (UTF8 encoding) of the regex, i.e., the
+ *  symbols of @c create_nfa() and of @c Nfa::decode_utf8(), respectively. Anchors and word boundaries are ignored,
+ *  as by @c create_nfa().
+ *
+ * The matcher is not thread-safe: the derivatives are created and cached during the queries.
+ *
+ * The store of the terms is bounded together with the cache of transitions: when the cache is full, it is cleared,
+ *  and the terms which are not subterms of the regex are released at the beginning of the next query (or in the
+ *  next step of @c is_in_lang()). The states obtained from @c initial_state() and @c next_state() hence stay valid
+ *  only until the next call of @c is_in_lang(), @c is_lang_empty(), @c is_intersection_empty() or
+ *  @c intersection().
+ */
+class DerivativeMatcher {
+  public:
+	/// State of the lazily constructed deterministic automaton.
+	using State = size_t;
+
+	/// Default maximal number of cached transitions between the states.
+	static constexpr size_t DEFAULT_MAX_CACHED_TRANSITIONS{1 << 16};
+
+	/**
+	 * @brief Parse @p pattern and create the matcher.
+	 *
+	 * @param pattern Regex in the RE2 syntax.
+	 * @param encoding Encoding of the regex.
+	 * @param max_cached_transitions Maximal number of cached transitions. When the cache is full, it is cleared, the
+	 *  unreachable terms are released at the next query, and the transitions are computed again from the
+	 *  (hash-consed) regex.
+	 * @throws std::runtime_error @p pattern is not a valid regex.
+	 */
+	explicit DerivativeMatcher(
+		const std::string& pattern,
+		Encoding encoding = Encoding::Latin1,
+		size_t max_cached_transitions = DEFAULT_MAX_CACHED_TRANSITIONS
+	);
+	DerivativeMatcher(DerivativeMatcher&& other) noexcept;
+	DerivativeMatcher& operator=(DerivativeMatcher&& other) noexcept;
+	~DerivativeMatcher();
+
+	/// Initial state: the regex itself.
+	State initial_state() const;
+	/// Derivative of @p state with respect to @p symbol.
+	State next_state(State state, Symbol symbol);
+	/// Whether @p state accepts the empty word.
+	bool is_final(State state) const;
+	/// Whether @p state accepts no word (is the empty regex). Words leading to such a state cannot be completed.
+	bool is_sink(State state) const;
+
+	/// Whether @p word is in the language of the regex.
+	bool is_in_lang(const Word& word);
+
+	/**
+	 * @brief Check emptiness of the language of the regex.
+	 *
+	 * The derivatives are explored for a single representative symbol of each class of symbols that the regex does
+	 *  not distinguish.
+	 *
+	 * @param[out] cex Counter-example word from the language if the language is not empty.
+	 */
+	bool is_lang_empty(nfa::Run* cex = nullptr);
+
+	/**
+	 * @brief Check emptiness of the intersection of the language of the regex and the language of @p nfa.
+	 *
+	 * Only the pairs of the derivatives and the states of @p nfa reachable over the transitions of @p nfa are explored,
+	 *  until an accepting pair is found.
+	 *
+	 * @param[in] nfa Automaton over the symbols of the regex.
+	 * @param[out] cex Word from the intersection if it is not empty.
+	 */
+	bool is_intersection_empty(const nfa::Nfa& nfa, nfa::Run* cex = nullptr);
+
+	/**
+	 * @brief Compute the intersection of the language of the regex and the language of @p nfa.
+	 *
+	 * @return Product of the derivatives and the states of @p nfa reachable from the initial states.
+	 */
+	nfa::Nfa intersection(const nfa::Nfa& nfa);
+
+	/// Number of the terms created so far (the states and their subterms).
+	size_t num_of_terms() const;
+	/// Number of the currently cached transitions.
+	size_t num_of_cached_transitions() const;
+
+  private:
+	class Terms;
+	std::unique_ptr<Terms> terms_;
+	State initial_state_;
+};
+
+} // namespace mata::parser
+
+#endif // MATA_REGEX_DERIVATIVES_HH
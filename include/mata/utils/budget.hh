@@ -0,0 +1,137 @@
+/** @file
+ * @brief Cancellation, time and memory budgets for the long-running operations of the library.
+ *
+ * A @c Budget is made active on the current thread by a @c BudgetScope. The worklist loops of the expensive
+ *  operations (determinization, products, composition of NFTs, and inclusion and universality checks) poll the active
+ *  budget and throw @c BudgetExhausted when it is cancelled or exceeded. Without an active budget, polling is a single
+ *  check of a thread-local pointer.
+ */
+
+#ifndef MATA_UTILS_BUDGET_HH_
+#define MATA_UTILS_BUDGET_HH_
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace mata::utils {
+
+/// Exception thrown by an operation when the active @c Budget is cancelled or exceeded.
+class BudgetExhausted : public std::runtime_error {
+  public:
+	enum class Reason {
+		Cancelled, ///< @c Budget::cancel() was called.
+		Deadline, ///< The deadline has passed.
+		States, ///< The operation created more states than allowed.
+		Memory, ///< The resident memory of the process exceeded the limit.
+	};
+
+	BudgetExhausted(Reason reason, const std::string& message) : std::runtime_error{message}, reason{reason} {}
+
+	Reason reason;
+};
+
+/**
+ * @brief Limits of the operations run while the budget is active, and a flag to cancel them.
+ *
+ * The limit on states applies to each operation separately: it bounds the number of states of the result (or the
+ *  number of macrostates in the antichain) the operation builds. The memory limit bounds the resident memory of the
+ *  whole process and is checked only on Linux. The deadline and memory are checked only on every
+ *  @c CHECK_PERIOD-th poll to keep polling cheap.
+ *
+ * The budget may be cancelled from any thread. It has to outlive the scopes it is active in.
+ */
+class Budget {
+  public:
+	/// Number of polls between the checks of the deadline and memory.
+	static constexpr size_t CHECK_PERIOD{256};
+
+	Budget() = default;
+	Budget(const Budget&) = delete;
+	Budget& operator=(const Budget&) = delete;
+
+	Budget& set_deadline(std::chrono::steady_clock::time_point deadline) {
+		deadline_ = deadline;
+		return *this;
+	}
+
+	/// Set the deadline to @p timeout from now.
+	Budget& set_timeout(std::chrono::steady_clock::duration timeout) {
+		return set_deadline(std::chrono::steady_clock::now() + timeout);
+	}
+
+	Budget& set_max_states(size_t max_states) {
+		max_states_ = max_states;
+		return *this;
+	}
+
+	/// Set the limit on the resident memory of the process in bytes.
+	Budget& set_max_memory(size_t max_memory) {
+		max_memory_ = max_memory;
+		return *this;
+	}
+
+	/// Make the operations using the budget throw @c BudgetExhausted at their next poll.
+	void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+	bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Check all the limits of the budget.
+	 *
+	 * @param num_of_states Number of states built by the checking operation so far.
+	 * @throws BudgetExhausted If the budget is cancelled or a limit is exceeded.
+	 */
+	void check(size_t num_of_states = 0) const;
+
+	/// Get the budget active on the current thread, or @c nullptr if there is none.
+	static Budget* get_active() { return active_; }
+
+	/**
+	 * @brief Poll the budget active on the current thread, if there is one.
+	 *
+	 * Checks the cancellation and the limit on states on each call, the deadline and memory periodically.
+	 * @param num_of_states Number of states built by the polling operation so far.
+	 * @throws BudgetExhausted If the active budget is cancelled or a limit is exceeded.
+	 */
+	static void poll(const size_t num_of_states = 0) {
+		if (active_ != nullptr) { active_->poll_active(num_of_states); }
+	}
+
+	/// Get the resident memory of the process in bytes, or 0 if it cannot be determined on this platform.
+	static size_t get_resident_memory();
+
+  private:
+	friend class BudgetScope;
+
+	void check_states_and_cancellation(size_t num_of_states) const;
+	void check_deadline_and_memory() const;
+	void poll_active(size_t num_of_states);
+
+	std::optional<std::chrono::steady_clock::time_point> deadline_{};
+	size_t max_states_{std::numeric_limits<size_t>::max()};
+	size_t max_memory_{std::numeric_limits<size_t>::max()};
+	std::atomic<bool> cancelled_{false};
+
+	inline static thread_local Budget* active_{nullptr};
+	inline static thread_local size_t num_of_polls_{0};
+};
+
+/// Make a budget active on the current thread for the lifetime of the scope. Scopes may be nested.
+class BudgetScope {
+  public:
+	explicit BudgetScope(Budget& budget) : previous_{Budget::active_} { Budget::active_ = &budget; }
+	~BudgetScope() { Budget::active_ = previous_; }
+
+	BudgetScope(const BudgetScope&) = delete;
+	BudgetScope& operator=(const BudgetScope&) = delete;
+
+  private:
+	Budget* previous_;
+};
+
+} // namespace mata::utils
+
+#endif // MATA_UTILS_BUDGET_HH_
@@ -206,19 +206,13 @@ template <class Key> class OrdVector {
 	}
 
 	virtual bool insert(const OrdVector& vec) {
-		static OrdVector tmp{};
 		assert(is_sorted());
 		assert(vec.is_sorted());
-		tmp.clear();
 
+		// A local (not static) union, so that concurrent unions into distinct vectors do not race.
+		OrdVector tmp{};
 		const auto inserted{set_union(*this, vec, tmp)};
-		vec_ = tmp.vec_;
-		/*
-		 * Swap, commented below (test do pass) may be better in some cases, such as uniting many vectors into one.
-		 * But it defeats the idea of having tmp vector shared between all the unions and allocated only once.
-		 * It would be good to try it with removing epsilon transitions or determinization.
-		 */
-		// std::swap(tmp.vec_,vec_);
+		vec_ = std::move(tmp.vec_);
 		assert(is_sorted());
 		return inserted;
 	}
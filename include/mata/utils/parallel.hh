@@ -0,0 +1,71 @@
+/** @file
+ * @brief Helpers for running independent tasks on multiple threads.
+ */
+
+#ifndef MATA_UTILS_PARALLEL_HH_
+#define MATA_UTILS_PARALLEL_HH_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "mata/utils/budget.hh"
+
+namespace mata::utils {
+
+/**
+ * @brief Get the number of threads to process @p num_of_tasks tasks with.
+ *
+ * @param num_of_threads Requested number of threads. If 0, uses the number of hardware threads.
+ * @return Number of threads between 1 and @p num_of_tasks (or 1 if there are no tasks).
+ */
+inline size_t get_num_of_threads(size_t num_of_threads, const size_t num_of_tasks) {
+	if (num_of_threads == 0) { num_of_threads = std::max(1U, std::thread::hardware_concurrency()); }
+	return std::max<size_t>(1, std::min(num_of_threads, num_of_tasks));
+}
+
+/**
+ * @brief Call @p task for each index in [0, @p count) on @p num_of_threads threads.
+ *
+ * The task gets the index of the calling thread and the index to process. If the task throws, the exception of the
+ *  failed thread with the lowest index is rethrown after all threads finish. The budget active on the calling thread
+ *  is active on the worker threads, too.
+ */
+inline void parallel_for(
+	const size_t count, const size_t num_of_threads, const std::function<void(size_t, size_t)>& task
+) {
+	std::atomic<size_t> next_index{0};
+	std::vector<std::exception_ptr> exceptions(num_of_threads);
+	Budget* const budget{Budget::get_active()};
+	auto worker = [&](const size_t thread_index) {
+		try {
+			std::optional<BudgetScope> budget_scope{};
+			if (budget != nullptr) { budget_scope.emplace(*budget); }
+			for (size_t index{next_index++}; index < count; index = next_index++) { task(thread_index, index); }
+		} catch (...) {
+			exceptions[thread_index] = std::current_exception();
+			next_index = count;
+		}
+	};
+	if (num_of_threads == 1) {
+		worker(0);
+	} else {
+		std::vector<std::thread> threads{};
+		threads.reserve(num_of_threads);
+		for (size_t thread_index{0}; thread_index < num_of_threads; ++thread_index) {
+			threads.emplace_back(worker, thread_index);
+		}
+		for (std::thread& thread : threads) { thread.join(); }
+	}
+	for (const std::exception_ptr& exception : exceptions) {
+		if (exception) { std::rethrow_exception(exception); }
+	}
+}
+
+} // namespace mata::utils
+
+#endif // MATA_UTILS_PARALLEL_HH_
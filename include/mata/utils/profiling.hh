@@ -0,0 +1,107 @@
+/** @file
+ * @brief Operation-level profiling of the expensive operations of the library.
+ *
+ * Instrumented operations (determinization, products, inclusion and universality checks, reduction, minimization,
+ *  composition of NFTs, and noodlification) create an @c OperationProfile for each call. When the @c Profiler is
+ *  enabled at run time, the statistics of each finished call are passed to a callback or stored to be exported as
+ *  JSON. When disabled (the default), a call only checks a flag and increments a few local counters. Counting heap
+ *  allocations replaces the global operator new, hence it has to be enabled at compile time by the CMake option
+ *  @c MATA_PROFILE_ALLOCATIONS.
+ */
+
+#ifndef MATA_UTILS_PROFILING_HH_
+#define MATA_UTILS_PROFILING_HH_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace mata::utils {
+
+/// Statistics of a single call of an instrumented operation.
+struct OperationStatistics {
+	std::string operation{}; ///< Name of the operation, such as "nfa::determinize".
+	size_t depth{0}; ///< Number of instrumented calls on the same thread the call is nested in.
+	std::chrono::nanoseconds wall_time{}; ///< Wall time of the call.
+	size_t states_created{0}; ///< Number of states created in the result (macrostates, product states, ...).
+	size_t macrostates_explored{0}; ///< Number of (macro)states taken from the worklist and explored.
+	size_t antichain_prunes{0}; ///< Number of (macro)states discarded or removed as subsumed in an antichain.
+	size_t product_pairs{0}; ///< Number of pairs of states created in a product.
+	size_t allocations{0}; ///< Number of heap allocations, if counted (see @c Profiler::counts_allocations()).
+};
+
+/**
+ * @brief Global switch and sink for the statistics of the instrumented operations.
+ *
+ * All functions are thread-safe.
+ */
+class Profiler {
+  public:
+	using Callback = std::function<void(const OperationStatistics&)>;
+
+	/// Enable or disable recording of the statistics of the instrumented operations.
+	static void enable(bool enabled = true) { enabled_.store(enabled, std::memory_order_relaxed); }
+	static bool is_enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Set @p callback to be called with the statistics of each finished call, instead of storing them.
+	 *
+	 * The calls of the callback are serialized. An empty callback makes the profiler store the statistics again.
+	 */
+	static void set_callback(Callback callback);
+
+	/// Whether heap allocations are counted (the library was built with @c MATA_PROFILE_ALLOCATIONS).
+	static bool counts_allocations();
+
+	/// Get the statistics stored so far, in the order in which the calls finished.
+	static std::vector<OperationStatistics> get_records();
+
+	/// Remove the stored statistics.
+	static void clear();
+
+	/**
+	 * @brief Write the stored statistics to @p output as JSON.
+	 *
+	 * The object has the list of the calls under "operations" and their totals grouped by the operation under
+	 *  "summary". Nested calls are included in the totals of the calls they are nested in, too.
+	 */
+	static void write_json(std::ostream& output);
+
+	/// Record @p statistics of a finished call.
+	static void record(OperationStatistics statistics);
+
+  private:
+	inline static std::atomic<bool> enabled_{false};
+};
+
+/**
+ * @brief Instrumentation of a single call of an operation.
+ *
+ * The operation increments the counters in @c statistics. The statistics are recorded when the profile is destroyed,
+ *  if the profiler was enabled when the profile was created.
+ */
+class OperationProfile {
+  public:
+	/// @param operation Name of the operation. It has to outlive the profile.
+	explicit OperationProfile(const char* operation);
+	~OperationProfile();
+
+	OperationProfile(const OperationProfile&) = delete;
+	OperationProfile& operator=(const OperationProfile&) = delete;
+
+	/// Counters of the call. The name, depth, wall time, and allocations are filled in when recorded.
+	OperationStatistics statistics{};
+
+  private:
+	const char* operation_;
+	bool enabled_;
+	std::chrono::steady_clock::time_point start_{};
+	size_t allocations_at_start_{0};
+};
+
+} // namespace mata::utils
+
+#endif // MATA_UTILS_PROFILING_HH_
@@ -6,8 +6,14 @@
 #ifndef MATA_UTILS_TWO_DIMENSIONAL_MAP_HH
 #define MATA_UTILS_TWO_DIMENSIONAL_MAP_HH
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace mata::utils {
 
@@ -119,6 +125,97 @@ template <typename T, bool TrackInverted = true, size_t MaxMatrixSize = 50'000'0
 	InvertedStorage second_dim_inverted_{};
 };
 
+/**
+ * @brief A thread-safe variant of @c TwoDimensionalMap for building a map of pairs on multiple threads.
+ *
+ * Small maps are stored as a matrix of atomic values, read without locking. Large maps are stored as hash maps. Writes
+ *  (and reads of large maps) lock one of @p NumOfShards shards chosen by the pair, so that threads working with
+ *  different pairs rarely wait for each other. The map does not track inverted indices.
+ *
+ * @tparam T Type of the values stored in the map. Must be an unsigned type.
+ * @tparam MaxMatrixSize Maximum size of the matrix before switching to the hash maps.
+ * @tparam NumOfShards Number of independently locked shards.
+ */
+template <typename T, size_t MaxMatrixSize = 50'000'000, size_t NumOfShards = 64> class ConcurrentTwoDimensionalMap {
+	static_assert(std::is_unsigned_v<T>, "ConcurrentTwoDimensionalMap requires an unsigned type");
+
+  public:
+	/**
+	 * @brief Constructor for ConcurrentTwoDimensionalMap.
+	 * @param first_dim_size Size of the first dimension.
+	 * @param second_dim_size Size of the second dimension.
+	 */
+	ConcurrentTwoDimensionalMap(const size_t first_dim_size, const size_t second_dim_size)
+		: is_large_(first_dim_size * second_dim_size > MaxMatrixSize), second_dim_size_(second_dim_size) {
+		if (!is_large_) {
+			matrix_storage_ = std::vector<std::atomic<T>>(first_dim_size * second_dim_size);
+			for (std::atomic<T>& value : matrix_storage_) { value.store(std::numeric_limits<T>::max()); }
+		}
+	}
+
+	/**
+	 * @brief Get the value associated with a pair of keys.
+	 * @param first First key.
+	 * @param second Second key.
+	 * @return The value associated with the pair, or std::numeric_limits<T>::max() if not found.
+	 */
+	T get(const T first, const T second) const {
+		if (!is_large_) { return matrix_storage_[first * second_dim_size_ + second].load(std::memory_order_acquire); }
+
+		const Shard& shard{get_shard(first, second)};
+		const std::shared_lock lock{shard.mutex};
+		auto it = shard.map.find({first, second});
+		if (it == shard.map.end()) { return std::numeric_limits<T>::max(); }
+		return it->second;
+	}
+
+	/**
+	 * @brief Get the value associated with a pair of keys, or associate the pair with @p create() if it has no value.
+	 *
+	 * Only one of the threads inserting the same pair at the same time calls @p create().
+	 * @param first First key.
+	 * @param second Second key.
+	 * @param create Function returning the value for a new pair.
+	 * @return The value associated with the pair and whether it was inserted by this call.
+	 */
+	template <class Create> std::pair<T, bool> get_or_insert(const T first, const T second, Create create) {
+		if (const T value{get(first, second)}; value != std::numeric_limits<T>::max()) { return {value, false}; }
+
+		Shard& shard{get_shard(first, second)};
+		const std::unique_lock lock{shard.mutex};
+		if (!is_large_) {
+			std::atomic<T>& stored{matrix_storage_[first * second_dim_size_ + second]};
+			if (const T value{stored.load(std::memory_order_relaxed)}; value != std::numeric_limits<T>::max()) {
+				return {value, false};
+			}
+			const T value{create()};
+			stored.store(value, std::memory_order_release);
+			return {value, true};
+		}
+		auto [it, inserted] = shard.map.try_emplace({first, second}, std::numeric_limits<T>::max());
+		if (inserted) { it->second = create(); }
+		return {it->second, inserted};
+	}
+
+  private:
+	struct Shard {
+		mutable std::shared_mutex mutex{};
+		std::unordered_map<std::pair<T, T>, T> map{};
+	};
+
+	const Shard& get_shard(const T first, const T second) const {
+		return shards_[(first * second_dim_size_ + second) % NumOfShards];
+	}
+	Shard& get_shard(const T first, const T second) {
+		return shards_[(first * second_dim_size_ + second) % NumOfShards];
+	}
+
+	const bool is_large_;
+	const size_t second_dim_size_;
+	std::vector<std::atomic<T>> matrix_storage_{};
+	std::array<Shard, NumOfShards> shards_{};
+};
+
 } // namespace mata::utils
 
 #endif // MATA_UTILS_TWO_DIMENSIONAL_MAP_HH
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <random>
 #include <ranges>
 #include <set>
 #include <sstream>
@@ -222,6 +223,32 @@ template <class Tuple> struct TuplePrinter<Tuple, 1> {
 	static std::string print(const Tuple& t) { return std::to_string(std::get<0>(t)); }
 };
 
+/**
+ * @brief Choose @p count distinct numbers from [0, @p population) uniformly at random.
+ *
+ * Performs the first @p count steps of the Fisher-Yates shuffle of the sequence 0, ..., @p population - 1, storing only
+ *  the displaced entries. Hence, the time and memory are linear in @p count instead of @p population.
+ * @return The chosen numbers in the order in which they were chosen.
+ */
+template <class Generator>
+std::vector<size_t> sample_without_replacement(const size_t count, const size_t population, Generator& generator) {
+	assert(count <= population);
+	std::unordered_map<size_t, size_t> displaced{};
+	auto get = [&](const size_t index) {
+		const auto it{displaced.find(index)};
+		return it == displaced.end() ? index : it->second;
+	};
+	std::vector<size_t> sample{};
+	sample.reserve(count);
+	for (size_t i{0}; i < count; ++i) {
+		const size_t chosen{std::uniform_int_distribution<size_t>{i, population - 1}(generator)};
+		const size_t value{get(chosen)};
+		displaced[chosen] = get(i);
+		sample.push_back(value);
+	}
+	return sample;
+}
+
 // This reserves space in a vector, to be used before push_back or insert.
 // Assuming the doubling extension strategy, it only makes the first reserve large, after that it leaves it to the
 // doubling. Might be worth thinking about it.
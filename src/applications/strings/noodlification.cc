@@ -2,31 +2,23 @@
  * @brief nfa-noodlification.cc -- Noodlification of NFAs
  */
 
+#include <mutex>
+#include <random>
 #include <ranges>
 
 #include "mata/applications/strings.hh"
 #include "mata/nfa/algorithms.hh"
+#include "mata/nfa/builder.hh"
 #include "mata/nfa/nfa.hh"
 #include "mata/nft/algorithms.hh"
 #include "mata/nft/builder.hh"
+#include "mata/utils/parallel.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/utils.hh"
 
 using namespace mata::applications::strings;
 
 namespace {
-/**
- * Get a number of permutations for computed epsilon depths.
- * @param[in] epsilon_depths Computed list of epsilon transitions for each depth.
- * @return Number of permutations.
- */
-size_t get_num_of_permutations(const seg_nfa::Segmentation::EpsilonDepthTransitions& epsilon_depths) {
-	size_t num_of_permutations{1};
-	for (const auto& transitions_at_depth : epsilon_depths | std::views::values) {
-		num_of_permutations *= transitions_at_depth.size();
-	}
-	return num_of_permutations;
-}
-
 /**
  * @brief Unify (as best as possible) the initial states and the final states of NFAs in @p nfas
  *
@@ -88,124 +80,360 @@ bool is_nft_homomorphic(const std::shared_ptr<Nft>& nft) {
 
 	return true;
 }
+
+/**
+ * @brief Trim @p segment with only the given initial and final state.
+ *
+ * @param[in] segment Segment to trim.
+ * @param[in] init_state Initial state to keep, or @c std::nullopt to keep all initial states.
+ * @param[in] final_state Final state to keep, or @c std::nullopt to keep all final states.
+ */
+Nfa trim_segment(const Nfa& segment, const std::optional<State> init_state, const std::optional<State> final_state) {
+	mata::utils::SparseSet<State> initial{};
+	std::optional<std::reference_wrapper<const mata::utils::SparseSet<State>>> initial_states{};
+	if (init_state.has_value()) {
+		initial.insert(*init_state);
+		initial_states = initial;
+	}
+	mata::utils::SparseSet<State> final{};
+	std::optional<std::reference_wrapper<const mata::utils::SparseSet<State>>> final_states{};
+	if (final_state.has_value()) {
+		final.insert(*final_state);
+		final_states = final;
+	}
+	return trim(segment, nullptr, initial_states, final_states);
+}
+
+/// Describe the parameters of a noodlification of an equation for @c NoodlificationCache.
+std::string equation_cache_params(const std::string& function, const bool include_empty, const ParameterMap& params) {
+	std::string reduce_value{};
+	if (mata::utils::haskey(params, "reduce")) { reduce_value = params.at("reduce"); }
+	return function + ";include_empty=" + std::to_string(include_empty) + ";reduce=" + reduce_value;
+}
 } // namespace
 
-std::vector<seg_nfa::Noodle> seg_nfa::noodlify(const SegNfa& aut, const Symbol epsilon, const bool include_empty) {
-	const std::set<Symbol> epsilons({epsilon});
-	// return noodlify_reach(aut, epsilons, include_empty);
+std::vector<seg_nfa::Noodle> seg_nfa::noodlify(
+	const SegNfa& aut, const Symbol epsilon, const bool include_empty, NoodlificationCache* cache
+) {
+	const mata::utils::OperationProfile profile{"strings::noodlify"};
+	const std::string cache_params{
+		"noodlify;epsilon=" + std::to_string(epsilon) + ";include_empty=" + std::to_string(include_empty)
+	};
+	if (cache != nullptr) {
+		if (const std::vector<Noodle>* noodles{cache->find_noodles({&aut}, cache_params)}) { return *noodles; }
+	}
 
-	Segmentation segmentation{aut, epsilons};
+	std::vector<Noodle> noodles{};
+	NoodleGenerator generator{aut, epsilon, include_empty, cache};
+	while (std::optional<Noodle> noodle{generator.next()}) { noodles.push_back(std::move(*noodle)); }
+	if (cache != nullptr) { cache->insert_noodles({&aut}, cache_params, noodles); }
+	return noodles;
+}
+
+seg_nfa::NoodleGenerator::NoodleGenerator(
+	const SegNfa& aut, const Symbol epsilon, const bool include_empty, NoodlificationCache* cache
+)
+	: unused_state_{aut.num_of_states()} { // get some State not used in aut
+	Segmentation segmentation{aut, {epsilon}};
 	const auto& segments{segmentation.get_untrimmed_segments()};
 
 	if (segments.size() == 1) {
 		if (auto segment{std::make_shared<Nfa>(trim(segments[0]))}; segment->num_of_states() > 0 || include_empty) {
-			return {{segment}};
+			single_segment_noodle_ = Noodle{segment};
 		} else {
-			return {};
+			finished_ = true;
 		}
+		return;
 	}
 
-	State unused_state = aut.num_of_states(); // get some State not used in aut
-	std::map<std::pair<State, State>, std::shared_ptr<Nfa>> segments_one_initial_final;
-	segs_one_initial_final(segments, include_empty, unused_state, segments_one_initial_final);
+	segs_one_initial_final(segments, include_empty, unused_state_, segments_one_initial_final_, cache);
 
 	const auto& epsilon_depths{segmentation.get_epsilon_depths()};
+	const size_t num_of_depths{epsilon_depths.size()};
+	epsilon_depths_.reserve(num_of_depths);
+	for (size_t depth{0}; depth < num_of_depths; ++depth) { epsilon_depths_.push_back(epsilon_depths.at(depth)); }
+
+	// Pre-prune ε-transitions which cannot be a part of any noodle because they cannot be connected with the first
+	//  segment through some ε-transitions from the previous depths.
+	is_connected_to_first_segment_.reserve(num_of_depths);
+	for (size_t depth{0}; depth < num_of_depths; ++depth) {
+		const std::vector<Transition>& transitions{epsilon_depths_[depth]};
+		BoolVector& is_connected{is_connected_to_first_segment_.emplace_back(transitions.size(), false)};
+		for (size_t index{0}; index < transitions.size(); ++index) {
+			const State source{transitions[index].source};
+			if (depth == 0) {
+				is_connected[index] = get_segment(unused_state_, source) != nullptr;
+				continue;
+			}
+			const std::vector<Transition>& prev_transitions{epsilon_depths_[depth - 1]};
+			for (size_t prev_index{0}; prev_index < prev_transitions.size(); ++prev_index) {
+				if (is_connected_to_first_segment_[depth - 1][prev_index] &&
+					get_segment(prev_transitions[prev_index].target, source) != nullptr) {
+					is_connected[index] = true;
+					break;
+				}
+			}
+		}
+	}
 
-	// Compute number of all combinations of ε-transitions with one ε-transitions from each depth.
-	const size_t num_of_permutations{get_num_of_permutations(epsilon_depths)};
-	const size_t epsilon_depths_size{epsilon_depths.size()};
+	// The combinations are searched from the last depth to the first one, to generate the noodles in the same order
+	//  as the combinations enumerated by noodlify(), where the ε-transition in the first depth changes the fastest.
+	choices_.assign(num_of_depths, NO_CHOICE);
+	current_depth_ = num_of_depths - 1;
+}
 
-	std::vector<Noodle> noodles{};
-	// noodle of epsilon transitions (each from different depth)
-	std::vector<Transition> epsilon_noodle(epsilon_depths_size);
-	// for each combination of ε-transitions, create the automaton.
-	// based on https://stackoverflow.com/questions/48270565/create-all-possible-combinations-of-multiple-vectors
-	for (size_t index{0}; index < num_of_permutations; ++index) {
-		size_t temp{index};
-		for (size_t depth{0}; depth < epsilon_depths_size; ++depth) {
-			const size_t num_of_trans_at_cur_depth = epsilon_depths.at(depth).size();
-			const size_t computed_index = temp % num_of_trans_at_cur_depth;
-			temp /= num_of_trans_at_cur_depth;
-			epsilon_noodle[depth] = epsilon_depths.at(depth)[computed_index];
-		}
-
-		Noodle noodle;
-
-		// epsilon_noodle[0] for sure exists, as we sorted out the case of only one segment at the beginning
-		if (auto first_segment_iter{
-				segments_one_initial_final.find(std::make_pair(unused_state, epsilon_noodle[0].source))
-			};
-			first_segment_iter != segments_one_initial_final.end()) {
-			noodle.push_back(first_segment_iter->second);
-		} else {
+std::shared_ptr<Nfa> seg_nfa::NoodleGenerator::get_segment(const State init, const State final) const {
+	const auto segment_it{segments_one_initial_final_.find(std::make_pair(init, final))};
+	if (segment_it == segments_one_initial_final_.end()) { return nullptr; }
+	return segment_it->second;
+}
+
+bool seg_nfa::NoodleGenerator::is_connected_to_next_depth(const size_t depth, const size_t index) const {
+	const State target{epsilon_depths_[depth][index].target};
+	if (depth + 1 == epsilon_depths_.size()) { return get_segment(target, unused_state_) != nullptr; }
+	return get_segment(target, epsilon_depths_[depth + 1][choices_[depth + 1]].source) != nullptr;
+}
+
+std::optional<seg_nfa::Noodle> seg_nfa::NoodleGenerator::next() {
+	if (finished_) { return std::nullopt; }
+	if (single_segment_noodle_.has_value()) {
+		finished_ = true;
+		return std::exchange(single_segment_noodle_, std::nullopt);
+	}
+
+	const size_t num_of_depths{epsilon_depths_.size()};
+	while (current_depth_ < num_of_depths) {
+		const size_t depth{current_depth_};
+		const size_t num_of_transitions{epsilon_depths_[depth].size()};
+		size_t index{choices_[depth] == NO_CHOICE ? 0 : choices_[depth] + 1};
+		while (index < num_of_transitions &&
+			   (!is_connected_to_first_segment_[depth][index] || !is_connected_to_next_depth(depth, index))) {
+			++index;
+		}
+
+		if (index == num_of_transitions) { // Backtrack to the next depth.
+			choices_[depth] = NO_CHOICE;
+			++current_depth_;
 			continue;
 		}
 
-		bool all_segments_exist = true;
-		for (auto iter = epsilon_noodle.begin(); iter + 1 != epsilon_noodle.end(); ++iter) {
-			const auto next_iter{iter + 1};
-			if (auto segment_iter = segments_one_initial_final.find(std::make_pair(iter->target, next_iter->source));
-				segment_iter != segments_one_initial_final.end()) {
-				noodle.push_back(segment_iter->second);
-			} else {
-				all_segments_exist = false;
-				break;
-			}
+		choices_[depth] = index;
+		if (depth > 0) {
+			--current_depth_;
+			continue;
 		}
 
-		if (!all_segments_exist) { continue; }
+		// All depths have chosen ε-transitions, each connected with its neighbours by a segment.
+		Noodle noodle{};
+		noodle.reserve(num_of_depths + 1);
+		noodle.push_back(get_segment(unused_state_, epsilon_depths_[0][choices_[0]].source));
+		for (size_t noodle_depth{0}; noodle_depth + 1 < num_of_depths; ++noodle_depth) {
+			noodle.push_back(get_segment(
+				epsilon_depths_[noodle_depth][choices_[noodle_depth]].target,
+				epsilon_depths_[noodle_depth + 1][choices_[noodle_depth + 1]].source
+			));
+		}
+		noodle.push_back(get_segment(epsilon_depths_.back()[choices_.back()].target, unused_state_));
+		return noodle;
+	}
+	finished_ = true;
+	return std::nullopt;
+}
 
-		auto last_segment_iter =
-			segments_one_initial_final.find(std::make_pair(epsilon_noodle.back().target, unused_state));
-		if (last_segment_iter != segments_one_initial_final.end()) {
-			noodle.push_back(last_segment_iter->second);
-		} else {
-			continue;
+std::optional<seg_nfa::Noodle> seg_nfa::find_noodle(
+	NoodleGenerator& generator, const std::function<bool(const Noodle&)>& predicate, size_t num_of_threads
+) {
+	num_of_threads = utils::get_num_of_threads(num_of_threads, std::numeric_limits<size_t>::max());
+	if (num_of_threads == 1) {
+		while (std::optional<Noodle> noodle{generator.next()}) {
+			if (predicate(*noodle)) { return noodle; }
 		}
+		return std::nullopt;
+	}
 
-		noodles.push_back(noodle);
+	// Noodles are handed out to the workers in the order of generation. When a noodle satisfying the predicate is
+	//  found, no further noodles are handed out, but the noodles handed out earlier are still evaluated, so that the
+	//  first satisfying noodle in the order of generation is returned. When a worker throws, no further noodles are
+	//  handed out either, and the exception is rethrown by parallel_for().
+	std::mutex mutex{};
+	size_t num_of_handed_out_noodles{0};
+	size_t result_index{std::numeric_limits<size_t>::max()};
+	std::optional<Noodle> result{};
+	bool failed{false};
+	utils::parallel_for(num_of_threads, num_of_threads, [&](size_t, size_t) {
+		try {
+			while (true) {
+				std::optional<Noodle> noodle{};
+				size_t noodle_index;
+				{
+					const std::lock_guard lock{mutex};
+					if (result.has_value() || failed) { return; }
+					noodle = generator.next();
+					if (!noodle.has_value()) { return; }
+					noodle_index = num_of_handed_out_noodles++;
+				}
+				if (predicate(*noodle)) {
+					const std::lock_guard lock{mutex};
+					if (noodle_index < result_index) {
+						result_index = noodle_index;
+						result = std::move(noodle);
+					}
+				}
+			}
+		} catch (...) {
+			{
+				const std::lock_guard lock{mutex};
+				failed = true;
+			}
+			throw;
+		}
+	});
+	return result;
+}
+
+template <class Value>
+const Value* seg_nfa::NoodlificationCache::find(
+	Memo<Value>& memo, const std::vector<const Nfa*>& automata, const std::string& params
+) {
+	size_t hash{std::hash<std::string>{}(params)};
+	for (const Nfa* automaton : automata) { hash = utils::hash_combine(hash, *automaton); }
+	const auto entries_it{memo.find(hash)};
+	if (entries_it == memo.end()) { return nullptr; }
+	for (Entry<Value>& entry : entries_it->second) {
+		if (entry.params == params && entry.automata.size() == automata.size() &&
+			std::ranges::equal(entry.automata, automata, [](const std::shared_ptr<const Nfa>& cached, const Nfa* aut) {
+				return cached->num_of_states() == aut->num_of_states() && cached->is_identical(*aut);
+			})) {
+			recency_.splice(recency_.begin(), recency_, entry.recency_it);
+			return &entry.value;
+		}
+	}
+	return nullptr;
+}
+
+template <class Value>
+void seg_nfa::NoodlificationCache::insert(
+	Memo<Value>& memo, const std::vector<const Nfa*>& automata, const std::string& params, Value value
+) {
+	// A cache without capacity stores nothing.
+	if (max_num_of_entries_ == 0) { return; }
+	reserve_entry();
+	size_t hash{std::hash<std::string>{}(params)};
+	Entry<Value> entry{{}, params, std::move(value), {}};
+	entry.automata.reserve(automata.size());
+	for (const Nfa* automaton : automata) {
+		hash = utils::hash_combine(hash, *automaton);
+		entry.automata.push_back(std::make_shared<const Nfa>(*automaton));
+	}
+	std::list<Entry<Value>>& entries{memo[hash]};
+	const auto entry_it{entries.insert(entries.end(), std::move(entry))};
+	recency_.emplace_front([&memo, hash, entry_it] {
+		const auto entries_it{memo.find(hash)};
+		entries_it->second.erase(entry_it);
+		if (entries_it->second.empty()) { memo.erase(entries_it); }
+	});
+	entry_it->recency_it = recency_.begin();
+	++num_of_entries_;
+}
+
+void seg_nfa::NoodlificationCache::reserve_entry() {
+	while (num_of_entries_ >= max_num_of_entries_ && !recency_.empty()) {
+		recency_.back()();
+		recency_.pop_back();
+		--num_of_entries_;
+		++statistics_.evictions;
 	}
+}
+
+void seg_nfa::NoodlificationCache::clear() {
+	noodles_.clear();
+	noodles_with_epsilons_counter_.clear();
+	segments_.clear();
+	recency_.clear();
+	num_of_entries_ = 0;
+}
+
+const std::vector<seg_nfa::Noodle>*
+	seg_nfa::NoodlificationCache::find_noodles(const std::vector<const Nfa*>& automata, const std::string& params) {
+	const std::vector<Noodle>* noodles{find(noodles_, automata, params)};
+	++(noodles != nullptr ? statistics_.noodles_hits : statistics_.noodles_misses);
+	return noodles;
+}
+
+void seg_nfa::NoodlificationCache::insert_noodles(
+	const std::vector<const Nfa*>& automata, const std::string& params, std::vector<Noodle> noodles
+) {
+	insert(noodles_, automata, params, std::move(noodles));
+}
+
+const std::vector<seg_nfa::NoodleWithEpsilonsCounter>* seg_nfa::NoodlificationCache::find_noodles_with_epsilons_counter(
+	const std::vector<const Nfa*>& automata, const std::string& params
+) {
+	const std::vector<NoodleWithEpsilonsCounter>* noodles{find(noodles_with_epsilons_counter_, automata, params)};
+	++(noodles != nullptr ? statistics_.noodles_hits : statistics_.noodles_misses);
 	return noodles;
 }
 
+void seg_nfa::NoodlificationCache::insert_noodles_with_epsilons_counter(
+	const std::vector<const Nfa*>& automata, const std::string& params, std::vector<NoodleWithEpsilonsCounter> noodles
+) {
+	insert(noodles_with_epsilons_counter_, automata, params, std::move(noodles));
+}
+
+std::shared_ptr<Nfa> seg_nfa::NoodlificationCache::get_segment(
+	const Nfa& segment, const std::optional<State> initial_state, const std::optional<State> final_state
+) {
+	// Untrimmed segments are copies of the whole segment automaton, hence the cache is keyed by the trimmed segments
+	//  which stay the same when other parts of the segment automaton change.
+	const Nfa trimmed_segment{trim_segment(segment, initial_state, final_state)};
+	if (const std::shared_ptr<Nfa>* cached{find(segments_, {&trimmed_segment}, "")}) {
+		++statistics_.segments_hits;
+		return *cached;
+	}
+	++statistics_.segments_misses;
+	auto reduced_segment{std::make_shared<Nfa>(reduce(trimmed_segment))};
+	insert(segments_, {&trimmed_segment}, "", reduced_segment);
+	return reduced_segment;
+}
+
 // todo: is this taking all final times all initial?
 //  can it be done more efficiently? (only connected combinations through dfs)
 void seg_nfa::segs_one_initial_final(
 	const std::vector<Nfa>& segments,
 	bool include_empty,
 	const State& unused_state,
-	std::map<std::pair<State, State>, std::shared_ptr<Nfa>>& out
+	std::map<std::pair<State, State>, std::shared_ptr<Nfa>>& out,
+	NoodlificationCache* cache
 ) {
+	auto trim_and_reduce_segment = [&](const Nfa& segment, const std::optional<State> init_state,
+									   const std::optional<State> final_state) {
+		if (cache != nullptr) { return cache->get_segment(segment, init_state, final_state); }
+		return std::make_shared<Nfa>(reduce(trim_segment(segment, init_state, final_state)));
+	};
+
 	for (auto iter = segments.begin(); iter != segments.end(); ++iter) {
 		if (iter == segments.begin()) { // first segment will always have all initial states in noodles
 			for (const State final_state : iter->final) {
-				if (Nfa segment_one_final = reduce(
-						trim(*iter, nullptr, std::nullopt, std::make_optional(utils::SparseSet<State>{final_state}))
-					);
-					segment_one_final.num_of_states() > 0 || include_empty) {
-					out[std::make_pair(unused_state, final_state)] =
-						std::make_shared<Nfa>(std::move(segment_one_final));
+				if (std::shared_ptr<Nfa> segment_one_final{trim_and_reduce_segment(*iter, std::nullopt, final_state)};
+					segment_one_final->num_of_states() > 0 || include_empty) {
+					out[std::make_pair(unused_state, final_state)] = std::move(segment_one_final);
 				}
 			}
 		} else if (iter + 1 == segments.end()) { // last segment will always have all final states in noodles
 			for (const State init_state : iter->initial) {
-				if (Nfa segment_one_init = reduce(
-						trim(*iter, nullptr, std::make_optional(utils::SparseSet<State>{init_state}), std::nullopt)
-					);
-					segment_one_init.num_of_states() > 0 || include_empty) {
-					out[std::make_pair(init_state, unused_state)] = std::make_shared<Nfa>(std::move(segment_one_init));
+				if (std::shared_ptr<Nfa> segment_one_init{trim_and_reduce_segment(*iter, init_state, std::nullopt)};
+					segment_one_init->num_of_states() > 0 || include_empty) {
+					out[std::make_pair(init_state, unused_state)] = std::move(segment_one_init);
 				}
 			}
 		} else { // the segments in-between
 			for (const State init_state : iter->initial) {
 				for (const State final_state : iter->final) {
-					if (Nfa segment_one_init_final = reduce(trim(
-							*iter, nullptr, std::make_optional(utils::SparseSet<State>{init_state}),
-							std::make_optional(utils::SparseSet<State>{final_state})
-						));
-						segment_one_init_final.num_of_states() > 0 || include_empty) {
-						out[std::make_pair(init_state, final_state)] =
-							std::make_shared<Nfa>(std::move(segment_one_init_final));
+					if (std::shared_ptr<Nfa> segment_one_init_final{
+							trim_and_reduce_segment(*iter, init_state, final_state)
+						};
+						segment_one_init_final->num_of_states() > 0 || include_empty) {
+						out[std::make_pair(init_state, final_state)] = std::move(segment_one_init_final);
 					}
 				}
 			}
@@ -213,8 +441,10 @@ void seg_nfa::segs_one_initial_final(
 	}
 }
 
-std::vector<seg_nfa::NoodleWithEpsilonsCounter>
-	seg_nfa::noodlify_mult_eps(const SegNfa& aut, const std::set<Symbol>& epsilons, bool include_empty) {
+std::vector<seg_nfa::NoodleWithEpsilonsCounter> seg_nfa::noodlify_mult_eps(
+	const SegNfa& aut, const std::set<Symbol>& epsilons, bool include_empty, NoodlificationCache* cache
+) {
+	const mata::utils::OperationProfile profile{"strings::noodlify_mult_eps"};
 	Segmentation segmentation{aut, epsilons};
 	const auto& segments{segmentation.get_untrimmed_segments()};
 
@@ -232,7 +462,7 @@ std::vector<seg_nfa::NoodleWithEpsilonsCounter>
 
 	State unused_state = aut.num_of_states(); // get some State not used in aut
 	std::map<std::pair<State, State>, std::shared_ptr<Nfa>> segments_one_initial_final;
-	segs_one_initial_final(segments, include_empty, unused_state, segments_one_initial_final);
+	segs_one_initial_final(segments, include_empty, unused_state, segments_one_initial_final, cache);
 
 	const auto& epsilon_depths_map{segmentation.get_epsilon_depth_trans_map()};
 
@@ -302,7 +532,8 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 	const std::vector<std::reference_wrapper<Nfa>>& lhs_automata,
 	const Nfa& rhs_automaton,
 	bool include_empty,
-	const ParameterMap& params
+	const ParameterMap& params,
+	NoodlificationCache* cache
 ) {
 	const auto lhs_aut_begin{lhs_automata.begin()};
 	const auto lhs_aut_end{lhs_automata.end()};
@@ -313,6 +544,15 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 
 	if (lhs_automata.empty() || rhs_automaton.is_lang_empty()) { return {}; }
 
+	std::vector<const Nfa*> cache_automata{};
+	std::string cache_params{};
+	if (cache != nullptr) {
+		for (const Nfa& lhs_aut : lhs_automata) { cache_automata.push_back(&lhs_aut); }
+		cache_automata.push_back(&rhs_automaton);
+		cache_params = equation_cache_params("equation", include_empty, params);
+		if (const std::vector<Noodle>* noodles{cache->find_noodles(cache_automata, cache_params)}) { return *noodles; }
+	}
+
 	// Automaton representing the left side concatenated over epsilon transitions.
 	Nfa concatenated_lhs{*lhs_aut_begin};
 	for (auto next_lhs_aut_it{lhs_aut_begin + 1}; next_lhs_aut_it != lhs_aut_end; ++next_lhs_aut_it) {
@@ -320,7 +560,10 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 	}
 
 	auto product_pres_eps_trans{intersection(concatenated_lhs, rhs_automaton).trim()};
-	if (product_pres_eps_trans.is_lang_empty()) { return {}; }
+	if (product_pres_eps_trans.is_lang_empty()) {
+		if (cache != nullptr) { cache->insert_noodles(cache_automata, cache_params, {}); }
+		return {};
+	}
 	if (utils::haskey(params, "reduce")) {
 		const std::string& reduce_value = params.at("reduce");
 		if (reduce_value == "forward" || reduce_value == "bidirectional") {
@@ -332,11 +575,17 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 			product_pres_eps_trans = revert(product_pres_eps_trans);
 		}
 	}
-	return noodlify(product_pres_eps_trans, mata::nfa::EPSILON, include_empty);
+	std::vector<Noodle> noodles{noodlify(product_pres_eps_trans, mata::nfa::EPSILON, include_empty, cache)};
+	if (cache != nullptr) { cache->insert_noodles(cache_automata, cache_params, noodles); }
+	return noodles;
 }
 
 std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
-	const std::vector<Nfa*>& lhs_automata, const Nfa& rhs_automaton, bool include_empty, const ParameterMap& params
+	const std::vector<Nfa*>& lhs_automata,
+	const Nfa& rhs_automaton,
+	bool include_empty,
+	const ParameterMap& params,
+	NoodlificationCache* cache
 ) {
 	const auto lhs_aut_begin{lhs_automata.begin()};
 	const auto lhs_aut_end{lhs_automata.end()};
@@ -355,6 +604,15 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 
 	if (lhs_automata.empty() || rhs_automaton.is_lang_empty()) { return {}; }
 
+	std::vector<const Nfa*> cache_automata{};
+	std::string cache_params{};
+	if (cache != nullptr) {
+		cache_automata.assign(lhs_aut_begin, lhs_aut_end);
+		cache_automata.push_back(&rhs_automaton);
+		cache_params = equation_cache_params("equation_of_pointers", include_empty, params);
+		if (const std::vector<Noodle>* noodles{cache->find_noodles(cache_automata, cache_params)}) { return *noodles; }
+	}
+
 	// Automaton representing the left side concatenated over epsilon transitions.
 	Nfa concatenated_lhs{*(*lhs_aut_begin)};
 	for (auto next_lhs_aut_it{lhs_aut_begin + 1}; next_lhs_aut_it != lhs_aut_end; ++next_lhs_aut_it) {
@@ -362,7 +620,10 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 	}
 
 	auto product_pres_eps_trans{intersection(concatenated_lhs, rhs_automaton).trim()};
-	if (product_pres_eps_trans.is_lang_empty()) { return {}; }
+	if (product_pres_eps_trans.is_lang_empty()) {
+		if (cache != nullptr) { cache->insert_noodles(cache_automata, cache_params, {}); }
+		return {};
+	}
 	if (!reduce_value.empty()) {
 		if (reduce_value == "forward" || reduce_value == "bidirectional") {
 			product_pres_eps_trans = reduce(product_pres_eps_trans);
@@ -373,14 +634,17 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify_for_equation(
 			product_pres_eps_trans = revert(product_pres_eps_trans);
 		}
 	}
-	return noodlify(product_pres_eps_trans, mata::nfa::EPSILON, include_empty);
+	std::vector<Noodle> noodles{noodlify(product_pres_eps_trans, mata::nfa::EPSILON, include_empty, cache)};
+	if (cache != nullptr) { cache->insert_noodles(cache_automata, cache_params, noodles); }
+	return noodles;
 }
 
 std::vector<seg_nfa::NoodleWithEpsilonsCounter> seg_nfa::noodlify_for_equation(
 	const std::vector<std::shared_ptr<Nfa>>& lhs_automata,
 	const std::vector<std::shared_ptr<Nfa>>& rhs_automata,
 	bool include_empty,
-	const ParameterMap& params
+	const ParameterMap& params,
+	NoodlificationCache* cache
 ) {
 	if (lhs_automata.empty() || rhs_automata.empty()) { return {}; }
 
@@ -388,13 +652,32 @@ std::vector<seg_nfa::NoodleWithEpsilonsCounter> seg_nfa::noodlify_for_equation(
 	unify_initial_and_final_states(lhs_automata, unified_nfas);
 	unify_initial_and_final_states(rhs_automata, unified_nfas);
 
+	std::vector<const Nfa*> cache_automata{};
+	std::string cache_params{};
+	if (cache != nullptr) {
+		for (const std::shared_ptr<Nfa>& aut : lhs_automata) { cache_automata.push_back(aut.get()); }
+		for (const std::shared_ptr<Nfa>& aut : rhs_automata) { cache_automata.push_back(aut.get()); }
+		// The number of left side automata distinguishes the equations with the same sequence of all automata.
+		cache_params = equation_cache_params(
+			"equation_of_sequences;lhs=" + std::to_string(lhs_automata.size()), include_empty, params
+		);
+		if (const std::vector<NoodleWithEpsilonsCounter>* noodles{
+				cache->find_noodles_with_epsilons_counter(cache_automata, cache_params)
+			}) {
+			return *noodles;
+		}
+	}
+
 	// Automata representing the left/right side concatenated over different epsilon transitions.
 	Nfa concatenated_lhs = concatenate_with(lhs_automata, mata::nfa::EPSILON);
 	Nfa concatenated_rhs = concatenate_with(rhs_automata, mata::nfa::EPSILON - 1);
 
 	auto product_pres_eps_trans{intersection(concatenated_lhs, concatenated_rhs, mata::nfa::EPSILON - 1).trim()};
 
-	if (product_pres_eps_trans.is_lang_empty()) { return {}; }
+	if (product_pres_eps_trans.is_lang_empty()) {
+		if (cache != nullptr) { cache->insert_noodles_with_epsilons_counter(cache_automata, cache_params, {}); }
+		return {};
+	}
 	if (utils::haskey(params, "reduce")) {
 		const std::string& reduce_value = params.at("reduce");
 		if (reduce_value == "forward" || reduce_value == "bidirectional") {
@@ -406,7 +689,11 @@ std::vector<seg_nfa::NoodleWithEpsilonsCounter> seg_nfa::noodlify_for_equation(
 			product_pres_eps_trans = revert(product_pres_eps_trans);
 		}
 	}
-	return noodlify_mult_eps(product_pres_eps_trans, {mata::nfa::EPSILON, mata::nfa::EPSILON - 1}, include_empty);
+	std::vector<NoodleWithEpsilonsCounter> noodles{noodlify_mult_eps(
+		product_pres_eps_trans, {mata::nfa::EPSILON, mata::nfa::EPSILON - 1}, include_empty, cache
+	)};
+	if (cache != nullptr) { cache->insert_noodles_with_epsilons_counter(cache_automata, cache_params, noodles); }
+	return noodles;
 }
 
 seg_nfa::VisitedEpsilonsCounterVector seg_nfa::process_eps_map(const VisitedEpsilonsCounterMap& eps_cnt) {
@@ -415,6 +702,32 @@ seg_nfa::VisitedEpsilonsCounterVector seg_nfa::process_eps_map(const VisitedEpsi
 	return ret;
 }
 
+seg_nfa::Equation seg_nfa::create_random_equation(
+	const size_t num_of_lhs_variables,
+	const size_t num_of_rhs_variables,
+	const size_t num_of_states,
+	const size_t alphabet_size,
+	const double states_transitions_ratio_per_symbol,
+	const std::optional<unsigned int>& seed
+) {
+	std::mt19937 gen(seed.value_or(std::random_device{}()));
+	auto create_side = [&](const size_t num_of_variables) {
+		std::vector<std::shared_ptr<Nfa>> automata{};
+		for (size_t i{0}; i < num_of_variables; ++i) {
+			Nfa constraint{mata::nfa::builder::create_random_nfa_tabakov_vardi(
+				num_of_states, alphabet_size, states_transitions_ratio_per_symbol, 0.5, static_cast<unsigned int>(gen())
+			)};
+			constraint.alphabet = nullptr;
+			automata.push_back(std::make_shared<Nfa>(std::move(constraint.trim())));
+		}
+		return automata;
+	};
+	Equation equation{};
+	equation.lhs_automata = create_side(num_of_lhs_variables);
+	equation.rhs_automata = create_side(num_of_rhs_variables);
+	return equation;
+}
+
 std::vector<seg_nfa::TransducerNoodle> seg_nfa::noodlify_for_transducer(
 	const std::shared_ptr<Nft>& nft,
 	const std::vector<std::shared_ptr<Nfa>>& input_automata,
@@ -4,6 +4,7 @@
 #include "mata/applications/strings.hh"
 #include "mata/nfa/builder.hh"
 
+#include <bit>
 #include <optional>
 
 using namespace mata::nfa;
@@ -117,51 +118,146 @@ std::set<mata::Symbol> mata::applications::strings::get_accepted_symbols(const N
 	return accepted_symbols;
 }
 
-std::set<std::pair<int, int>> mata::applications::strings::get_word_lengths(const Nfa& aut) {
-	Nfa one_letter;
-	/// if we are interested in lengths of words, it suffices to forget the different symbols on transitions.
-	/// The lengths of @p aut are hence equivalent to lengths of the NFA taken from @p aut where all symbols on
-	/// transitions are renamed to a single symbol (e.g., `a`).
-	aut.get_one_letter_aut(one_letter);
-	one_letter = determinize(one_letter).trim();
-	if (one_letter.num_of_states() == 0) { return {}; }
-
-	std::set<std::pair<int, int>> ret;
-	std::vector<int> handles(one_letter.num_of_states(), 0); // initialized to 0
-	assert(one_letter.initial.size() == 1);
-	std::optional<nfa::State> curr_state = *one_letter.initial.begin();
-	std::set<nfa::State> visited;
-	int cnt = 0; // handle counter
-	int loop_size = 0; // loop size
-	int loop_start = -1; // cnt where the loop starts
-
-	while (curr_state.has_value()) {
-		visited.insert(curr_state.value());
-		handles[curr_state.value()] = cnt++;
-		nfa::StatePost post = one_letter.delta[curr_state.value()];
-
-		curr_state.reset();
-		assert(post.size() <= 1);
-		for (const SymbolPost& move : post) {
-			assert(move.targets.size() == 1);
-			if (nfa::State target = *move.targets.begin(); !visited.contains(target)) {
-				curr_state = target;
-			} else {
-				curr_state.reset();
-				loop_start = handles[target];
-				loop_size = cnt - handles[target];
+namespace {
+/// Set of states represented as a bit vector of 64-bit blocks.
+using StateBits = std::vector<uint64_t>;
+constexpr size_t STATE_BITS_BLOCK_SIZE{64};
+
+void insert_state(StateBits& states, const State state) {
+	states[state / STATE_BITS_BLOCK_SIZE] |= uint64_t{1} << (state % STATE_BITS_BLOCK_SIZE);
+}
+
+bool intersects(const StateBits& lhs, const StateBits& rhs) {
+	for (size_t block{0}; block < lhs.size(); ++block) {
+		if ((lhs[block] & rhs[block]) != 0) { return true; }
+	}
+	return false;
+}
+
+bool is_empty_set(const StateBits& states) {
+	return std::ranges::all_of(states, [](const uint64_t block) { return block == 0; });
+}
+
+/**
+ * @brief Successors of sets of states in the one-letter abstraction of an automaton.
+ */
+class UnaryPost {
+  public:
+	explicit UnaryPost(const Nfa& aut) : successors_(aut.num_of_states()) {
+		for (State source{0}; source < successors_.size(); ++source) {
+			std::vector<State>& targets{successors_[source]};
+			for (const SymbolPost& symbol_post : aut.delta[source]) {
+				targets.insert(targets.end(), symbol_post.targets.begin(), symbol_post.targets.end());
 			}
+			std::ranges::sort(targets);
+			targets.erase(std::ranges::unique(targets).begin(), targets.end());
 		}
 	}
-	for (const nfa::State& fin : one_letter.final) {
-		if (handles[fin] >= loop_start) {
-			ret.insert({handles[fin], loop_size});
-		} else {
-			ret.insert({handles[fin], 0});
+
+	/// Get the set of successors of @p states.
+	StateBits operator()(const StateBits& states) const {
+		StateBits result(states.size(), 0);
+		for (size_t block{0}; block < states.size(); ++block) {
+			for (uint64_t bits{states[block]}; bits != 0; bits &= bits - 1) {
+				const State source{block * STATE_BITS_BLOCK_SIZE + static_cast<size_t>(std::countr_zero(bits))};
+				for (const State target : successors_[source]) { insert_state(result, target); }
+			}
 		}
+		return result;
+	}
+
+  private:
+	std::vector<std::vector<State>> successors_;
+};
+} // namespace
+
+LengthAbstraction::LengthAbstraction(const Nfa& aut) {
+	const size_t num_of_blocks{(aut.num_of_states() + STATE_BITS_BLOCK_SIZE - 1) / STATE_BITS_BLOCK_SIZE};
+	StateBits final_states(num_of_blocks, 0);
+	for (const State state : aut.final) { insert_state(final_states, state); }
+	StateBits initial_states(num_of_blocks, 0);
+	for (const State state : aut.initial) { insert_state(initial_states, state); }
+	if (is_empty_set(initial_states)) { return; }
+
+	const UnaryPost post{aut};
+	// Brent's cycle detection on the sequence of sets of states reachable by words of length 0, 1, 2, ..., storing
+	//  only a constant number of the sets. The sequence either ends with an empty set or becomes periodic. The hare
+	//  visits each set of the sequence (up to the end of the first period) exactly once during the search for the
+	//  period, which is used to record which sets contain a final state.
+	is_accepting_.push_back(intersects(initial_states, final_states));
+	StateBits tortoise{initial_states};
+	StateBits hare{post(initial_states)};
+	size_t power{1};
+	size_t period{1};
+	while (hare != tortoise) {
+		if (is_empty_set(hare)) { // The sequence ends without a loop.
+			loop_start_ = is_accepting_.size();
+			return;
+		}
+		is_accepting_.push_back(intersects(hare, final_states));
+		if (power == period) {
+			tortoise = hare;
+			power *= 2;
+			period = 0;
+		}
+		hare = post(hare);
+		++period;
+	}
+
+	// Find the start of the loop: move the tortoise from the beginning and the hare a period ahead of it.
+	tortoise = initial_states;
+	hare = initial_states;
+	for (size_t step{0}; step < period; ++step) { hare = post(hare); }
+	size_t loop_start{0};
+	while (hare != tortoise) {
+		tortoise = post(tortoise);
+		hare = post(hare);
+		++loop_start;
 	}
+	loop_start_ = loop_start;
+	period_ = period;
+	is_accepting_.resize(loop_start_ + period_);
+}
+
+bool LengthAbstraction::contains(const size_t length) const {
+	if (length < is_accepting_.size()) { return is_accepting_[length]; }
+	if (period_ == 0) { return false; }
+	return is_accepting_[loop_start_ + (length - loop_start_) % period_];
+}
+
+bool LengthAbstraction::is_finite() const {
+	const auto loop_begin{is_accepting_.begin() + static_cast<std::ptrdiff_t>(loop_start_)};
+	return std::all_of(loop_begin, is_accepting_.end(), [](const uint8_t accepting) { return !accepting; });
+}
+
+std::optional<size_t> LengthAbstraction::get_min_length() const {
+	for (size_t length{0}; length < is_accepting_.size(); ++length) {
+		if (is_accepting_[length]) { return length; }
+	}
+	return std::nullopt;
+}
 
-	return ret;
+std::optional<size_t> LengthAbstraction::get_max_length() const {
+	if (!is_finite()) { return std::nullopt; }
+	for (size_t length{is_accepting_.size()}; length > 0; --length) {
+		if (is_accepting_[length - 1]) { return length - 1; }
+	}
+	return std::nullopt;
+}
+
+std::set<std::pair<int, int>> LengthAbstraction::get_word_lengths() const {
+	std::set<std::pair<int, int>> result{};
+	for (size_t length{0}; length < is_accepting_.size(); ++length) {
+		if (!is_accepting_[length]) { continue; }
+		// Lengths in the prefix of the lasso are not repeated.
+		const size_t period{length < loop_start_ ? 0 : period_};
+		result.emplace(static_cast<int>(length), static_cast<int>(period));
+	}
+	return result;
+}
+
+std::set<std::pair<int, int>> mata::applications::strings::get_word_lengths(const Nfa& aut) {
+	return LengthAbstraction{aut}.get_word_lengths();
 }
 
 bool mata::applications::strings::is_lang_eps(const Nfa& aut) {
@@ -0,0 +1,429 @@
+/** @file
+ * @brief Binary format for NFAs and NFTs.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "mata/parser/binary.hh"
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MATA_BINARY_MMAP
+#endif
+
+using namespace mata::parser;
+using mata::OnTheFlyAlphabet;
+using mata::Symbol;
+using mata::nfa::Delta;
+using mata::nfa::Nfa;
+using mata::nfa::State;
+using mata::nfa::StatePost;
+using mata::nfa::SymbolPost;
+using mata::nft::Level;
+using mata::nft::Levels;
+using mata::nft::Nft;
+
+namespace {
+/// Kind of the automaton stored in the binary format.
+enum class Kind : uint32_t {
+	Nfa = 0,
+	Nft = 1,
+};
+
+/// Counts stored in the header after the magic bytes, the version and the kind.
+struct Header {
+	uint64_t num_of_states{0};
+	uint64_t num_of_initial{0};
+	uint64_t num_of_final{0};
+	uint64_t num_of_symbol_posts{0};
+	uint64_t num_of_targets{0};
+	uint64_t num_of_levels{0};
+	uint64_t num_of_alphabet_entries{0};
+};
+
+/// Convert @p value between the native and the little-endian byte order.
+template <class T> T to_little_endian(T value) {
+	if constexpr (std::endian::native == std::endian::little) {
+		return value;
+	} else {
+		T result{0};
+		for (size_t byte{0}; byte < sizeof(T); ++byte) {
+			result = static_cast<T>(result << 8 | (value & 0xff));
+			value = static_cast<T>(value >> 8);
+		}
+		return result;
+	}
+}
+
+class Writer {
+  public:
+	explicit Writer(std::ostream& output) : output_{output} {}
+
+	template <class T> void write(const T value) {
+		const T little_endian_value{to_little_endian(value)};
+		output_.write(reinterpret_cast<const char*>(&little_endian_value), sizeof(T));
+	}
+
+	void write(const std::vector<uint64_t>& values) {
+		if constexpr (std::endian::native == std::endian::little) {
+			output_.write(
+				reinterpret_cast<const char*>(values.data()),
+				static_cast<std::streamsize>(values.size() * sizeof(uint64_t))
+			);
+		} else {
+			for (const uint64_t value : values) { write(value); }
+		}
+	}
+
+	void write(const std::string_view bytes) {
+		output_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+  private:
+	std::ostream& output_;
+};
+
+void write_automaton(
+	const Kind kind, const Nfa& nfa, const Levels* levels, std::ostream& output, const OnTheFlyAlphabet* alphabet
+) {
+	const size_t num_of_states{nfa.num_of_states()};
+	std::vector<uint64_t> initial(nfa.initial.begin(), nfa.initial.end());
+	std::ranges::sort(initial);
+	std::vector<uint64_t> final(nfa.final.begin(), nfa.final.end());
+	std::ranges::sort(final);
+
+	std::vector<uint64_t> state_offsets{};
+	state_offsets.reserve(num_of_states + 1);
+	std::vector<uint64_t> symbols{};
+	std::vector<uint64_t> target_offsets{};
+	std::vector<uint64_t> targets{};
+	targets.reserve(nfa.delta.num_of_transitions());
+	for (State state{0}; state < num_of_states; ++state) {
+		state_offsets.push_back(symbols.size());
+		for (const SymbolPost& symbol_post : nfa.delta[state]) {
+			symbols.push_back(symbol_post.symbol);
+			target_offsets.push_back(targets.size());
+			targets.insert(targets.end(), symbol_post.targets.begin(), symbol_post.targets.end());
+		}
+	}
+	state_offsets.push_back(symbols.size());
+	target_offsets.push_back(targets.size());
+
+	std::vector<std::pair<Symbol, std::string_view>> alphabet_entries{};
+	if (alphabet != nullptr) {
+		for (const auto& [name, symbol] : alphabet->get_symbol_map()) { alphabet_entries.emplace_back(symbol, name); }
+		std::ranges::sort(alphabet_entries);
+	}
+
+	Writer writer{output};
+	writer.write(BINARY_FORMAT_MAGIC);
+	writer.write(BINARY_FORMAT_VERSION);
+	writer.write(static_cast<uint32_t>(kind));
+	writer.write(uint64_t{num_of_states});
+	writer.write(uint64_t{initial.size()});
+	writer.write(uint64_t{final.size()});
+	writer.write(uint64_t{symbols.size()});
+	writer.write(uint64_t{targets.size()});
+	writer.write(uint64_t{levels != nullptr ? levels->num_of_levels : 0});
+	writer.write(uint64_t{alphabet_entries.size()});
+	writer.write(initial);
+	writer.write(final);
+	writer.write(state_offsets);
+	writer.write(symbols);
+	writer.write(target_offsets);
+	writer.write(targets);
+	if (levels != nullptr) {
+		std::vector<uint64_t> state_levels(num_of_states, mata::nft::DEFAULT_LEVEL);
+		std::copy_n(levels->begin(), std::min(levels->size(), num_of_states), state_levels.begin());
+		writer.write(state_levels);
+	}
+	for (const auto& [symbol, name] : alphabet_entries) {
+		writer.write(uint64_t{symbol});
+		writer.write(uint64_t{name.size()});
+		writer.write(name);
+	}
+	if (!output) { throw std::runtime_error("Could not write the automaton in the binary format"); }
+}
+
+void write_automaton_to_file(
+	const Kind kind,
+	const Nfa& nfa,
+	const Levels* levels,
+	const std::filesystem::path& file,
+	const OnTheFlyAlphabet* alphabet
+) {
+	std::ofstream output{file, std::ios::binary};
+	if (!output) { throw std::runtime_error("Could not open file '" + file.string() + "'"); }
+	write_automaton(kind, nfa, levels, output, alphabet);
+}
+
+/**
+ * @brief Sequential reader of the binary format from a buffer. Checks that all reads are within the buffer.
+ */
+class Reader {
+  public:
+	explicit Reader(const std::span<const std::byte> data) : data_{data} {}
+
+	template <class T> T read() {
+		T value;
+		std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+		return to_little_endian(value);
+	}
+
+	/// View of an array of @p count 64-bit numbers stored in the buffer, without copying them.
+	class Array {
+	  public:
+		explicit Array(const std::span<const std::byte> bytes) : bytes_{bytes} {}
+		uint64_t operator[](const size_t index) const {
+			uint64_t value;
+			std::memcpy(&value, bytes_.data() + index * sizeof(uint64_t), sizeof(uint64_t));
+			return to_little_endian(value);
+		}
+		size_t size() const { return bytes_.size() / sizeof(uint64_t); }
+
+	  private:
+		std::span<const std::byte> bytes_;
+	};
+
+	Array read_array(const uint64_t count) {
+		if (count > (data_.size() - position_) / sizeof(uint64_t)) { throw_corrupted(); }
+		return Array{take(count * sizeof(uint64_t))};
+	}
+
+	std::string_view read_string(const uint64_t length) {
+		const std::span<const std::byte> bytes{take(length)};
+		return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+	}
+
+	[[noreturn]] static void throw_corrupted() {
+		throw std::runtime_error("Invalid or corrupted automaton in the binary format");
+	}
+
+  private:
+	std::span<const std::byte> take(const size_t size) {
+		if (size > data_.size() - position_) { throw_corrupted(); }
+		const std::span<const std::byte> bytes{data_.subspan(position_, size)};
+		position_ += size;
+		return bytes;
+	}
+
+	std::span<const std::byte> data_;
+	size_t position_{0};
+};
+
+/**
+ * @brief Read an automaton of the kind @p kind from @p data into @p nfa (and its levels into @p levels for NFTs).
+ */
+void read_automaton(
+	const std::span<const std::byte> data, const Kind kind, Nfa& nfa, Levels* levels, OnTheFlyAlphabet* alphabet
+) {
+	Reader reader{data};
+	if (reader.read_string(BINARY_FORMAT_MAGIC.size()) != BINARY_FORMAT_MAGIC) {
+		throw std::runtime_error("Not an automaton in the binary format");
+	}
+	if (const auto version{reader.read<uint32_t>()}; version != BINARY_FORMAT_VERSION) {
+		throw std::runtime_error("Unsupported version of the binary format: " + std::to_string(version));
+	}
+	if (reader.read<uint32_t>() != static_cast<uint32_t>(kind)) {
+		throw std::runtime_error(
+			std::string{"Expected "} + (kind == Kind::Nfa ? "an NFA" : "an NFT") + " in the binary format"
+		);
+	}
+	Header header{};
+	header.num_of_states = reader.read<uint64_t>();
+	header.num_of_initial = reader.read<uint64_t>();
+	header.num_of_final = reader.read<uint64_t>();
+	header.num_of_symbol_posts = reader.read<uint64_t>();
+	header.num_of_targets = reader.read<uint64_t>();
+	header.num_of_levels = reader.read<uint64_t>();
+	header.num_of_alphabet_entries = reader.read<uint64_t>();
+
+	const size_t num_of_states{header.num_of_states};
+	const Reader::Array initial{reader.read_array(header.num_of_initial)};
+	const Reader::Array final{reader.read_array(header.num_of_final)};
+	if (num_of_states == std::numeric_limits<uint64_t>::max()) { Reader::throw_corrupted(); }
+	const Reader::Array state_offsets{reader.read_array(num_of_states + 1)};
+	const Reader::Array symbols{reader.read_array(header.num_of_symbol_posts)};
+	if (header.num_of_symbol_posts == std::numeric_limits<uint64_t>::max()) { Reader::throw_corrupted(); }
+	const Reader::Array target_offsets{reader.read_array(header.num_of_symbol_posts + 1)};
+	const Reader::Array targets{reader.read_array(header.num_of_targets)};
+
+	auto read_state = [&](const uint64_t state) {
+		if (state >= num_of_states) { Reader::throw_corrupted(); }
+		return static_cast<State>(state);
+	};
+	nfa.initial.reserve(num_of_states);
+	for (size_t index{0}; index < initial.size(); ++index) { nfa.initial.insert(read_state(initial[index])); }
+	nfa.final.reserve(num_of_states);
+	for (size_t index{0}; index < final.size(); ++index) { nfa.final.insert(read_state(final[index])); }
+
+	// The symbol posts and their targets are stored sorted, so they are appended without searching and sorting.
+	nfa.delta = Delta(num_of_states);
+	if (state_offsets[0] != 0 || state_offsets[num_of_states] != symbols.size() || target_offsets[0] != 0 ||
+		target_offsets[symbols.size()] != targets.size()) {
+		Reader::throw_corrupted();
+	}
+	for (State source{0}; source < num_of_states; ++source) {
+		const uint64_t symbol_posts_begin{state_offsets[source]};
+		const uint64_t symbol_posts_end{state_offsets[source + 1]};
+		if (symbol_posts_begin > symbol_posts_end || symbol_posts_end > symbols.size()) { Reader::throw_corrupted(); }
+		if (symbol_posts_begin == symbol_posts_end) { continue; }
+		StatePost& state_post{nfa.delta.mutable_state_post(source)};
+		state_post.reserve(symbol_posts_end - symbol_posts_begin);
+		for (uint64_t post_index{symbol_posts_begin}; post_index < symbol_posts_end; ++post_index) {
+			const uint64_t symbol{symbols[post_index]};
+			if (symbol > std::numeric_limits<Symbol>::max() ||
+				(post_index > symbol_posts_begin && symbol <= symbols[post_index - 1])) {
+				Reader::throw_corrupted();
+			}
+			const uint64_t targets_begin{target_offsets[post_index]};
+			const uint64_t targets_end{target_offsets[post_index + 1]};
+			if (targets_begin >= targets_end || targets_end > targets.size()) { Reader::throw_corrupted(); }
+			SymbolPost& symbol_post{state_post.emplace_back(static_cast<Symbol>(symbol))};
+			symbol_post.targets.reserve(targets_end - targets_begin);
+			for (uint64_t target_index{targets_begin}; target_index < targets_end; ++target_index) {
+				const State target{read_state(targets[target_index])};
+				if (target_index > targets_begin && target <= targets[target_index - 1]) { Reader::throw_corrupted(); }
+				symbol_post.targets.push_back(target);
+			}
+		}
+	}
+
+	if (kind == Kind::Nft) {
+		const Reader::Array state_levels{reader.read_array(num_of_states)};
+		std::vector<Level> read_levels(num_of_states);
+		for (State state{0}; state < num_of_states; ++state) {
+			if (state_levels[state] >= header.num_of_levels) { Reader::throw_corrupted(); }
+			read_levels[state] = static_cast<Level>(state_levels[state]);
+		}
+		*levels = Levels(header.num_of_levels, std::move(read_levels));
+	}
+
+	for (uint64_t entry{0}; entry < header.num_of_alphabet_entries; ++entry) {
+		const auto symbol{reader.read<uint64_t>()};
+		const std::string_view name{reader.read_string(reader.read<uint64_t>())};
+		if (symbol > std::numeric_limits<Symbol>::max()) { Reader::throw_corrupted(); }
+		if (alphabet != nullptr) { alphabet->try_add_new_symbol(std::string{name}, static_cast<Symbol>(symbol)); }
+	}
+}
+
+std::vector<std::byte> read_stream(std::istream& input) {
+	std::vector<std::byte> data{};
+	char buffer[1 << 16];
+	while (input.read(buffer, sizeof(buffer)) || input.gcount() > 0) {
+		const auto* const bytes{reinterpret_cast<const std::byte*>(buffer)};
+		data.insert(data.end(), bytes, bytes + input.gcount());
+	}
+	return data;
+}
+
+/**
+ * @brief Call @p function with the contents of @p file, memory-mapped where supported.
+ */
+template <class Function> auto with_file_contents(const std::filesystem::path& file, Function function) {
+#ifdef MATA_BINARY_MMAP
+	/// Memory-mapped file, unmapped and closed on destruction.
+	class MappedFile {
+	  public:
+		explicit MappedFile(const std::filesystem::path& file) : descriptor_{::open(file.c_str(), O_RDONLY)} {
+			if (descriptor_ < 0) { throw std::runtime_error("Could not open file '" + file.string() + "'"); }
+			struct stat file_stat {};
+			if (::fstat(descriptor_, &file_stat) != 0) {
+				::close(descriptor_);
+				throw std::runtime_error("Could not read file '" + file.string() + "'");
+			}
+			size_ = static_cast<size_t>(file_stat.st_size);
+			if (size_ > 0) {
+				address_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor_, 0);
+				if (address_ == MAP_FAILED) {
+					::close(descriptor_);
+					throw std::runtime_error("Could not map file '" + file.string() + "'");
+				}
+			}
+		}
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() {
+			if (address_ != nullptr) { ::munmap(address_, size_); }
+			::close(descriptor_);
+		}
+
+		std::span<const std::byte> data() const { return {static_cast<const std::byte*>(address_), size_}; }
+
+	  private:
+		int descriptor_;
+		void* address_{nullptr};
+		size_t size_{0};
+	};
+
+	const MappedFile mapped_file{file};
+	return function(mapped_file.data());
+#else
+	std::ifstream input{file, std::ios::binary};
+	if (!input) { throw std::runtime_error("Could not open file '" + file.string() + "'"); }
+	const std::vector<std::byte> data{read_stream(input)};
+	return function(std::span<const std::byte>{data});
+#endif
+}
+} // namespace
+
+void mata::parser::write_binary(const Nfa& nfa, std::ostream& output, const OnTheFlyAlphabet* alphabet) {
+	write_automaton(Kind::Nfa, nfa, nullptr, output, alphabet);
+}
+
+void mata::parser::write_binary(
+	const Nfa& nfa, const std::filesystem::path& file, const OnTheFlyAlphabet* alphabet
+) {
+	write_automaton_to_file(Kind::Nfa, nfa, nullptr, file, alphabet);
+}
+
+void mata::parser::write_binary(const Nft& nft, std::ostream& output, const OnTheFlyAlphabet* alphabet) {
+	write_automaton(Kind::Nft, nft, &nft.levels, output, alphabet);
+}
+
+void mata::parser::write_binary(
+	const Nft& nft, const std::filesystem::path& file, const OnTheFlyAlphabet* alphabet
+) {
+	write_automaton_to_file(Kind::Nft, nft, &nft.levels, file, alphabet);
+}
+
+Nfa mata::parser::read_nfa_binary(const std::span<const std::byte> data, OnTheFlyAlphabet* alphabet) {
+	Nfa nfa{};
+	read_automaton(data, Kind::Nfa, nfa, nullptr, alphabet);
+	return nfa;
+}
+
+Nfa mata::parser::read_nfa_binary(std::istream& input, OnTheFlyAlphabet* alphabet) {
+	const std::vector<std::byte> data{read_stream(input)};
+	return read_nfa_binary(std::span<const std::byte>{data}, alphabet);
+}
+
+Nfa mata::parser::read_nfa_binary(const std::filesystem::path& file, OnTheFlyAlphabet* alphabet) {
+	return with_file_contents(file, [&](const std::span<const std::byte> data) {
+		return read_nfa_binary(data, alphabet);
+	});
+}
+
+Nft mata::parser::read_nft_binary(const std::span<const std::byte> data, OnTheFlyAlphabet* alphabet) {
+	Nft nft{};
+	read_automaton(data, Kind::Nft, nft, &nft.levels, alphabet);
+	return nft;
+}
+
+Nft mata::parser::read_nft_binary(std::istream& input, OnTheFlyAlphabet* alphabet) {
+	const std::vector<std::byte> data{read_stream(input)};
+	return read_nft_binary(std::span<const std::byte>{data}, alphabet);
+}
+
+Nft mata::parser::read_nft_binary(const std::filesystem::path& file, OnTheFlyAlphabet* alphabet) {
+	return with_file_contents(file, [&](const std::span<const std::byte> data) {
+		return read_nft_binary(data, alphabet);
+	});
+}
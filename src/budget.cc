@@ -0,0 +1,59 @@
+/* budget.cc -- Cancellation, time and memory budgets for the long-running operations
+ */
+
+#include <fstream>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "mata/utils/budget.hh"
+
+using namespace mata::utils;
+
+void Budget::check_states_and_cancellation(const size_t num_of_states) const {
+	if (is_cancelled()) { throw BudgetExhausted{BudgetExhausted::Reason::Cancelled, "operation was cancelled"}; }
+	if (num_of_states > max_states_) {
+		throw BudgetExhausted{
+			BudgetExhausted::Reason::States,
+			"operation exceeded the limit of " + std::to_string(max_states_) + " states"
+		};
+	}
+}
+
+void Budget::check_deadline_and_memory() const {
+	if (deadline_.has_value() && std::chrono::steady_clock::now() > *deadline_) {
+		throw BudgetExhausted{BudgetExhausted::Reason::Deadline, "operation exceeded the deadline"};
+	}
+	if (max_memory_ != std::numeric_limits<size_t>::max()) {
+		if (const size_t memory{get_resident_memory()}; memory > max_memory_) {
+			throw BudgetExhausted{
+				BudgetExhausted::Reason::Memory,
+				"resident memory of " + std::to_string(memory) + " bytes exceeded the limit of " +
+					std::to_string(max_memory_) + " bytes"
+			};
+		}
+	}
+}
+
+void Budget::check(const size_t num_of_states) const {
+	check_states_and_cancellation(num_of_states);
+	check_deadline_and_memory();
+}
+
+void Budget::poll_active(const size_t num_of_states) {
+	check_states_and_cancellation(num_of_states);
+	if (++num_of_polls_ % CHECK_PERIOD == 0) { check_deadline_and_memory(); }
+}
+
+size_t Budget::get_resident_memory() {
+#ifdef __linux__
+	std::ifstream statm{"/proc/self/statm"};
+	size_t num_of_pages{0};
+	size_t num_of_resident_pages{0};
+	if (!(statm >> num_of_pages >> num_of_resident_pages)) { return 0; }
+	return num_of_resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+	return 0;
+#endif
+}
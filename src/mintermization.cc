@@ -7,7 +7,9 @@
 #include <cassert>
 
 #include "mata/parser/mintermization.hh"
+#include "mata/utils/parallel.hh"
 
+#include <memory>
 #include <ranges>
 
 namespace {
@@ -40,6 +42,75 @@ const mata::FormulaGraph* detect_state_part(const mata::FormulaGraph* node) {
 
 	return nullptr;
 }
+
+void check_mintermizable(const mata::IntermediateAut& aut) {
+	if ((!aut.is_nfa() && !aut.is_afa()) || aut.alphabet_type != mata::IntermediateAut::AlphabetType::Bitvector) {
+		throw std::runtime_error("We currently support mintermization only for NFA and AFA with bitvectors");
+	}
+}
+
+/**
+ * Refine @p minterms by @p predicate. A minterm split by @p predicate keeps its part inside @p predicate at its
+ * position, and its part outside @p predicate is appended (with the position of the split minterm appended to
+ * @p parents, if given).
+ */
+void refine_by(std::vector<BDD>& minterms, const BDD& predicate, std::vector<size_t>* parents = nullptr) {
+	const BDD negated_predicate{!predicate};
+	const size_t num_of_minterms{minterms.size()};
+	for (size_t index{0}; index < num_of_minterms; ++index) {
+		// Only minterms neither contained in nor disjoint with the predicate are split.
+		BDD inside{minterms[index] * predicate};
+		if (inside.IsZero() || inside == minterms[index]) { continue; }
+		BDD outside{minterms[index] * negated_predicate};
+		minterms[index] = inside;
+		minterms.push_back(outside);
+		if (parents != nullptr) { parents->push_back(index); }
+	}
+}
+
+/**
+ * Check whether @p predicate can split some minterms not yet refined by @p processed_predicates, and add it with its
+ * negation (which splits the same minterms) to @p processed_predicates.
+ */
+bool is_new_predicate(const BDD& predicate, std::unordered_set<BDD>& processed_predicates) {
+	if (predicate.IsOne() || predicate.IsZero() || !processed_predicates.insert(predicate).second) { return false; }
+	processed_predicates.insert(!predicate);
+	return true;
+}
+
+/// Create a copy of @p aut without transitions with an explicit alphabet for the mintermized transitions.
+mata::IntermediateAut create_mintermized_copy(const mata::IntermediateAut& aut) {
+	mata::IntermediateAut mintermized_aut = aut;
+	mintermized_aut.alphabet_type = mata::IntermediateAut::AlphabetType::Explicit;
+	mintermized_aut.transitions.clear();
+	return mintermized_aut;
+}
+
+/// Collect the names of symbols (variables of bitvectors) in transitions of @p auts in the order of occurrence.
+std::vector<std::string> collect_symbol_names(const std::vector<const mata::IntermediateAut*>& auts) {
+	std::vector<std::string> symbol_names{};
+	std::unordered_set<std::string> seen_names{};
+	std::vector<const mata::FormulaGraph*> worklist{};
+	for (const mata::IntermediateAut* aut : auts) {
+		for (const mata::FormulaGraph& formula_graph : aut->transitions | std::views::values) {
+			worklist.push_back(&formula_graph);
+			while (!worklist.empty()) {
+				const mata::FormulaGraph* graph{worklist.back()};
+				worklist.pop_back();
+				const mata::FormulaNode& node{graph->node};
+				if (node.is_operand() && !node.is_state() && !node.is_constant() &&
+					seen_names.insert(node.name).second) {
+					symbol_names.push_back(node.name);
+				}
+				// Push the children in reverse to visit them from left to right.
+				for (auto child{graph->children.rbegin()}; child != graph->children.rend(); ++child) {
+					worklist.push_back(&*child);
+				}
+			}
+		}
+	}
+	return symbol_names;
+}
 } // namespace
 
 void mata::Mintermization::trans_to_bdd_nfa(const IntermediateAut& aut) {
@@ -103,22 +174,32 @@ void mata::Mintermization::trans_to_bdd_afa(const IntermediateAut& aut) {
 }
 
 std::unordered_set<BDD> mata::Mintermization::compute_minterms(const std::unordered_set<BDD>& source_bdds) const {
-	std::unordered_set<BDD> stack{bdd_mng_.bddOne()};
-	for (const BDD& b : source_bdds) {
-		std::unordered_set<BDD> next;
-		/**
-		 * TODO: Possible optimization - we can remember which transition belongs to the currently processed bdds
-		 * and mintermize automaton somehow directly here. However, it would be better to do such optimization
-		 * in copy of this function and this one keep clean and straightforward.
-		 */
-		for (const auto& minterm : stack) {
-			if (BDD b1 = minterm * b; !b1.IsZero()) { next.insert(b1); }
-			if (BDD b0 = minterm * !b; !b0.IsZero()) { next.insert(b0); }
-		}
-		stack = next;
+	std::vector<BDD> minterms{bdd_mng_.bddOne()};
+	std::unordered_set<BDD> processed_bdds{};
+	for (const BDD& bdd : source_bdds) {
+		if (is_new_predicate(bdd, processed_bdds)) { refine_by(minterms, bdd); }
+	}
+	return {minterms.begin(), minterms.end()};
+}
+
+const std::vector<BDD>& mata::Mintermization::refine_minterms(const std::unordered_set<BDD>& predicates) {
+	if (minterms_.empty()) {
+		minterms_.push_back(bdd_mng_.bddOne());
+		minterm_parents_.push_back(0);
+	}
+	for (const BDD& predicate : predicates) {
+		if (is_new_predicate(predicate, refined_predicates_)) { refine_by(minterms_, predicate, &minterm_parents_); }
 	}
+	return minterms_;
+}
 
-	return stack;
+std::vector<size_t> mata::Mintermization::get_minterm_origins(const size_t num_of_minterms) const {
+	// Minterms are always split from minterms at lower positions.
+	std::vector<size_t> origins(minterms_.size());
+	for (size_t minterm{0}; minterm < minterms_.size(); ++minterm) {
+		origins[minterm] = minterm < num_of_minterms ? minterm : origins[minterm_parents_[minterm]];
+	}
+	return origins;
 }
 
 mata::Mintermization::OptionalBdd mata::Mintermization::graph_to_bdd_afa(const FormulaGraph& graph) {
@@ -192,33 +273,44 @@ BDD mata::Mintermization::graph_to_bdd_nfa(const FormulaGraph& graph) {
 void mata::Mintermization::minterms_to_aut_nfa(
 	IntermediateAut& res, const IntermediateAut& aut, const std::unordered_set<BDD>& minterms
 ) {
-	for (const auto& [formula_node, formula_graph] : aut.transitions) {
-		// for each t=(q1,s,q2)
-		const auto& symbol_part = formula_graph.children[0];
-
-		size_t symbol = 0;
-		if (!trans_to_bddvar_.contains(&symbol_part)) {
-			continue; // Transition had zero bdd so it was not added to map
-		}
-		const BDD& bdd = trans_to_bddvar_[&symbol_part];
-
-		for (const auto& minterm : minterms) {
-			// for each minterm x:
-			if (!((bdd * minterm).IsZero())) {
-				// if for symbol s of t is BDD_s < x
-				// add q1,x,q2 to transitions
-				IntermediateAut::parse_transition(
-					res, {formula_node.raw, std::to_string(symbol), formula_graph.children[1].node.raw}
-				);
-			}
-			symbol++;
-		}
-	}
+	minterms_to_aut(res, aut, std::vector<BDD>(minterms.begin(), minterms.end()));
 }
 
 void mata::Mintermization::minterms_to_aut_afa(
 	IntermediateAut& res, const IntermediateAut& aut, const std::unordered_set<BDD>& minterms
 ) {
+	minterms_to_aut(res, aut, std::vector<BDD>(minterms.begin(), minterms.end()));
+}
+
+void mata::Mintermization::minterms_to_aut(
+	IntermediateAut& res, const IntermediateAut& aut, const std::vector<BDD>& minterms
+) {
+	if (aut.is_nfa()) {
+		for (const auto& [formula_node, formula_graph] : aut.transitions) {
+			// for each t=(q1,s,q2)
+			const auto& symbol_part = formula_graph.children[0];
+
+			size_t symbol = 0;
+			if (!trans_to_bddvar_.contains(&symbol_part)) {
+				continue; // Transition had zero bdd so it was not added to map
+			}
+			const BDD& bdd = trans_to_bddvar_[&symbol_part];
+
+			for (const auto& minterm : minterms) {
+				// for each minterm x:
+				if (!((bdd * minterm).IsZero())) {
+					// if for symbol s of t is BDD_s < x
+					// add q1,x,q2 to transitions
+					IntermediateAut::parse_transition(
+						res, {formula_node.raw, std::to_string(symbol), formula_graph.children[1].node.raw}
+					);
+				}
+				symbol++;
+			}
+		}
+		return;
+	}
+
 	for (const auto& formula_node : aut.transitions | std::views::keys) {
 		for (const auto& [disjunct, formula_graph] : lhs_to_disjuncts_and_states_[&formula_node]) {
 			// for each t=(q1,s,q2)
@@ -249,16 +341,19 @@ void mata::Mintermization::minterms_to_aut_afa(
 	}
 }
 
+void mata::Mintermization::create_bdd_vars(const std::vector<std::string>& symbol_names) {
+	for (size_t index{0}; index < symbol_names.size(); ++index) {
+		symbol_to_bddvar_[symbol_names[index]] = bdd_mng_.bddVar(static_cast<int>(index));
+	}
+}
+
 mata::IntermediateAut mata::Mintermization::mintermize(const IntermediateAut& aut) {
 	return mintermize(std::vector<const IntermediateAut*>{&aut})[0];
 }
 
 std::vector<mata::IntermediateAut> mata::Mintermization::mintermize(const std::vector<const IntermediateAut*>& auts) {
 	for (const IntermediateAut* aut : auts) {
-		if ((!aut->is_nfa() && !aut->is_afa()) || aut->alphabet_type != IntermediateAut::AlphabetType::Bitvector) {
-			throw std::runtime_error("We currently support mintermization only for NFA and AFA with bitvectors");
-		}
-
+		check_mintermizable(*aut);
 		aut->is_nfa() ? trans_to_bdd_nfa(*aut) : trans_to_bdd_afa(*aut);
 	}
 
@@ -289,6 +384,91 @@ std::vector<mata::IntermediateAut> mata::Mintermization::mintermize(const std::v
 	return mintermize(auts_pointers);
 }
 
+std::vector<mata::IntermediateAut> mata::Mintermization::mintermize(
+	const std::vector<const IntermediateAut*>& auts, size_t num_of_threads
+) {
+	num_of_threads = utils::get_num_of_threads(num_of_threads, auts.size());
+	if (num_of_threads == 1) { return mintermize(auts); }
+	for (const IntermediateAut* aut : auts) { check_mintermizable(*aut); }
+
+	// Each thread handles a contiguous chunk of automata with its own manager.
+	const std::vector<std::string> symbol_names{collect_symbol_names(auts)};
+	std::vector<std::unique_ptr<Mintermization>> workers{};
+	std::vector<std::vector<BDD>> worker_minterms(num_of_threads);
+	auto chunk_begin = [&](const size_t worker) { return auts.size() * worker / num_of_threads; };
+
+	for (size_t worker{0}; worker < num_of_threads; ++worker) { workers.push_back(std::make_unique<Mintermization>()); }
+	utils::parallel_for(num_of_threads, num_of_threads, [&](size_t, const size_t worker) {
+		Mintermization& mintermization{*workers[worker]};
+		mintermization.create_bdd_vars(symbol_names);
+		for (size_t index{chunk_begin(worker)}; index < chunk_begin(worker + 1); ++index) {
+			auts[index]->is_nfa() ? mintermization.trans_to_bdd_nfa(*auts[index])
+								  : mintermization.trans_to_bdd_afa(*auts[index]);
+		}
+		const std::unordered_set<BDD> minterms{mintermization.compute_minterms(mintermization.bdds_)};
+		worker_minterms[worker].assign(minterms.begin(), minterms.end());
+	});
+
+	// The minterms of all automata are the non-empty intersections of the minterms of the threads.
+	create_bdd_vars(symbol_names);
+	std::vector<BDD> minterms{bdd_mng_.bddOne()};
+	for (const std::vector<BDD>& thread_minterms : worker_minterms) {
+		std::vector<BDD> next_minterms{};
+		for (const BDD& thread_minterm : thread_minterms) {
+			const BDD transferred_minterm{thread_minterm.Transfer(bdd_mng_)};
+			for (const BDD& minterm : minterms) {
+				if (BDD intersection = minterm * transferred_minterm; !intersection.IsZero()) {
+					next_minterms.push_back(intersection);
+				}
+			}
+		}
+		minterms = std::move(next_minterms);
+	}
+	// Managers are not thread-safe, so the minterms are transferred to the managers of the threads sequentially.
+	for (size_t worker{0}; worker < num_of_threads; ++worker) {
+		worker_minterms[worker].clear();
+		for (const BDD& minterm : minterms) {
+			worker_minterms[worker].push_back(minterm.Transfer(workers[worker]->bdd_mng_));
+		}
+	}
+
+	std::vector<IntermediateAut> res(auts.size());
+	utils::parallel_for(num_of_threads, num_of_threads, [&](size_t, const size_t worker) {
+		Mintermization& mintermization{*workers[worker]};
+		for (size_t index{chunk_begin(worker)}; index < chunk_begin(worker + 1); ++index) {
+			res[index] = create_mintermized_copy(*auts[index]);
+			mintermization.minterms_to_aut(res[index], *auts[index], worker_minterms[worker]);
+		}
+	});
+	return res;
+}
+
+std::vector<mata::IntermediateAut> mata::Mintermization::mintermize_incrementally(
+	const std::vector<const IntermediateAut*>& auts
+) {
+	for (const IntermediateAut* aut : auts) {
+		check_mintermizable(*aut);
+		aut->is_nfa() ? trans_to_bdd_nfa(*aut) : trans_to_bdd_afa(*aut);
+	}
+	refine_minterms(bdds_);
+
+	std::vector<IntermediateAut> res;
+	res.reserve(auts.size());
+	for (const IntermediateAut* aut : auts) {
+		res.push_back(create_mintermized_copy(*aut));
+		minterms_to_aut(res.back(), *aut, minterms_);
+	}
+	return res;
+}
+
+std::vector<mata::IntermediateAut> mata::Mintermization::mintermize(
+	const std::vector<IntermediateAut>& auts, const size_t num_of_threads
+) {
+	std::vector<const IntermediateAut*> auts_pointers;
+	for (const IntermediateAut& aut : auts) { auts_pointers.push_back(&aut); }
+	return mintermize(auts_pointers, num_of_threads);
+}
+
 mata::Mintermization::OptionalBdd mata::Mintermization::OptionalBdd::operator*(const OptionalBdd& b) const {
 	if (this->type == Type::NothingE) {
 		return b;
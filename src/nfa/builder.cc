@@ -6,10 +6,15 @@
 #include "mata/nfa/builder.hh"
 #include "mata/parser/mintermization.hh"
 #include "mata/parser/re2parser.hh"
+#include "mata/utils/parallel.hh"
 
+#include <charconv>
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <random>
+#include <ranges>
+#include <sstream>
 
 using namespace mata::nfa;
 using mata::Symbol;
@@ -210,32 +215,131 @@ Nfa builder::create_random_nfa_tabakov_vardi(
 	};
 	for (size_t i = 0; i < num_of_final_states; ++i) { nfa.final.insert(states[i]); }
 
-	// Unique transition generator
-	std::vector<State> one_dimensional_transition_matrix(num_of_states * num_of_states);
-	std::iota(one_dimensional_transition_matrix.begin(), one_dimensional_transition_matrix.end(), 0);
-
 	// Create transitions
 	// Using std::min because, in some universe, casting and rounding might cause the number of transitions to exceed
-	// the number of possible transitions by 1 and then an access to the non-existing element of
-	// one_dimensional_transition_matrix would occur.
+	// the number of possible transitions by 1.
 	const size_t num_of_transitions_per_symbol{std::min(
 		static_cast<size_t>(std::round(static_cast<double>(num_of_states) * states_transitions_ratio_per_symbol)),
-		one_dimensional_transition_matrix.size()
+		num_of_states * num_of_states
 	)};
+	std::vector<State> sources{};
+	std::vector<Symbol> symbols{};
+	std::vector<State> targets{};
+	sources.reserve(num_of_transitions_per_symbol * alphabet_size);
+	symbols.reserve(num_of_transitions_per_symbol * alphabet_size);
+	targets.reserve(num_of_transitions_per_symbol * alphabet_size);
 	for (Symbol symbol{0}; symbol < alphabet_size; ++symbol) {
-		std::ranges::shuffle(one_dimensional_transition_matrix, gen);
-		for (size_t i = 0; i < num_of_transitions_per_symbol; ++i) {
-			const State source{one_dimensional_transition_matrix[i] / num_of_states};
-			const State target{one_dimensional_transition_matrix[i] % num_of_states};
-			nfa.delta.add(source, symbol, target);
+		// Sample distinct transitions from the (virtual) one-dimensional transition matrix.
+		for (const size_t transition :
+			 utils::sample_without_replacement(num_of_transitions_per_symbol, num_of_states * num_of_states, gen)) {
+			sources.push_back(transition / num_of_states);
+			symbols.push_back(symbol);
+			targets.push_back(transition % num_of_states);
 		}
 	}
+	nfa.delta.add(sources, symbols, targets);
 	return nfa;
 }
 
-Nfa builder::parse_from_mata(std::istream& nfa_stream) {
+Nfa builder::create_nth_from_last_nfa(const size_t n, const size_t alphabet_size, const Symbol symbol) {
+	if (n == 0) { throw std::runtime_error("Position from the end must be at least 1"); }
+	if (symbol >= alphabet_size) { throw std::runtime_error("Symbol must be in the alphabet"); }
+	Nfa nfa{n + 1, {0}, {n}};
+	for (Symbol any{0}; any < alphabet_size; ++any) {
+		nfa.delta.add(0, any, 0);
+		for (State state{1}; state < n; ++state) { nfa.delta.add(state, any, state + 1); }
+	}
+	nfa.delta.add(0, symbol, 1);
+	return nfa;
+}
+
+std::pair<Nfa, Nfa> builder::create_hard_inclusion_pair(
+	const size_t n, const size_t alphabet_size, const bool included
+) {
+	if (n == 0) { throw std::runtime_error("Length of the suffixes must be at least 1"); }
+	// The smaller NFA counts the length of the word up to its minimal accepted length.
+	const size_t min_length{included ? n : n - 1};
+	Nfa smaller{min_length + 1, {0}, {min_length}};
+	Nfa bigger{};
+	for (Symbol symbol{0}; symbol < alphabet_size; ++symbol) {
+		for (State state{0}; state < min_length; ++state) { smaller.delta.add(state, symbol, state + 1); }
+		smaller.delta.add(min_length, symbol, min_length);
+		bigger = union_nondet(bigger, create_nth_from_last_nfa(n, alphabet_size, symbol));
+	}
+	return {std::move(smaller), std::move(bigger)};
+}
+
+Nfa builder::create_epsilon_chain_nfa(
+	const size_t num_of_states,
+	const size_t alphabet_size,
+	const std::optional<unsigned int>& seed,
+	const Symbol epsilon
+) {
+	if (num_of_states == 0) { return Nfa{}; }
+	if (alphabet_size == 0) { throw std::runtime_error("Alphabet must not be empty"); }
+	Nfa nfa{num_of_states, {0}, {num_of_states - 1}};
+	std::mt19937 gen(seed.value_or(std::random_device{}()));
+	std::uniform_int_distribution<State> random_state{0, num_of_states - 1};
+	std::uniform_int_distribution<Symbol> random_symbol{0, static_cast<Symbol>(alphabet_size - 1)};
+	for (State state{0}; state < num_of_states; ++state) {
+		if (state + 1 < num_of_states) { nfa.delta.add(state, epsilon, state + 1); }
+		const Symbol symbol{random_symbol(gen)};
+		nfa.delta.add(state, symbol, random_state(gen));
+	}
+	return nfa;
+}
+
+namespace {
+/// Type of automata handled by @c builder::parse_from_mata_explicit().
+constexpr std::string_view EXPLICIT_NFA_TYPE{"@NFA-explicit"};
+/// Prefix of the names of minterms in @c builder::load_automata(), reserved so that they do not clash with symbols of
+///  explicit automata.
+constexpr std::string_view MINTERM_SYMBOL_PREFIX{"minterm:"};
+
+bool is_blank(const char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f'; }
+
+/**
+ * @brief Split @p line into tokens separated by blanks, stopping at a comment.
+ *
+ * @return False if @p line contains anything the explicit NFA fast path does not handle (quoting, escaping,
+ *  parentheses, formula operators, or a key or type not at the beginning of the line).
+ */
+bool tokenize_explicit_line(const std::string_view line, std::vector<std::string_view>& tokens) {
+	tokens.clear();
+	size_t position{0};
+	while (position < line.size()) {
+		if (is_blank(line[position])) {
+			++position;
+			continue;
+		}
+		if (line[position] == '#') { break; }
+		size_t end{position};
+		for (; end < line.size() && !is_blank(line[end]) && line[end] != '#'; ++end) {
+			switch (line[end]) {
+				case '"':
+				case '\\':
+				case '(':
+				case ')':
+				case '!':
+				case '&':
+				case '|': return false;
+				case '@':
+				case '%':
+					if (end != position || !tokens.empty()) { return false; }
+					break;
+				default: break;
+			}
+		}
+		tokens.push_back(line.substr(position, end - position));
+		position = end;
+	}
+	return true;
+}
+
+bool is_constant_name(const std::string_view name) { return name == "true" || name == "false"; }
+
+void check_parsed_nfa(const mata::parser::Parsed& parsed) {
 	const std::string nfa_str = "NFA";
-	const parser::Parsed parsed{parser::parse_mf(nfa_stream)};
 	if (parsed.size() != 1) {
 		throw std::runtime_error(
 			"The number of sections in the input file is '" + std::to_string(parsed.size()) + "'. Required is '1'.\n"
@@ -244,27 +348,316 @@ Nfa builder::parse_from_mata(std::istream& nfa_stream) {
 	if (const std::string automaton_type{parsed[0].type}; automaton_type.compare(0, nfa_str.length(), nfa_str) != 0) {
 		throw std::runtime_error("The type of input automaton is '" + automaton_type + "'. Required is 'NFA'\n");
 	}
-	IntAlphabet alphabet;
-	return construct(IntermediateAut::parse_from_mf(parsed)[0], &alphabet);
+}
+
+/// Hash of state names allowing to look up names stored as @c std::string by views.
+struct NameHash {
+	using is_transparent = void;
+	size_t operator()(const std::string_view name) const { return std::hash<std::string_view>{}(name); }
+};
+
+/**
+ * @brief Parser of plain explicit NFAs (see @c builder::parse_from_mata_explicit()) fed by the input line by line.
+ *
+ * @tparam Name Type of the stored state (and symbol) names: @c std::string_view if the whole input outlives the
+ *  parser, otherwise @c std::string.
+ */
+template <class Name> class ExplicitNfaParser {
+  public:
+	/**
+	 * @param input_size Length of the input if known, to estimate the number of transitions.
+	 * @param names_symbols Whether symbols are arbitrary names, numbered in the order of their first occurrence (see
+	 *  @c get_symbol_names()), instead of numbers.
+	 */
+	explicit ExplicitNfaParser(const size_t input_size = 0, const bool names_symbols = false)
+		: names_symbols_{names_symbols} {
+		// A rough estimate of the number of transitions from the length of the input, to avoid most reallocations.
+		transitions_.reserve(input_size / 16);
+	}
+
+	/// Parse the next @p line of the input. @return False if the input is not a plain explicit NFA.
+	bool parse_line(const std::string_view line) {
+		if (!tokenize_explicit_line(line, tokens_)) { return false; }
+		if (tokens_.empty()) { return true; }
+
+		if (!type_read_) {
+			if (tokens_.size() != 1 || tokens_[0] != EXPLICIT_NFA_TYPE) { return false; }
+			type_read_ = true;
+		} else if (tokens_[0][0] == '@') {
+			return false;
+		} else if (tokens_[0][0] == '%') {
+			const std::string_view key{tokens_[0].substr(1)};
+			std::vector<State>* states{nullptr};
+			if (key == "Initial") {
+				states = &initial_states_;
+			} else if (key == "Final") {
+				states = &final_states_;
+			} else if (key != "Alphabet-auto" || tokens_.size() != 1) {
+				return false;
+			}
+			for (size_t index{1}; index < tokens_.size(); ++index) {
+				if (is_constant_name(tokens_[index])) { return false; }
+				states->push_back(get_state(tokens_[index]));
+			}
+		} else {
+			if (tokens_.size() != 3 || is_constant_name(tokens_[0]) || is_constant_name(tokens_[2])) { return false; }
+			Symbol symbol;
+			const std::string_view symbol_name{tokens_[1]};
+			if (names_symbols_) {
+				symbol = get_symbol(symbol_name);
+			} else {
+				const auto [symbol_end, error]{
+					std::from_chars(symbol_name.data(), symbol_name.data() + symbol_name.size(), symbol)
+				};
+				if (error != std::errc{} || symbol_end != symbol_name.data() + symbol_name.size()) { return false; }
+			}
+			const State source{get_state(tokens_[0])};
+			transitions_.emplace_back(source, symbol, get_state(tokens_[2]));
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Build the NFA from the lines parsed so far.
+	 *
+	 * @param state_map If specified, filled with the mapping of state names to states.
+	 * @return Parsed NFA, or @c std::nullopt if no automaton type was read.
+	 */
+	std::optional<Nfa> finish(builder::NameStateMap* state_map = nullptr) {
+		if (!type_read_) { return std::nullopt; }
+
+		Nfa nfa{};
+		nfa.delta = Delta(state_names_.size());
+		nfa.initial.reserve(state_names_.size());
+		for (const State state : initial_states_) { nfa.initial.insert(state); }
+		nfa.final.reserve(state_names_.size());
+		for (const State state : final_states_) { nfa.final.insert(state); }
+
+		// Add the transitions in sorted order, so that the symbol posts and targets are appended without searching.
+		std::ranges::sort(transitions_);
+		for (auto transition{transitions_.begin()}; transition != transitions_.end();) {
+			const State source{transition->source};
+			StatePost& state_post{nfa.delta.mutable_state_post(source)};
+			while (transition != transitions_.end() && transition->source == source) {
+				const Symbol symbol{transition->symbol};
+				SymbolPost& symbol_post{state_post.emplace_back(symbol)};
+				for (; transition != transitions_.end() && transition->source == source && transition->symbol == symbol;
+					 ++transition) {
+					if (symbol_post.targets.empty() || transition->target != (transition - 1)->target) {
+						symbol_post.targets.push_back(transition->target);
+					}
+				}
+			}
+		}
+
+		if (state_map != nullptr) {
+			for (const auto& [name, state] : state_names_) { state_map->insert_or_assign(std::string{name}, state); }
+		}
+		return nfa;
+	}
+
+	/// Get the names of the symbols, indexed by the symbols, if the symbols are names.
+	const std::vector<Name>& get_symbol_names() const { return symbol_names_; }
+
+  private:
+	/// Get the symbol named @p name, numbering the symbols in the order of their first occurrence.
+	Symbol get_symbol(const std::string_view name) {
+		if (const auto symbol_it{symbol_ids_.find(name)}; symbol_it != symbol_ids_.end()) { return symbol_it->second; }
+		symbol_names_.emplace_back(name);
+		return symbol_ids_.emplace(Name{name}, symbol_names_.size() - 1).first->second;
+	}
+
+	/// Get the state named @p name, numbering the states in the order of their first occurrence.
+	State get_state(const std::string_view name) {
+		if (const auto state_it{state_names_.find(name)}; state_it != state_names_.end()) { return state_it->second; }
+		return state_names_.emplace(Name{name}, state_names_.size()).first->second;
+	}
+
+	std::unordered_map<Name, State, NameHash, std::equal_to<>> state_names_{};
+	bool names_symbols_;
+	std::unordered_map<Name, Symbol, NameHash, std::equal_to<>> symbol_ids_{};
+	std::vector<Name> symbol_names_{};
+	std::vector<State> initial_states_{};
+	std::vector<State> final_states_{};
+	std::vector<Transition> transitions_{};
+	std::vector<std::string_view> tokens_{};
+	bool type_read_{false};
+};
+
+Nfa parse_from_mata_generic(std::istream& nfa_stream) {
+	const mata::parser::Parsed parsed{mata::parser::parse_mf(nfa_stream)};
+	check_parsed_nfa(parsed);
+	mata::IntAlphabet alphabet;
+	return builder::construct(mata::IntermediateAut::parse_from_mf(parsed)[0], &alphabet);
+}
+
+} // namespace
+
+std::optional<Nfa> builder::parse_from_mata_explicit(const std::string_view nfa_in_mata, NameStateMap* state_map) {
+	// The state names are views into the input.
+	ExplicitNfaParser<std::string_view> parser{nfa_in_mata.size()};
+	for (size_t line_begin{0}; line_begin < nfa_in_mata.size();) {
+		const size_t line_end{std::min(nfa_in_mata.find('\n', line_begin), nfa_in_mata.size())};
+		if (!parser.parse_line(nfa_in_mata.substr(line_begin, line_end - line_begin))) { return std::nullopt; }
+		line_begin = line_end + 1;
+	}
+	return parser.finish(state_map);
+}
+
+Nfa builder::parse_from_mata(std::istream& nfa_stream) {
+	// Plain explicit NFAs are parsed line by line. On any other input, the generic parser parses the input from its
+	//  beginning: the stream is rewound if it supports seeking, otherwise the lines read so far are kept for it.
+	const std::istream::pos_type begin{nfa_stream.tellg()};
+	const bool is_seekable{begin != std::istream::pos_type(-1)};
+	ExplicitNfaParser<std::string> parser{};
+	std::string read_lines{};
+	for (std::string line{}; std::getline(nfa_stream, line);) {
+		if (!is_seekable) { read_lines.append(line).push_back('\n'); }
+		if (!parser.parse_line(line)) {
+			if (is_seekable) {
+				nfa_stream.clear();
+				nfa_stream.seekg(begin);
+				return parse_from_mata_generic(nfa_stream);
+			}
+			read_lines.append(std::istreambuf_iterator<char>{nfa_stream}, std::istreambuf_iterator<char>{});
+			std::istringstream generic_stream{read_lines};
+			return parse_from_mata_generic(generic_stream);
+		}
+	}
+	if (std::optional<Nfa> nfa{parser.finish()}) { return std::move(*nfa); }
+	if (is_seekable) {
+		nfa_stream.clear();
+		nfa_stream.seekg(begin);
+		return parse_from_mata_generic(nfa_stream);
+	}
+	std::istringstream generic_stream{read_lines};
+	return parse_from_mata_generic(generic_stream);
 }
 
 Nfa builder::parse_from_mata(const std::filesystem::path& nfa_file) {
-	std::ifstream file_stream{nfa_file};
+	std::ifstream file_stream{nfa_file, std::ios::binary};
 	if (!file_stream) { throw std::runtime_error("Could not open file \'" + nfa_file.string() + "'\n"); }
 
-	Nfa nfa;
-	try {
-		nfa = parse_from_mata(file_stream);
-	} catch (const std::exception& ex) {
-		file_stream.close();
-		throw;
-	}
-	return nfa;
+	// Read the whole file at once for the single-pass parser.
+	std::string nfa_in_mata(std::filesystem::file_size(nfa_file), '\0');
+	file_stream.read(nfa_in_mata.data(), static_cast<std::streamsize>(nfa_in_mata.size()));
+	nfa_in_mata.resize(static_cast<size_t>(file_stream.gcount()));
+	return parse_from_mata(nfa_in_mata);
 }
 
 Nfa builder::parse_from_mata(const std::string& nfa_in_mata) {
+	if (std::optional<Nfa> nfa{parse_from_mata_explicit(nfa_in_mata)}) { return std::move(*nfa); }
 	std::istringstream nfa_stream(nfa_in_mata);
-	return parse_from_mata(nfa_stream);
+	return parse_from_mata_generic(nfa_stream);
+}
+
+std::vector<Nfa> builder::load_automata(
+	const std::vector<std::filesystem::path>& nfa_files, OnTheFlyAlphabet& alphabet, size_t num_of_threads
+) {
+	num_of_threads = utils::get_num_of_threads(num_of_threads, nfa_files.size());
+
+	// Plain explicit NFAs are parsed by the single-pass parser, with their symbols numbered in the order of their first
+	//  occurrence and their original names kept. The other NFAs are parsed by the generic parser into intermediate
+	//  automata.
+	std::vector<std::optional<Nfa>> explicit_nfas(nfa_files.size());
+	std::vector<std::vector<std::string>> explicit_symbol_names(nfa_files.size());
+	std::vector<IntermediateAut> inter_auts(nfa_files.size());
+	utils::parallel_for(nfa_files.size(), num_of_threads, [&](size_t, const size_t index) {
+		std::ifstream file_stream{nfa_files[index]};
+		if (!file_stream) { throw std::runtime_error("Could not open file \'" + nfa_files[index].string() + "'\n"); }
+		const std::string content{std::istreambuf_iterator<char>{file_stream}, std::istreambuf_iterator<char>{}};
+		const std::string_view content_view{content};
+		ExplicitNfaParser<std::string_view> explicit_parser{content.size(), true};
+		bool is_explicit{true};
+		for (size_t line_begin{0}; is_explicit && line_begin < content.size();) {
+			const size_t line_end{std::min(content.find('\n', line_begin), content.size())};
+			is_explicit = explicit_parser.parse_line(content_view.substr(line_begin, line_end - line_begin));
+			line_begin = line_end + 1;
+		}
+		if (is_explicit) { explicit_nfas[index] = explicit_parser.finish(); }
+		if (explicit_nfas[index].has_value()) {
+			explicit_symbol_names[index].assign(
+				explicit_parser.get_symbol_names().begin(), explicit_parser.get_symbol_names().end()
+			);
+			return;
+		}
+		std::istringstream content_stream{content};
+		const parser::Parsed parsed{parser::parse_mf(content_stream)};
+		check_parsed_nfa(parsed);
+		inter_auts[index] = IntermediateAut::parse_from_mf(parsed)[0];
+	});
+
+	std::vector<size_t> bitvector_indices{};
+	std::vector<const IntermediateAut*> bitvector_auts{};
+	for (size_t index{0}; index < inter_auts.size(); ++index) {
+		if (!explicit_nfas[index].has_value() && inter_auts[index].is_bitvector()) {
+			bitvector_indices.push_back(index);
+			bitvector_auts.push_back(&inter_auts[index]);
+		}
+	}
+	if (!bitvector_auts.empty()) {
+		Mintermization mintermization{};
+		std::vector<IntermediateAut> mintermized{mintermization.mintermize(bitvector_auts, num_of_threads)};
+		for (size_t index{0}; index < bitvector_indices.size(); ++index) {
+			// The minterms are named by their numbers, which would clash with the numeric symbols of explicit NFAs.
+			for (FormulaGraph& formula_graph : mintermized[index].transitions | std::views::values) {
+				if (formula_graph.children.size() != 2) { continue; }
+				FormulaNode& symbol_node{formula_graph.children[0].node};
+				symbol_node.name = std::string{MINTERM_SYMBOL_PREFIX} + symbol_node.name;
+				symbol_node.raw = symbol_node.name;
+			}
+			inter_auts[bitvector_indices[index]] = std::move(mintermized[index]);
+		}
+	}
+
+	// Translate all symbols sequentially so that they are numbered in the order of the files. The automata are then
+	//  constructed in parallel, each thread with its own copy of the (from now on unchanged) alphabet.
+	const auto translate_explicit_symbol = [](Alphabet& symbol_alphabet, const std::string& name) {
+		if (name.starts_with(MINTERM_SYMBOL_PREFIX)) {
+			throw std::runtime_error(
+				"Symbol '" + name + "' clashes with the names of minterms starting with '" +
+				std::string{MINTERM_SYMBOL_PREFIX} + "'"
+			);
+		}
+		return symbol_alphabet.translate_symb(name);
+	};
+	for (size_t index{0}; index < nfa_files.size(); ++index) {
+		if (explicit_nfas[index].has_value()) {
+			for (const std::string& name : explicit_symbol_names[index]) { translate_explicit_symbol(alphabet, name); }
+			continue;
+		}
+		const bool is_bitvector{std::ranges::binary_search(bitvector_indices, index)};
+		for (const FormulaGraph& formula_graph : inter_auts[index].transitions | std::views::values) {
+			if (formula_graph.children.size() != 2) { continue; }
+			const std::string& name{formula_graph.children[0].node.name};
+			if (is_bitvector) {
+				alphabet.translate_symb(name);
+			} else {
+				translate_explicit_symbol(alphabet, name);
+			}
+		}
+	}
+	std::vector<OnTheFlyAlphabet> thread_alphabets(num_of_threads, alphabet);
+	std::vector<Nfa> nfas(nfa_files.size());
+	utils::parallel_for(inter_auts.size(), num_of_threads, [&](const size_t thread_index, const size_t index) {
+		OnTheFlyAlphabet& thread_alphabet{thread_alphabets[thread_index]};
+		if (!explicit_nfas[index].has_value()) {
+			nfas[index] = construct(inter_auts[index], &thread_alphabet);
+			return;
+		}
+		// The symbols of the explicit NFA (indices to its symbol names) are translated by their names, as the generic
+		//  parser would.
+		const Nfa& explicit_nfa{*explicit_nfas[index]};
+		const std::vector<std::string>& symbol_names{explicit_symbol_names[index]};
+		Nfa& nfa{nfas[index]};
+		nfa = Nfa{explicit_nfa.num_of_states(), explicit_nfa.initial, explicit_nfa.final};
+		for (const Transition& transition : explicit_nfa.delta.transitions()) {
+			nfa.delta.add(
+				transition.source, thread_alphabet.translate_symb(symbol_names[transition.symbol]), transition.target
+			);
+		}
+	});
+	return nfas;
 }
 
 Nfa builder::create_from_regex(const std::string& regex) { return parser::create_nfa(regex); }
@@ -1,8 +1,13 @@
 /* nfa-complement.cc -- NFA complement
  */
 
+#include <algorithm>
+#include <deque>
+#include <vector>
+
 // MATA headers
 #include "mata/nfa/algorithms.hh"
+#include "mata/nfa/complement.hh"
 #include "mata/nfa/nfa.hh"
 
 using namespace mata::nfa;
@@ -50,3 +55,257 @@ Nfa mata::nfa::complement(const Nfa& aut, const OrdVector<mata::Symbol>& symbols
 
 	return algo(aut, symbols);
 }
+
+bool ImplicitComplement::is_in_lang(const Run& run) const {
+	if (dfa.initial.empty()) { return false; }
+	State state{*dfa.initial.begin()};
+	for (auto symbol_it{run.word.begin()}; symbol_it != run.word.end(); ++symbol_it) {
+		if (!symbols.contains(*symbol_it)) { return false; }
+		const StatePost& state_post{dfa.delta[state]};
+		const auto symbol_post_it{state_post.find(*symbol_it)};
+		if (symbol_post_it == state_post.end()) { // Entering the sink.
+			return std::all_of(std::next(symbol_it), run.word.end(), [&](const Symbol symbol) {
+				return symbols.contains(symbol);
+			});
+		}
+		state = *symbol_post_it->targets.begin();
+	}
+	return dfa.final.contains(state);
+}
+
+bool ImplicitComplement::is_lang_empty(Run* const cex) const {
+	// Breadth-first search for a final state or a state with a transition into the sink.
+	std::vector<std::optional<std::pair<State, Symbol>>> predecessors(dfa.num_of_states());
+	std::vector<bool> visited(dfa.num_of_states(), false);
+	std::deque<State> worklist{};
+	for (const State initial_state : dfa.initial) {
+		visited[initial_state] = true;
+		worklist.push_back(initial_state);
+	}
+
+	const auto make_cex = [&](State state, std::optional<Symbol> sink_symbol) {
+		if (cex == nullptr) { return; }
+		cex->word.clear();
+		cex->path.clear();
+		if (sink_symbol.has_value()) { cex->word.push_back(*sink_symbol); }
+		cex->path.push_back(state);
+		while (predecessors[state].has_value()) {
+			cex->word.push_back(predecessors[state]->second);
+			state = predecessors[state]->first;
+			cex->path.push_back(state);
+		}
+		std::ranges::reverse(cex->word);
+		std::ranges::reverse(cex->path);
+	};
+
+	while (!worklist.empty()) {
+		const State state{worklist.front()};
+		worklist.pop_front();
+		if (dfa.final.contains(state)) {
+			make_cex(state, std::nullopt);
+			return false;
+		}
+		const StatePost& state_post{dfa.delta[state]};
+		if (state_post.size() < symbols.size()) { // Some symbol leads to the sink.
+			auto symbol_post_it{state_post.begin()};
+			auto symbol_it{symbols.begin()};
+			while (symbol_post_it != state_post.end() && symbol_post_it->symbol == *symbol_it) {
+				++symbol_post_it;
+				++symbol_it;
+			}
+			make_cex(state, *symbol_it);
+			return false;
+		}
+		for (const SymbolPost& symbol_post : state_post) {
+			const State target{*symbol_post.targets.begin()};
+			if (!visited[target]) {
+				visited[target] = true;
+				predecessors[target] = std::make_pair(state, symbol_post.symbol);
+				worklist.push_back(target);
+			}
+		}
+	}
+	return true;
+}
+
+Nfa ImplicitComplement::to_nfa() const {
+	Nfa result{dfa};
+	const State sink{result.num_of_states()};
+	if (result.make_complete(symbols, sink)) { result.final.insert(sink); }
+	return result;
+}
+
+ImplicitComplement mata::nfa::complement_implicit(const Nfa& aut, const OrdVector<Symbol>& symbols) {
+	// Trimming makes the empty macrostate the only macrostate accepting no word, so the macrostates equivalent to the
+	//  sink are never constructed.
+	Nfa trimmed{aut};
+	trimmed.trim();
+
+	ImplicitComplement result{Nfa{}, symbols};
+	Nfa& dfa{result.dfa};
+	std::unordered_map<StateSet, State> subset_map{};
+	std::vector<std::pair<State, StateSet>> worklist{};
+	const auto get_state = [&](StateSet&& macrostate) {
+		if (const auto subset_it{subset_map.find(macrostate)}; subset_it != subset_map.end()) {
+			return subset_it->second;
+		}
+		const State state{dfa.add_state()};
+		if (!trimmed.final.intersects_with(macrostate)) { dfa.final.insert(state); }
+		subset_map.emplace(macrostate, state);
+		worklist.emplace_back(state, std::move(macrostate));
+		return state;
+	};
+	dfa.initial.insert(get_state(StateSet{trimmed.initial}));
+
+	SynchronizedExistentialSymbolPostIterator synchronized_iterator{};
+	while (!worklist.empty()) {
+		const auto [state, macrostate]{std::move(worklist.back())};
+		worklist.pop_back();
+		synchronized_iterator.reset();
+		for (const State orig_state : macrostate) { push_back(synchronized_iterator, trimmed.delta[orig_state]); }
+		while (synchronized_iterator.advance()) {
+			const Symbol symbol{(*synchronized_iterator.get_current().begin())->symbol};
+			if (!symbols.contains(symbol)) { continue; }
+			const State target{get_state(synchronized_iterator.unify_targets())};
+			// Symbols are processed in the increasing order.
+			dfa.delta.mutable_state_post(state).push_back(SymbolPost{symbol, target});
+		}
+	}
+	return result;
+}
+
+Nfa mata::nfa::intersection(
+	const Nfa& lhs, const ImplicitComplement& rhs, std::unordered_map<std::pair<State, State>, State>* prod_map
+) {
+	const State sink{rhs.dfa.num_of_states()};
+	const StatePost sink_state_post{}; // Transitions over all symbols are implicit.
+	Nfa product{};
+	std::unordered_map<std::pair<State, State>, State> product_map_local{};
+	if (prod_map == nullptr) { prod_map = &product_map_local; }
+	std::deque<std::pair<State, State>> worklist{};
+	const auto get_state = [&](const State lhs_state, const State rhs_state) {
+		const auto [product_it, inserted]{prod_map->try_emplace({lhs_state, rhs_state}, product.num_of_states())};
+		if (inserted) {
+			product.add_state();
+			if (lhs.final.contains(lhs_state) && (rhs_state == sink || rhs.dfa.final.contains(rhs_state))) {
+				product.final.insert(product_it->second);
+			}
+			worklist.emplace_back(lhs_state, rhs_state);
+		}
+		return product_it->second;
+	};
+	for (const State lhs_initial : lhs.initial) {
+		for (const State rhs_initial : rhs.dfa.initial) { product.initial.insert(get_state(lhs_initial, rhs_initial)); }
+	}
+
+	while (!worklist.empty()) {
+		const auto [lhs_state, rhs_state]{worklist.front()};
+		worklist.pop_front();
+		const State source{prod_map->at({lhs_state, rhs_state})};
+		const StatePost& rhs_state_post{rhs_state == sink ? sink_state_post : rhs.dfa.delta[rhs_state]};
+		auto rhs_symbol_post_it{rhs_state_post.begin()};
+		for (const SymbolPost& lhs_symbol_post : lhs.delta[lhs_state]) {
+			while (rhs_symbol_post_it != rhs_state_post.end() && rhs_symbol_post_it->symbol < lhs_symbol_post.symbol) {
+				++rhs_symbol_post_it;
+			}
+			State rhs_target{sink};
+			if (rhs_symbol_post_it != rhs_state_post.end() && rhs_symbol_post_it->symbol == lhs_symbol_post.symbol) {
+				rhs_target = *rhs_symbol_post_it->targets.begin();
+			} else if (!rhs.symbols.contains(lhs_symbol_post.symbol)) {
+				continue;
+			}
+			for (const State lhs_target : lhs_symbol_post.targets) {
+				const State target{get_state(lhs_target, rhs_target)};
+				product.delta.add(source, lhs_symbol_post.symbol, target);
+			}
+		}
+	}
+	return product;
+}
+
+bool mata::nfa::is_included(const Nfa& smaller, const ImplicitComplement& bigger, Run* const cex) {
+	// Besides the states of the DFA, the state of @p bigger is the sink accepting all words over its symbols, or the
+	//  rejecting state reached over a symbol outside its symbols.
+	const State sink{bigger.dfa.num_of_states()};
+	const State rejecting{sink + 1};
+
+	// Whether a transition over a symbol outside the symbols of @p bigger is reachable from a state of @p smaller. A
+	//  pair with the sink accepts all continuations, and is therefore not explored, only if the state of @p smaller
+	//  cannot leave the sink into the rejecting state.
+	const size_t num_of_smaller_states{smaller.num_of_states()};
+	std::vector<bool> leaves_symbols(num_of_smaller_states, false);
+	std::vector<std::vector<State>> smaller_predecessors(num_of_smaller_states);
+	std::vector<State> leaving_worklist{};
+	for (State state{0}; state < num_of_smaller_states; ++state) {
+		for (const SymbolPost& symbol_post : smaller.delta[state]) {
+			for (const State target : symbol_post.targets) { smaller_predecessors[target].push_back(state); }
+			if (!leaves_symbols[state] && !bigger.symbols.contains(symbol_post.symbol)) {
+				leaves_symbols[state] = true;
+				leaving_worklist.push_back(state);
+			}
+		}
+	}
+	while (!leaving_worklist.empty()) {
+		const State state{leaving_worklist.back()};
+		leaving_worklist.pop_back();
+		for (const State predecessor : smaller_predecessors[state]) {
+			if (!leaves_symbols[predecessor]) {
+				leaves_symbols[predecessor] = true;
+				leaving_worklist.push_back(predecessor);
+			}
+		}
+	}
+
+	std::unordered_map<std::pair<State, State>, std::optional<std::pair<std::pair<State, State>, Symbol>>>
+		predecessors{};
+	std::deque<std::pair<State, State>> worklist{};
+	const auto visit = [&](const std::pair<State, State>& pair, const auto& predecessor) {
+		if ((pair.second != sink || leaves_symbols[pair.first]) && predecessors.try_emplace(pair, predecessor).second) {
+			worklist.push_back(pair);
+		}
+	};
+	for (const State smaller_initial : smaller.initial) {
+		for (const State bigger_initial : bigger.dfa.initial) {
+			visit({smaller_initial, bigger_initial}, std::nullopt);
+		}
+	}
+
+	while (!worklist.empty()) {
+		const std::pair<State, State> pair{worklist.front()};
+		worklist.pop_front();
+		const auto [smaller_state, bigger_state]{pair};
+		if (smaller.final.contains(smaller_state) &&
+			(bigger_state == rejecting || (bigger_state != sink && !bigger.dfa.final.contains(bigger_state)))) {
+			if (cex != nullptr) {
+				cex->word.clear();
+				cex->path.clear();
+				std::pair<State, State> current{pair};
+				cex->path.push_back(current.first);
+				while (const auto& predecessor{predecessors.at(current)}) {
+					cex->word.push_back(predecessor->second);
+					current = predecessor->first;
+					cex->path.push_back(current.first);
+				}
+				std::ranges::reverse(cex->word);
+				std::ranges::reverse(cex->path);
+			}
+			return false;
+		}
+
+		for (const SymbolPost& symbol_post : smaller.delta[smaller_state]) {
+			State bigger_target{rejecting};
+			if (bigger_state == sink && bigger.symbols.contains(symbol_post.symbol)) {
+				bigger_target = sink;
+			} else if (bigger_state != rejecting && bigger.symbols.contains(symbol_post.symbol)) {
+				const StatePost& bigger_state_post{bigger.dfa.delta[bigger_state]};
+				const auto bigger_symbol_post_it{bigger_state_post.find(symbol_post.symbol)};
+				bigger_target =
+					bigger_symbol_post_it == bigger_state_post.end() ? sink : *bigger_symbol_post_it->targets.begin();
+			}
+			for (const State smaller_target : symbol_post.targets) {
+				visit({smaller_target, bigger_target}, std::make_pair(pair, symbol_post.symbol));
+			}
+		}
+	}
+	return true;
+}
@@ -153,6 +153,69 @@ void Delta::add(const State source, const Symbol symbol, const StateSet& targets
 	}
 }
 
+void Delta::add(
+	const std::span<const State> sources, const std::span<const Symbol> symbols, const std::span<const State> targets
+) {
+	if (sources.size() != symbols.size() || sources.size() != targets.size()) {
+		throw std::invalid_argument("Arrays of sources, symbols, and targets differ in size.");
+	}
+	if (sources.empty()) { return; }
+	resize_for_states(std::ranges::max(sources), std::ranges::max(targets));
+
+	// Bucket the transitions by their source states (counting sort), so that each state post is built at once.
+	std::vector<size_t> bucket_begins(num_of_states() + 1, 0);
+	for (const State source : sources) { ++bucket_begins[source + 1]; }
+	for (size_t state{0}; state < num_of_states(); ++state) { bucket_begins[state + 1] += bucket_begins[state]; }
+	std::vector<size_t> order(sources.size());
+	std::vector<size_t> bucket_ends{bucket_begins.begin(), bucket_begins.end() - 1};
+	for (size_t i{0}; i < sources.size(); ++i) { order[bucket_ends[sources[i]]++] = i; }
+
+	for (State source{0}; source < num_of_states(); ++source) {
+		const auto bucket_begin{order.begin() + static_cast<std::ptrdiff_t>(bucket_begins[source])};
+		const auto bucket_end{order.begin() + static_cast<std::ptrdiff_t>(bucket_begins[source + 1])};
+		if (bucket_begin == bucket_end) { continue; }
+		std::sort(bucket_begin, bucket_end, [&](const size_t lhs, const size_t rhs) {
+			return std::tie(symbols[lhs], targets[lhs]) < std::tie(symbols[rhs], targets[rhs]);
+		});
+
+		StatePost new_state_post{};
+		for (auto it{bucket_begin}; it != bucket_end; ++it) {
+			if (new_state_post.empty() || new_state_post.back().symbol != symbols[*it]) {
+				new_state_post.push_back(SymbolPost{symbols[*it], targets[*it]});
+			} else if (new_state_post.back().targets.back() != targets[*it]) {
+				new_state_post.back().targets.push_back(targets[*it]);
+			}
+		}
+
+		if (StatePost& state_post{state_posts_[source]}; state_post.empty()) {
+			state_post = std::move(new_state_post);
+		} else {
+			for (const SymbolPost& symbol_post : new_state_post) { add(source, symbol_post.symbol, symbol_post.targets); }
+		}
+	}
+}
+
+void Delta::copy_transitions_to(
+	const std::span<State> sources, const std::span<Symbol> symbols, const std::span<State> targets
+) const {
+	const size_t num_of_transitions{this->num_of_transitions()};
+	if (sources.size() != num_of_transitions || symbols.size() != num_of_transitions ||
+		targets.size() != num_of_transitions) {
+		throw std::invalid_argument(
+			"Arrays of sources, symbols, and targets have to have " + std::to_string(num_of_transitions) + " elements."
+		);
+	}
+	size_t position{0};
+	for (State source{0}; source < num_of_states(); ++source) {
+		for (const SymbolPost& symbol_post : state_posts_[source]) {
+			std::ranges::fill(sources.subspan(position, symbol_post.num_of_targets()), source);
+			std::ranges::fill(symbols.subspan(position, symbol_post.num_of_targets()), symbol_post.symbol);
+			std::ranges::copy(symbol_post.targets, targets.begin() + static_cast<std::ptrdiff_t>(position));
+			position += symbol_post.num_of_targets();
+		}
+	}
+}
+
 void Delta::remove(const State source, const Symbol symbol, const State target) {
 	if (source >= state_posts_.size()) { return; }
 
@@ -0,0 +1,277 @@
+/** @file
+ * @brief Removal of epsilon transitions from NFAs.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <queue>
+#include <span>
+
+#include "mata/nfa/nfa.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+using mata::utils::OrdVector;
+
+namespace {
+constexpr size_t BLOCK_SIZE{64};
+
+/**
+ * @brief Epsilon closures of all states of an automaton.
+ *
+ * The graph of epsilon transitions is condensed into strongly connected components (all states of a component have
+ *  the same closure). The closures of the components are computed in reverse topological order of the condensation,
+ *  each as the union of its states and the closures of its successor components, accumulated in a bit vector.
+ */
+class EpsilonClosures {
+  public:
+	EpsilonClosures(const Nfa& aut, const OrdVector<Symbol>& epsilons)
+		: num_of_states_{aut.num_of_states()},
+		  successor_offsets_(num_of_states_ + 1, 0),
+		  component_of_(num_of_states_, 0) {
+		for (State state{0}; state < aut.delta.num_of_states(); ++state) {
+			for (const SymbolPost& symbol_post : aut.delta[state]) {
+				if (epsilons.contains(symbol_post.symbol)) {
+					successors_.insert(successors_.end(), symbol_post.targets.begin(), symbol_post.targets.end());
+				}
+			}
+			successor_offsets_[state + 1] = successors_.size();
+		}
+		for (State state{static_cast<State>(aut.delta.num_of_states())}; state < num_of_states_; ++state) {
+			successor_offsets_[state + 1] = successors_.size();
+		}
+		compute_components();
+		compute_closures();
+	}
+
+	/// Get the epsilon closure of @p state as a sorted sequence of states (containing @p state).
+	std::span<const State> of(const State state) const {
+		const size_t component{component_of_[state]};
+		return {
+			closure_states_.data() + closure_offsets_[component],
+			closure_offsets_[component + 1] - closure_offsets_[component]
+		};
+	}
+
+  private:
+	std::span<const State> successors(const State state) const {
+		return {
+			successors_.data() + successor_offsets_[state],
+			successor_offsets_[state + 1] - successor_offsets_[state]
+		};
+	}
+
+	/// Tarjan's algorithm (iterative). Components are numbered in the order of their completion, i.e., successor
+	///  components of a component have lower numbers.
+	void compute_components() {
+		constexpr size_t UNVISITED{std::numeric_limits<size_t>::max()};
+		std::vector<size_t> index_of(num_of_states_, UNVISITED);
+		std::vector<size_t> lowlink(num_of_states_, 0);
+		std::vector<bool> on_stack(num_of_states_, false);
+		std::vector<State> stack{};
+		// Pairs of a state and the position of its next successor to explore.
+		std::vector<std::pair<State, size_t>> call_stack{};
+		size_t next_index{0};
+		size_t num_of_components{0};
+		component_offsets_.push_back(0);
+
+		for (State root{0}; root < num_of_states_; ++root) {
+			if (index_of[root] != UNVISITED) { continue; }
+			call_stack.emplace_back(root, successor_offsets_[root]);
+			index_of[root] = lowlink[root] = next_index++;
+			stack.push_back(root);
+			on_stack[root] = true;
+			while (!call_stack.empty()) {
+				auto& [state, position] = call_stack.back();
+				if (position < successor_offsets_[state + 1]) {
+					const State successor{successors_[position++]};
+					if (index_of[successor] == UNVISITED) {
+						index_of[successor] = lowlink[successor] = next_index++;
+						stack.push_back(successor);
+						on_stack[successor] = true;
+						call_stack.emplace_back(successor, successor_offsets_[successor]);
+					} else if (on_stack[successor]) {
+						lowlink[state] = std::min(lowlink[state], index_of[successor]);
+					}
+					continue;
+				}
+				const State finished_state{state};
+				call_stack.pop_back();
+				if (!call_stack.empty()) {
+					State& parent{call_stack.back().first};
+					lowlink[parent] = std::min(lowlink[parent], lowlink[finished_state]);
+				}
+				if (lowlink[finished_state] == index_of[finished_state]) {
+					State member;
+					do {
+						member = stack.back();
+						stack.pop_back();
+						on_stack[member] = false;
+						component_of_[member] = num_of_components;
+						component_states_.push_back(member);
+					} while (member != finished_state);
+					component_offsets_.push_back(component_states_.size());
+					++num_of_components;
+				}
+			}
+		}
+	}
+
+	void compute_closures() {
+		const size_t num_of_components{component_offsets_.size() - 1};
+		closure_offsets_.reserve(num_of_components + 1);
+		closure_offsets_.push_back(0);
+		closure_states_.reserve(num_of_states_);
+		// Bit vector of the closure being computed, with the list of its non-zero blocks to extract and clear it in
+		//  time proportional to the size of the closure.
+		std::vector<uint64_t> closure_bits((num_of_states_ + BLOCK_SIZE - 1) / BLOCK_SIZE, 0);
+		std::vector<size_t> touched_blocks{};
+		auto insert = [&](const State state) {
+			uint64_t& block{closure_bits[state / BLOCK_SIZE]};
+			if (block == 0) { touched_blocks.push_back(state / BLOCK_SIZE); }
+			block |= uint64_t{1} << (state % BLOCK_SIZE);
+		};
+
+		for (size_t component{0}; component < num_of_components; ++component) {
+			const std::span<const State> states{
+				component_states_.data() + component_offsets_[component],
+				component_offsets_[component + 1] - component_offsets_[component]
+			};
+			bool is_trivial{states.size() == 1 && successors(states[0]).empty()};
+			if (is_trivial) {
+				closure_states_.push_back(states[0]);
+			} else {
+				for (const State state : states) {
+					insert(state);
+					for (const State successor : successors(state)) {
+						const size_t successor_component{component_of_[successor]};
+						if (successor_component == component) { continue; }
+						// Successor components are already computed.
+						for (size_t position{closure_offsets_[successor_component]};
+							 position < closure_offsets_[successor_component + 1]; ++position) {
+							insert(closure_states_[position]);
+						}
+					}
+				}
+				std::ranges::sort(touched_blocks);
+				for (const size_t block_index : touched_blocks) {
+					for (uint64_t bits{closure_bits[block_index]}; bits != 0; bits &= bits - 1) {
+						const size_t bit_index{static_cast<size_t>(std::countr_zero(bits))};
+						closure_states_.push_back(static_cast<State>(block_index * BLOCK_SIZE + bit_index));
+					}
+					closure_bits[block_index] = 0;
+				}
+				touched_blocks.clear();
+			}
+			closure_offsets_.push_back(closure_states_.size());
+		}
+	}
+
+	size_t num_of_states_;
+	std::vector<size_t> successor_offsets_;
+	std::vector<State> successors_{};
+	std::vector<size_t> component_of_;
+	std::vector<size_t> component_offsets_{};
+	std::vector<State> component_states_{};
+	std::vector<size_t> closure_offsets_{};
+	std::vector<State> closure_states_{};
+};
+
+/// Put the union of the sorted sequences @p target_sets into @p targets.
+void unite_targets(std::vector<std::span<const State>>& target_sets, StateSet& targets) {
+	if (target_sets.size() == 1) {
+		targets.reserve(target_sets[0].size());
+		for (const State state : target_sets[0]) { targets.push_back(state); }
+		return;
+	}
+	std::vector<State> united_targets{};
+	for (const std::span<const State>& target_set : target_sets) {
+		united_targets.insert(united_targets.end(), target_set.begin(), target_set.end());
+	}
+	std::ranges::sort(united_targets);
+	united_targets.erase(std::unique(united_targets.begin(), united_targets.end()), united_targets.end());
+	targets.reserve(united_targets.size());
+	for (const State state : united_targets) { targets.push_back(state); }
+}
+
+/**
+ * @brief Construct the state post of a state with the epsilon closure @p closure by a k-way merge of the non-epsilon
+ *  symbol posts of the states in @p closure, in the order of symbols.
+ */
+void merge_closure_posts(
+	const Nfa& aut, const std::span<const State> closure, const OrdVector<Symbol>& epsilons, StatePost& state_post
+) {
+	// Cursors (symbol, position in the closure, position of the symbol post) ordered by the smallest symbol.
+	using Cursor = std::tuple<Symbol, size_t, size_t>;
+	std::priority_queue<Cursor, std::vector<Cursor>, std::greater<>> cursors{};
+	auto advance = [&](const size_t closure_index, size_t position) {
+		const State state{closure[closure_index]};
+		if (state >= aut.delta.num_of_states()) { return; }
+		const StatePost& post{aut.delta[state]};
+		for (; position < post.size(); ++position) {
+			if (const Symbol symbol{(post.begin() + static_cast<std::ptrdiff_t>(position))->symbol};
+				!epsilons.contains(symbol)) {
+				cursors.emplace(symbol, closure_index, position);
+				return;
+			}
+		}
+	};
+	for (size_t closure_index{0}; closure_index < closure.size(); ++closure_index) { advance(closure_index, 0); }
+
+	std::vector<std::span<const State>> target_sets{};
+	while (!cursors.empty()) {
+		const Symbol symbol{std::get<0>(cursors.top())};
+		target_sets.clear();
+		while (!cursors.empty() && std::get<0>(cursors.top()) == symbol) {
+			const auto [_, closure_index, position] = cursors.top();
+			cursors.pop();
+			const StatePost& post{aut.delta[closure[closure_index]]};
+			const StateSet& targets{(post.begin() + static_cast<std::ptrdiff_t>(position))->targets};
+			target_sets.emplace_back(targets.begin(), targets.end());
+			advance(closure_index, position + 1);
+		}
+		unite_targets(target_sets, state_post.emplace_back(symbol).targets);
+	}
+}
+} // namespace
+
+Nfa mata::nfa::remove_epsilon(const Nfa& aut, const Symbol epsilon) {
+	return remove_epsilon(aut, OrdVector<Symbol>(epsilon), EpsilonClosureOpt::Before);
+}
+
+Nfa mata::nfa::remove_epsilon(const Nfa& aut, const OrdVector<Symbol>& epsilons, const EpsilonClosureOpt closure) {
+	if (closure != EpsilonClosureOpt::Before && closure != EpsilonClosureOpt::After) {
+		throw std::runtime_error("Epsilon closure has to be applied either before or after the transitions");
+	}
+	const size_t num_of_states{aut.num_of_states()};
+	const EpsilonClosures closures{aut, epsilons};
+	Nfa result{Delta(num_of_states), aut.initial, aut.final, aut.alphabet};
+
+	if (closure == EpsilonClosureOpt::Before) {
+		for (State state{0}; state < num_of_states; ++state) {
+			const std::span<const State> state_closure{closures.of(state)};
+			if (std::ranges::any_of(state_closure, [&](const State closure_state) {
+					return aut.final.contains(closure_state);
+				})) {
+				result.final.insert(state);
+			}
+			merge_closure_posts(aut, state_closure, epsilons, result.delta.mutable_state_post(state));
+		}
+		return result;
+	}
+
+	for (const State state : aut.initial) {
+		for (const State closure_state : closures.of(state)) { result.initial.insert(closure_state); }
+	}
+	std::vector<std::span<const State>> target_sets{};
+	for (State state{0}; state < aut.delta.num_of_states(); ++state) {
+		StatePost& state_post{result.delta.mutable_state_post(state)};
+		for (const SymbolPost& symbol_post : aut.delta[state]) {
+			if (epsilons.contains(symbol_post.symbol)) { continue; }
+			target_sets.clear();
+			for (const State target : symbol_post.targets) { target_sets.push_back(closures.of(target)); }
+			unite_targets(target_sets, state_post.emplace_back(symbol_post.symbol).targets);
+		}
+	}
+	return result;
+}
@@ -4,6 +4,9 @@
 // MATA headers
 #include "mata/nfa/algorithms.hh"
 #include "mata/nfa/nfa.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/parallel.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/sparse-set.hh"
 
 using namespace mata::nfa;
@@ -16,6 +19,7 @@ bool mata::nfa::algorithms::is_included_naive(
 	const Alphabet* const alphabet, // TODO: this should not be needed, likewise for equivalence
 	Run* cex
 ) { // {{{
+	OperationProfile profile{"nfa::is_included_naive"};
 	Nfa bigger_cmpl;
 	if (alphabet == nullptr) {
 		bigger_cmpl = complement(bigger, create_alphabet(smaller, bigger));
@@ -46,6 +50,7 @@ bool mata::nfa::algorithms::is_included_antichains(
 	Run* cex
 ) { // {{{
 	(void) alphabet;
+	OperationProfile profile{"nfa::is_included_antichains"};
 
 	// TODO: Decide what is the best optimization for inclusion.
 
@@ -72,6 +77,8 @@ bool mata::nfa::algorithms::is_included_antichains(
 	// worklist.reserve(32);
 	// so those with smaller popped for processing first.
 	ProcessedType processed(smaller.num_of_states()); // Allocate to the number of states of the smaller nfa.
+	// Number of the pairs in processed, i.e., the size of the antichain, which bounds the memory of the check.
+	size_t antichain_size{0};
 	// The pairs of each state are also kept sorted. It allows slightly faster antichain pruning - no need to test
 	// inclusion in sets that have less elements.
 
@@ -139,6 +146,7 @@ bool mata::nfa::algorithms::is_included_antichains(
 		const ProdStateType st = std::tuple(state, bigger_state_set, min_dst(bigger_state_set));
 		insert_to_pairs(worklist, st);
 		insert_to_pairs(processed[state], st);
+		++antichain_size;
 
 		if (cex != nullptr) { paths.insert({st, {st, 0}}); }
 	}
@@ -151,6 +159,8 @@ bool mata::nfa::algorithms::is_included_antichains(
 		// get a next product state
 		ProdStateType prod_state = *worklist.rbegin();
 		worklist.pop_back();
+		++profile.statistics.macrostates_explored;
+		utils::Budget::poll(antichain_size);
 
 		const State& smaller_state = std::get<0>(prod_state);
 		const StateSet& bigger_set = std::get<1>(prod_state);
@@ -206,13 +216,19 @@ bool mata::nfa::algorithms::is_included_antichains(
 					}
 				}
 
-				if (is_subsumed) { continue; }
+				if (is_subsumed) {
+					++profile.statistics.antichain_prunes;
+					continue;
+				}
 
+				++profile.statistics.states_created;
 				for (ProdStatesType* ds : {&processed[smaller_succ], &worklist}) {
 					// Pruning of processed and the worklist.
 					// Since they are ordered by the size of the sets, we can iterate from back,
 					// and as soon as we get to sets larger than succ, we can stop (larger sets cannot be subsets).
-					std::erase_if(*ds, [&](const auto& d) { return subsumes(succ, d); });
+					const size_t num_of_pruned{std::erase_if(*ds, [&](const auto& d) { return subsumes(succ, d); })};
+					profile.statistics.antichain_prunes += num_of_pruned;
+					if (ds != &worklist) { antichain_size = antichain_size - num_of_pruned + 1; }
 					// for (long it = static_cast<long>(ds->size()-1);it>=0;--it) {
 					//     // if (smaller_set((*ds)[static_cast<size_t>(it)],succ))
 					//         // break;
@@ -284,6 +300,22 @@ bool mata::nfa::is_included(
 	return algo(smaller, bigger, alphabet, cex);
 } // is_included }}}
 
+mata::BoolVector mata::nfa::is_included_many(
+	const Nfa& bigger,
+	const std::vector<const Nfa*>& smaller,
+	const Alphabet* const alphabet,
+	const ParameterMap& params,
+	size_t num_of_threads
+) {
+	const AlgoType algo{set_algorithm("is_included", params)};
+	BoolVector result(smaller.size(), false);
+	num_of_threads = get_num_of_threads(num_of_threads, smaller.size());
+	parallel_for(smaller.size(), num_of_threads, [&](size_t, const size_t index) {
+		result[index] = algo(*smaller[index], bigger, alphabet, nullptr);
+	});
+	return result;
+}
+
 bool mata::nfa::are_equivalent(const Nfa& lhs, const Nfa& rhs, const Alphabet* alphabet, const ParameterMap& params) {
 	// TODO: add comment on what this is doing, what is __func__ ...
 	AlgoType algo{set_algorithm(std::to_string(__func__), params)};
@@ -66,7 +66,13 @@ StateBoolArray
 void Nfa::remove_epsilon(const Symbol epsilon) { *this = mata::nfa::remove_epsilon(*this, epsilon); }
 
 StateSet Nfa::get_reachable_states(const std::function<bool(State)>& filter) const {
-	StateBoolArray reachable_bool_array{reachable_states(*this)};
+	StateBoolArray reachable_bool_array{};
+	if (algorithms::is_dense(*this)) {
+		const BoolVector reachable{algorithms::get_reachable_states_bit_parallel(*this, initial)};
+		reachable_bool_array.assign(reachable.begin(), reachable.end());
+	} else {
+		reachable_bool_array = reachable_states(*this);
+	}
 
 	StateSet reachable_states{};
 	const size_t num_of_states{this->num_of_states()};
@@ -352,11 +358,14 @@ BoolVector Nfa::get_useful_states(
 	const std::optional<std::reference_wrapper<const SparseSet<State>>> initial_states,
 	const std::optional<std::reference_wrapper<const SparseSet<State>>> final_states
 ) const {
-	BoolVector useful(this->num_of_states(), false);
-	bool final_scc = false;
-
 	const SparseSet<State>& used_initial_states{initial_states.value_or(initial)};
 	const SparseSet<State>& used_final_states{final_states.value_or(this->final)};
+	if (algorithms::is_dense(*this)) {
+		return algorithms::get_useful_states_bit_parallel(*this, used_initial_states, used_final_states);
+	}
+
+	BoolVector useful(this->num_of_states(), false);
+	bool final_scc = false;
 
 	TarjanDiscoverCallback callback{};
 	callback.state_discover = [&](const State state) -> bool {
@@ -13,6 +13,9 @@
 #include "mata/nfa/algorithms.hh"
 #include "mata/nfa/delta.hh"
 #include "mata/nfa/nfa.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/parallel.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/sparse-set.hh"
 #include <mata/simlib/explicit_lts.hh>
 
@@ -237,63 +240,6 @@ bool mata::nfa::Nfa::make_complete(const OrdVector<Symbol>& symbols, const std::
 	return transition_added;
 }
 
-// TODO: based on the comments inside, this function needs to be rewritten in a more optimal way.
-Nfa mata::nfa::remove_epsilon(const Nfa& aut, const Symbol epsilon) {
-	// cannot use multimap, because it can contain multiple occurrences of (a -> a), (a -> a)
-	std::unordered_map<State, StateSet> epsilon_closure;
-
-	// TODO: grossly inefficient
-	// first we compute the epsilon closure
-	const size_t num_of_states{aut.num_of_states()};
-	for (size_t i{0}; i < num_of_states; ++i) {
-		for (const auto& trans : aut.delta[i]) {
-			const auto [it, inserted] = epsilon_closure.insert({i, {i}});
-			if (trans.symbol == epsilon) {
-				StateSet& closure = it->second;
-				// TODO: Fix possibly insert to OrdVector. Create list already ordered, then merge (do not need to
-				// resize each time);
-				closure.insert(trans.targets);
-			}
-		}
-	}
-
-	bool changed = true;
-	while (changed) { // Compute the fixpoint.
-		changed = false;
-		for (size_t i = 0; i < num_of_states; ++i) {
-			const StatePost& post{aut.delta[i]};
-			// TODO: make faster if default epsilon
-			if (const auto eps_move_it{post.find(epsilon)}; eps_move_it != post.end()) {
-				StateSet& src_eps_cl = epsilon_closure[i];
-				for (const State tgt : eps_move_it->targets) {
-					const StateSet& tgt_eps_cl = epsilon_closure[tgt];
-					for (const State st : tgt_eps_cl) {
-						if (src_eps_cl.count(st) == 0) {
-							changed = true;
-							break;
-						}
-					}
-					src_eps_cl.insert(tgt_eps_cl);
-				}
-			}
-		}
-	}
-
-	// Construct the automaton without epsilon transitions.
-	Nfa result{Delta{}, aut.initial, aut.final, aut.alphabet};
-	for (const auto& [state, closure_states] : epsilon_closure) {
-		for (const State eps_cl_state : closure_states) {
-			if (aut.final[eps_cl_state]) { result.final.insert(state); }
-			for (const SymbolPost& move : aut.delta[eps_cl_state]) {
-				if (move.symbol == epsilon) { continue; }
-				// TODO: this could be done more efficiently if we had a better add method
-				for (const State tgt_state : move.targets) { result.delta.add(state, move.symbol, tgt_state); }
-			}
-		}
-	}
-	return result;
-}
-
 Nfa mata::nfa::fragile_revert(const Nfa& aut) {
 	const size_t num_of_states{aut.num_of_states()};
 
@@ -605,10 +551,22 @@ bool Nfa::is_in_lang(const Run& run, const bool use_epsilon, const bool match_pr
 	return this->final.intersects_with(read_word(run, use_epsilon));
 }
 
+mata::BoolVector mata::nfa::is_in_lang_batch(const Nfa& aut, const std::vector<Word>& words, size_t num_of_threads) {
+	BoolVector result(words.size(), false);
+	num_of_threads = utils::get_num_of_threads(num_of_threads, words.size());
+	utils::parallel_for(words.size(), num_of_threads, [&](size_t, const size_t index) {
+		result[index] = aut.is_in_lang(words[index]);
+	});
+	return result;
+}
+
 bool mata::nfa::Nfa::is_lang_empty(Run* cex) const {
 	// TODO: hot fix for performance reasons for TACAS.
 	//  Perhaps make the get_useful_states return a witness on demand somehow.
-	if (!cex) { return is_lang_empty_scc(); }
+	if (!cex) {
+		if (algorithms::is_dense(*this)) { return algorithms::is_lang_empty_bit_parallel(*this); }
+		return is_lang_empty_scc();
+	}
 
 	std::list<State> worklist(initial.begin(), initial.end());
 	std::unordered_set<State> processed(initial.begin(), initial.end());
@@ -662,7 +620,7 @@ Nfa mata::nfa::algorithms::minimize_brzozowski(const Nfa& aut) {
 }
 
 Nfa mata::nfa::minimize(const Nfa& aut, const ParameterMap& params) {
-	Nfa result;
+	OperationProfile profile{"nfa::minimize"};
 	// setting the default algorithm
 	decltype(algorithms::minimize_brzozowski)* algo = algorithms::minimize_brzozowski;
 	if (!haskey(params, "algorithm")) {
@@ -683,7 +641,9 @@ Nfa mata::nfa::minimize(const Nfa& aut, const ParameterMap& params) {
 		);
 	}
 
-	return algo(aut);
+	Nfa result{algo(aut)};
+	profile.statistics.states_created = result.num_of_states();
+	return result;
 }
 
 // Anonymous namespace for the Hopcroft minimization algorithm.
@@ -1048,12 +1008,17 @@ Nfa mata::nfa::algorithms::minimize_hopcroft(const Nfa& dfa_trimmed) {
 	return result;
 }
 
-Nfa mata::nfa::product(
+namespace {
+/**
+ * Compute the product of @p lhs and @p rhs with @p final_condition by @p construct_product, which gets the predicate
+ *  telling whether a product state is final. Products of automata with empty languages are computed directly.
+ */
+template <class ConstructProduct>
+Nfa compute_product(
 	const Nfa& lhs,
 	const Nfa& rhs,
 	const ProductFinalStateCondition final_condition,
-	const Symbol first_epsilon,
-	std::unordered_map<std::pair<State, State>, State>* prod_map
+	const ConstructProduct& construct_product
 ) {
 	std::function<bool(const State, const State)> is_product_state_final_func;
 	if (final_condition == ProductFinalStateCondition::Or) {
@@ -1069,10 +1034,39 @@ Nfa mata::nfa::product(
 			return lhs.final.contains(lhs_state) && rhs.final.contains(rhs_state);
 		};
 	} else {
-		throw std::runtime_error(std::to_string(__func__) + " received an unknown value of the \"final_condition\"");
+		throw std::runtime_error("product received an unknown value of the \"final_condition\"");
 	}
 
-	return algorithms::product(lhs, rhs, std::move(is_product_state_final_func), first_epsilon, prod_map);
+	return construct_product(std::move(is_product_state_final_func));
+}
+} // namespace
+
+Nfa mata::nfa::product(
+	const Nfa& lhs,
+	const Nfa& rhs,
+	const ProductFinalStateCondition final_condition,
+	const Symbol first_epsilon,
+	std::unordered_map<std::pair<State, State>, State>* prod_map
+) {
+	return compute_product(lhs, rhs, final_condition, [&](std::function<bool(State, State)>&& is_final) {
+		return algorithms::product(lhs, rhs, std::move(is_final), first_epsilon, prod_map);
+	});
+}
+
+Nfa mata::nfa::product_parallel(
+	const Nfa& lhs,
+	const Nfa& rhs,
+	const ProductFinalStateCondition final_condition,
+	const size_t num_of_threads,
+	const bool deterministic_numbering,
+	const Symbol first_epsilon,
+	std::unordered_map<std::pair<State, State>, State>* prod_map
+) {
+	return compute_product(lhs, rhs, final_condition, [&](std::function<bool(State, State)>&& is_final) {
+		return algorithms::product_parallel(
+			lhs, rhs, is_final, num_of_threads, deterministic_numbering, first_epsilon, prod_map
+		);
+	});
 }
 
 Nfa mata::nfa::intersection(
@@ -1123,6 +1117,7 @@ Simlib::Util::BinaryRelation mata::nfa::algorithms::compute_relation(const Nfa&
 }
 
 Nfa mata::nfa::reduce(const Nfa& aut, StateRenaming* state_renaming, const ParameterMap& params) {
+	OperationProfile profile{"nfa::reduce"};
 	if (!haskey(params, "algorithm")) {
 		throw std::runtime_error(
 			std::to_string(__func__) +
@@ -1170,6 +1165,7 @@ Nfa mata::nfa::reduce(const Nfa& aut, StateRenaming* state_renaming, const Param
 		state_renaming->clear();
 		*state_renaming = reduced_state_map;
 	}
+	profile.statistics.states_created = result.num_of_states();
 	return result;
 }
 
@@ -1178,6 +1174,7 @@ Nfa mata::nfa::determinize(
 	std::unordered_map<StateSet, State>* subset_map,
 	std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover
 ) {
+	OperationProfile profile{"nfa::determinize"};
 	Nfa result{};
 	// assuming all sets targets are non-empty
 	std::vector<std::pair<State, StateSet>> worklist{};
@@ -1186,6 +1183,7 @@ Nfa mata::nfa::determinize(
 
 	const StateSet initial_states_orig{aut.initial};
 	const State initial_state_res{result.add_state()};
+	++profile.statistics.states_created;
 	result.initial.insert(initial_state_res);
 
 	if (aut.final.intersects_with(initial_states_orig)) { result.final.insert(initial_state_res); }
@@ -1202,6 +1200,8 @@ Nfa mata::nfa::determinize(
 	while (!worklist.empty()) {
 		const auto [state_res, states_orig]{std::move(worklist.back())};
 		worklist.pop_back();
+		++profile.statistics.macrostates_explored;
+		utils::Budget::poll(result.num_of_states());
 		if (states_orig.empty()) {
 			// This should not happen assuming all sets targets are non-empty.
 			break;
@@ -1223,6 +1223,7 @@ Nfa mata::nfa::determinize(
 				target_res = existing_target_it->second;
 			} else {
 				target_res = result.add_state();
+				++profile.statistics.states_created;
 				(*subset_map)[mata::utils::OrdVector<State>(targets_orig)] = target_res;
 				if (aut.final.intersects_with(targets_orig)) { result.final.insert(target_res); }
 				worklist.emplace_back(target_res, targets_orig);
@@ -1242,6 +1243,13 @@ std::ostream& std::operator<<(std::ostream& os, const Nfa& nfa) {
 	return os;
 }
 
+size_t std::hash<Nfa>::operator()(const Nfa& nfa) const noexcept {
+	size_t accum{nfa.num_of_states()};
+	for (const Transition& transition : nfa.delta.transitions()) { accum = mata::utils::hash_combine(accum, transition); }
+	accum = mata::utils::hash_combine(accum, mata::utils::OrdVector<State>(nfa.initial));
+	return mata::utils::hash_combine(accum, mata::utils::OrdVector<State>(nfa.final));
+}
+
 void mata::nfa::Nfa::fill_alphabet(OnTheFlyAlphabet& alphabet_to_fill) const {
 	for (const StatePost& state_post : this->delta) {
 		for (const SymbolPost& symbol_post : state_post) {
@@ -1281,36 +1289,115 @@ Run mata::nfa::encode_word(const Alphabet* alphabet, const std::vector<std::stri
 
 std::set<mata::Word> mata::nfa::Nfa::get_words(const size_t max_length) const {
 	std::set<mata::Word> result;
+	WordEnumerator enumerator{*this, max_length};
+	while (std::optional<Word> word{enumerator.next()}) { result.insert(std::move(*word)); }
+	return result;
+}
 
-	// contains a pair: a state s and the word with which we got to the state s
-	std::vector<std::pair<State, mata::Word>> worklist;
-	// initializing worklist
-	for (State init_state : initial) {
-		worklist.push_back({init_state, {}});
-		if (final.contains(init_state)) { result.insert(mata::Word()); }
-	}
-
-	// will be used during the loop
-	std::vector<std::pair<State, mata::Word>> new_worklist;
-
-	unsigned cur_length = 0;
-	while (!worklist.empty() && cur_length < max_length) {
-		new_worklist.clear();
-		for (const auto& [state, word] : worklist) {
-			for (const SymbolPost& sp : delta[state]) {
-				mata::Word new_word = word;
-				new_word.push_back(sp.symbol);
-				for (State s_to : sp.targets) {
-					new_worklist.emplace_back(s_to, new_word);
-					if (final.contains(s_to)) { result.insert(new_word); }
-				}
+WordEnumerator::WordEnumerator(const Nfa& nfa, const size_t max_length, const size_t max_num_of_words)
+	: nfa_{&nfa},
+	  max_length_{max_length},
+	  max_num_of_words_{max_num_of_words},
+	  initial_macrostate_{nfa.initial},
+	  distances_to_final_{nfa.distances_to_final()},
+	  is_extendable_(nfa.num_of_states(), false) {
+	const size_t num_of_states{nfa.num_of_states()};
+	for (State state{0}; state < num_of_states; ++state) {
+		for (const SymbolPost& symbol_post : nfa.delta[state]) {
+			if (std::ranges::any_of(symbol_post.targets, [&](const State target) {
+					return target < distances_to_final_.size() && distances_to_final_[target] != Limits::max_state;
+				})) {
+				is_extendable_[state] = true;
+				break;
 			}
 		}
-		worklist.swap(new_worklist);
-		++cur_length;
 	}
+	finished_ = distance_to_final(initial_macrostate_) == Limits::max_state;
+}
 
-	return result;
+State WordEnumerator::distance_to_final(const StateSet& macrostate) const {
+	State distance{Limits::max_state};
+	for (const State state : macrostate) {
+		if (state < distances_to_final_.size()) { distance = std::min(distance, distances_to_final_[state]); }
+	}
+	return distance;
+}
+
+bool WordEnumerator::can_be_extended(const StateSet& macrostate) const {
+	return std::ranges::any_of(macrostate, [&](const State state) {
+		return state < is_extendable_.size() && is_extendable_[state];
+	});
+}
+
+void WordEnumerator::expand(Frame& frame) const {
+	using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
+	SynchronizedExistentialSymbolPostIterator synchronized_iterator;
+	for (const State state : frame.macrostate) { push_back(synchronized_iterator, nfa_->delta[state]); }
+	while (synchronized_iterator.advance()) {
+		const std::vector<Iterator>& symbol_posts{synchronized_iterator.get_current()};
+		StateSet targets{synchronized_iterator.unify_targets()};
+		if (distance_to_final(targets) == Limits::max_state) { continue; }
+		frame.successors.emplace_back((*symbol_posts.begin())->symbol, std::move(targets));
+	}
+	frame.expanded = true;
+}
+
+bool WordEnumerator::start_next_length() {
+	if (started_) {
+		if (!longer_words_exist_ || current_length_ >= max_length_) { return false; }
+		++current_length_;
+	}
+	started_ = true;
+	longer_words_exist_ = false;
+	if (distance_to_final(initial_macrostate_) <= current_length_) {
+		stack_.push_back(Frame{.macrostate = initial_macrostate_});
+	} else {
+		longer_words_exist_ = true;
+	}
+	return true;
+}
+
+std::optional<mata::Word> WordEnumerator::next() {
+	while (!finished()) {
+		if (stack_.empty()) {
+			if (!start_next_length()) { finished_ = true; }
+			continue;
+		}
+
+		Frame& frame{stack_.back()};
+		if (word_.size() == current_length_) {
+			// The word has the searched length: report it if accepted and backtrack.
+			const bool is_accepting{nfa_->final.intersects_with(frame.macrostate)};
+			if (!longer_words_exist_ && can_be_extended(frame.macrostate)) { longer_words_exist_ = true; }
+			stack_.pop_back();
+			std::optional<Word> result{};
+			if (is_accepting) {
+				result = word_;
+				++num_of_words_;
+			}
+			if (!word_.empty()) { word_.pop_back(); }
+			if (result.has_value()) { return result; }
+			continue;
+		}
+
+		if (!frame.expanded) { expand(frame); }
+		if (frame.next_successor < frame.successors.size()) {
+			const auto& [symbol, targets]{frame.successors[frame.next_successor]};
+			++frame.next_successor;
+			if (distance_to_final(targets) > current_length_ - word_.size() - 1) {
+				// A final state is reachable from the macrostate only by a longer word.
+				longer_words_exist_ = true;
+				continue;
+			}
+			word_.push_back(symbol);
+			StateSet macrostate{targets}; // Copy before reallocating the stack invalidates the reference.
+			stack_.push_back(Frame{.macrostate = std::move(macrostate)});
+		} else {
+			stack_.pop_back();
+			if (!word_.empty()) { word_.pop_back(); }
+		}
+	}
+	return std::nullopt;
 }
 
 OrdVector<Symbol> mata::nfa::get_symbols_to_work_with(const Nfa& nfa, const mata::Alphabet* const shared_alphabet) {
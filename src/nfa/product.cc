@@ -4,9 +4,14 @@
 // MATA headers
 #include "mata/nfa/algorithms.hh"
 #include "mata/nfa/nfa.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/parallel.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/two-dimensional-map.hh"
+#include <atomic>
 #include <cassert>
 #include <functional>
+#include <map>
 
 using namespace mata::nfa;
 
@@ -21,6 +26,7 @@ Nfa mata::nfa::algorithms::product(
 	const Symbol first_epsilon,
 	std::unordered_map<std::pair<State, State>, State>* product_map
 ) {
+	utils::OperationProfile profile{"nfa::product"};
 	Nfa product{}; // The product automaton.
 	utils::TwoDimensionalMap<State> product_storage{lhs.num_of_states(), rhs.num_of_states()};
 	std::deque<State> worklist{}; // Set of product states to process.
@@ -65,6 +71,7 @@ Nfa mata::nfa::algorithms::product(
 		if (product_target == Limits::max_state) {
 			product_target = product.add_state();
 			assert(product_target < Limits::max_state);
+			++profile.statistics.product_pairs;
 
 			product_storage.insert(lhs_target, rhs_target, product_target);
 			if (product_map != nullptr) { (*product_map)[{lhs_target, rhs_target}] = product_target; }
@@ -82,6 +89,7 @@ Nfa mata::nfa::algorithms::product(
 		for (const State rhs_initial_state : rhs.initial) {
 			// Update product with initial state pairs.
 			const State product_initial_state = product.add_state();
+			++profile.statistics.product_pairs;
 			product_storage.insert(lhs_initial_state, rhs_initial_state, product_initial_state);
 			if (product_map != nullptr) {
 				(*product_map)[{lhs_initial_state, rhs_initial_state}] = product_initial_state;
@@ -96,6 +104,8 @@ Nfa mata::nfa::algorithms::product(
 		State product_source = worklist.back();
 		;
 		worklist.pop_back();
+		++profile.statistics.macrostates_explored;
+		utils::Budget::poll(product.num_of_states());
 		State lhs_source = product_storage.get_first_inverted(product_source);
 		State rhs_source = product_storage.get_second_inverted(product_source);
 		// Compute classic product for current state pair.
@@ -159,7 +169,189 @@ Nfa mata::nfa::algorithms::product(
 			}
 		}
 	}
+	profile.statistics.states_created = product.num_of_states();
 	return product;
 } // intersection().
 
+namespace {
+
+/// Rounds with fewer product states per thread run on fewer threads, as starting the threads would take longer than
+///  processing the states.
+constexpr size_t MIN_STATES_PER_THREAD{64};
+
+/// A product state to process together with its pair of original states.
+struct ProductState {
+	State state;
+	State lhs;
+	State rhs;
+};
+
+/**
+ * Renumber the states of @p product in the breadth-first order from the initial states, visiting the targets over each
+ *  symbol in the order of their pairs of original states @p pairs. All states of @p product must be reachable.
+ */
+void renumber_breadth_first(Nfa& product, std::vector<std::pair<State, State>>& pairs) {
+	const size_t num_of_states{product.num_of_states()};
+	std::vector<State> renaming(num_of_states, Limits::max_state);
+	std::vector<State> order{};
+	order.reserve(num_of_states);
+	for (const State initial_state : StateSet{product.initial}) {
+		renaming[initial_state] = order.size();
+		order.push_back(initial_state);
+	}
+	std::vector<State> targets{};
+	for (size_t index{0}; index < order.size(); ++index) {
+		for (const SymbolPost& symbol_post : product.delta[order[index]]) {
+			targets.assign(symbol_post.targets.begin(), symbol_post.targets.end());
+			std::ranges::sort(targets, [&](const State a, const State b) { return pairs[a] < pairs[b]; });
+			for (const State target : targets) {
+				if (renaming[target] != Limits::max_state) { continue; }
+				renaming[target] = order.size();
+				order.push_back(target);
+			}
+		}
+	}
+	assert(order.size() == num_of_states);
+
+	Nfa renumbered{};
+	renumbered.delta.allocate(num_of_states);
+	std::vector<std::pair<State, State>> renumbered_pairs(num_of_states);
+	for (State state{0}; state < num_of_states; ++state) {
+		StatePost& state_post{renumbered.delta.mutable_state_post(renaming[state])};
+		for (const SymbolPost& symbol_post : product.delta[state]) {
+			targets.clear();
+			for (const State target : symbol_post.targets) { targets.push_back(renaming[target]); }
+			state_post.push_back(SymbolPost{symbol_post.symbol, StateSet{targets}});
+		}
+		renumbered_pairs[renaming[state]] = pairs[state];
+	}
+	for (const State initial_state : product.initial) { renumbered.initial.insert(renaming[initial_state]); }
+	for (const State final_state : product.final) { renumbered.final.insert(renaming[final_state]); }
+	product = std::move(renumbered);
+	pairs = std::move(renumbered_pairs);
+}
+
+} // namespace
+
+Nfa mata::nfa::algorithms::product_parallel(
+	const Nfa& lhs,
+	const Nfa& rhs,
+	const std::function<bool(State, State)>& final_condition,
+	size_t num_of_threads,
+	const bool deterministic_numbering,
+	const Symbol first_epsilon,
+	std::unordered_map<std::pair<State, State>, State>* product_map
+) {
+	utils::OperationProfile profile{"nfa::product_parallel"};
+	num_of_threads = utils::get_num_of_threads(num_of_threads, std::numeric_limits<size_t>::max());
+	Nfa product{}; // The product automaton.
+	utils::ConcurrentTwoDimensionalMap<State> product_storage{lhs.num_of_states(), rhs.num_of_states()};
+	std::atomic<State> num_of_states{0};
+	std::vector<std::pair<State, State>> pairs{}; // Pairs of original states of the product states.
+	std::vector<ProductState> frontier{}; // Product states discovered in the last round.
+
+	// Initialize pairs to process with initial state pairs.
+	for (const State lhs_initial_state : lhs.initial) {
+		for (const State rhs_initial_state : rhs.initial) {
+			const State product_initial_state{num_of_states++};
+			product_storage.get_or_insert(lhs_initial_state, rhs_initial_state, [&] { return product_initial_state; });
+			frontier.push_back({product_initial_state, lhs_initial_state, rhs_initial_state});
+			product.initial.insert(product_initial_state);
+		}
+	}
+
+	// Posts of the product states computed by each thread.
+	std::vector<std::vector<std::pair<State, StatePost>>> fragments(num_of_threads);
+	// Product states discovered by each thread in the current round.
+	std::vector<std::vector<ProductState>> discovered(num_of_threads);
+	while (!frontier.empty()) {
+		profile.statistics.product_pairs += frontier.size();
+		profile.statistics.macrostates_explored += frontier.size();
+		pairs.resize(num_of_states);
+		for (const auto& [product_state, lhs_state, rhs_state] : frontier) {
+			pairs[product_state] = {lhs_state, rhs_state};
+			if (final_condition(lhs_state, rhs_state)) { product.final.insert(product_state); }
+		}
+
+		const size_t num_of_round_threads{
+			utils::get_num_of_threads(num_of_threads, frontier.size() / MIN_STATES_PER_THREAD)
+		};
+		utils::parallel_for(frontier.size(), num_of_round_threads, [&](const size_t thread_index, const size_t index) {
+			const auto [product_source, lhs_source, rhs_source]{frontier[index]};
+			utils::Budget::poll(num_of_states);
+
+			auto get_product_state = [&](const State lhs_target, const State rhs_target) {
+				const auto [product_target, is_new]{
+					product_storage.get_or_insert(lhs_target, rhs_target, [&] { return num_of_states++; })
+				};
+				if (is_new) { discovered[thread_index].push_back({product_target, lhs_target, rhs_target}); }
+				return product_target;
+			};
+
+			StatePost product_state_post{};
+			std::vector<State> targets{};
+			mata::utils::SynchronizedUniversalIterator<StatePost::const_iterator> sync_iterator(2);
+			mata::utils::push_back(sync_iterator, lhs.delta[lhs_source]);
+			mata::utils::push_back(sync_iterator, rhs.delta[rhs_source]);
+			while (sync_iterator.advance()) {
+				const std::vector<StatePost::const_iterator>& same_symbol_posts{sync_iterator.get_current()};
+				const Symbol symbol{same_symbol_posts[0]->symbol};
+				if (symbol >= first_epsilon) { break; }
+				targets.clear();
+				for (const State lhs_target : same_symbol_posts[0]->targets) {
+					for (const State rhs_target : same_symbol_posts[1]->targets) {
+						targets.push_back(get_product_state(lhs_target, rhs_target));
+					}
+				}
+				product_state_post.push_back(SymbolPost{symbol, StateSet{targets}});
+			}
+
+			// Epsilon transitions from lhs and rhs, merged for each epsilon symbol.
+			std::map<Symbol, std::vector<State>> epsilon_targets{};
+			const StatePost& lhs_state_post{lhs.delta[lhs_source]};
+			for (auto it{lhs_state_post.first_epsilon_it(first_epsilon)}; it != lhs_state_post.end(); ++it) {
+				for (const State lhs_target : it->targets) {
+					epsilon_targets[it->symbol].push_back(get_product_state(lhs_target, rhs_source));
+				}
+			}
+			const StatePost& rhs_state_post{rhs.delta[rhs_source]};
+			for (auto it{rhs_state_post.first_epsilon_it(first_epsilon)}; it != rhs_state_post.end(); ++it) {
+				for (const State rhs_target : it->targets) {
+					epsilon_targets[it->symbol].push_back(get_product_state(lhs_source, rhs_target));
+				}
+			}
+			for (const auto& [epsilon, epsilon_targets_of_symbol] : epsilon_targets) {
+				product_state_post.push_back(SymbolPost{epsilon, StateSet{epsilon_targets_of_symbol}});
+			}
+
+			if (!product_state_post.empty()) {
+				fragments[thread_index].emplace_back(product_source, std::move(product_state_post));
+			}
+		});
+
+		frontier.clear();
+		for (std::vector<ProductState>& discovered_by_thread : discovered) {
+			frontier.insert(frontier.end(), discovered_by_thread.begin(), discovered_by_thread.end());
+			discovered_by_thread.clear();
+		}
+	}
+
+	// Merge the fragments of the transition relation.
+	product.delta.allocate(num_of_states);
+	for (std::vector<std::pair<State, StatePost>>& fragment : fragments) {
+		for (auto& [product_state, product_state_post] : fragment) {
+			product.delta.mutable_state_post(product_state) = std::move(product_state_post);
+		}
+	}
+
+	if (deterministic_numbering) { renumber_breadth_first(product, pairs); }
+	if (product_map != nullptr) {
+		for (State product_state{0}; product_state < pairs.size(); ++product_state) {
+			(*product_map)[pairs[product_state]] = product_state;
+		}
+	}
+	profile.statistics.states_created = product.num_of_states();
+	return product;
+}
+
 } // namespace mata::nfa.
@@ -0,0 +1,328 @@
+/** @file
+ * @brief NFAs with transitions labelled by ranges of symbols.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "mata/nfa/range.hh"
+
+using namespace mata::nfa;
+using mata::BoolVector;
+using mata::Symbol;
+
+namespace {
+/// Range of the continuation bytes of UTF-8 sequences (10xxxxxx).
+constexpr SymbolRange UTF8_CONTINUATION_BYTES{0x80, 0xBF};
+constexpr Symbol MAX_CODE_POINT{0x10'FF'FF};
+
+/// Whether @p range is directly followed by @p next (the ranges are adjacent).
+bool is_followed_by(const SymbolRange& range, const SymbolRange& next) {
+	return range.hi != std::numeric_limits<Symbol>::max() && range.hi + 1 == next.lo;
+}
+
+/// Merge adjacent ranges with the same targets in sorted and pairwise disjoint @p state_post.
+void merge_adjacent(RangeStatePost& state_post) {
+	if (state_post.empty()) { return; }
+	auto last{state_post.begin()};
+	for (auto range_post{state_post.begin() + 1}; range_post != state_post.end(); ++range_post) {
+		if (is_followed_by(last->range, range_post->range) && last->targets == range_post->targets) {
+			last->range.hi = range_post->range.hi;
+		} else if (++last != range_post) {
+			*last = std::move(*range_post);
+		}
+	}
+	state_post.erase(last + 1, state_post.end());
+}
+
+/// Normalize the range posts of a single state, see @c RangeNfa::normalize().
+void normalize_state_post(RangeStatePost& state_post) {
+	std::ranges::sort(state_post, [](const RangePost& lhs, const RangePost& rhs) { return lhs.range < rhs.range; });
+	const bool is_disjoint{std::ranges::adjacent_find(state_post, [](const RangePost& lhs, const RangePost& rhs) {
+		return lhs.range.hi >= rhs.range.lo;
+	}) == state_post.end()};
+	if (is_disjoint) {
+		merge_adjacent(state_post);
+		return;
+	}
+
+	// Sweep over the boundaries of the ranges, keeping the ranges covering the current segment.
+	std::vector<uint64_t> boundaries{};
+	boundaries.reserve(2 * state_post.size());
+	for (const RangePost& range_post : state_post) {
+		boundaries.push_back(range_post.range.lo);
+		boundaries.push_back(uint64_t{range_post.range.hi} + 1);
+	}
+	std::ranges::sort(boundaries);
+	boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+	RangeStatePost segments{};
+	std::vector<const RangePost*> active{};
+	auto next_range_post{state_post.begin()};
+	for (size_t boundary{0}; boundary + 1 < boundaries.size(); ++boundary) {
+		const uint64_t segment_lo{boundaries[boundary]};
+		std::erase_if(active, [&](const RangePost* range_post) { return range_post->range.hi < segment_lo; });
+		for (; next_range_post != state_post.end() && next_range_post->range.lo == segment_lo; ++next_range_post) {
+			active.push_back(&*next_range_post);
+		}
+		if (active.empty()) { continue; }
+		StateSet targets{};
+		for (const RangePost* range_post : active) { targets.insert(range_post->targets); }
+		segments.emplace_back(
+			SymbolRange{static_cast<Symbol>(segment_lo), static_cast<Symbol>(boundaries[boundary + 1] - 1)},
+			std::move(targets)
+		);
+	}
+	merge_adjacent(segments);
+	state_post = std::move(segments);
+}
+
+/// Maximal runs of consecutive symbols from @p post within @p bounds leading to the same targets.
+std::vector<RangePost> symbol_runs(const StatePost& post, const SymbolRange bounds) {
+	std::vector<RangePost> runs{};
+	auto symbol_post{std::lower_bound(post.begin(), post.end(), bounds.lo, [](const SymbolPost& sp, const Symbol lo) {
+		return sp.symbol < lo;
+	})};
+	for (; symbol_post != post.end() && symbol_post->symbol <= bounds.hi; ++symbol_post) {
+		const SymbolRange range{symbol_post->symbol, symbol_post->symbol};
+		if (!runs.empty() && is_followed_by(runs.back().range, range) && runs.back().targets == symbol_post->targets) {
+			runs.back().range.hi = symbol_post->symbol;
+		} else {
+			runs.emplace_back(range, symbol_post->targets);
+		}
+	}
+	return runs;
+}
+} // namespace
+
+size_t RangeNfa::num_of_states() const {
+	return std::max({initial.domain_size(), final.domain_size(), posts.size()});
+}
+
+size_t RangeNfa::num_of_range_posts() const {
+	size_t num_of_range_posts{0};
+	for (const RangeStatePost& state_post : posts) { num_of_range_posts += state_post.size(); }
+	return num_of_range_posts;
+}
+
+void RangeNfa::add(const State source, const SymbolRange range, const State target) {
+	if (range.lo > range.hi) { throw std::runtime_error("Range of symbols has its lower bound above its upper bound"); }
+	const size_t num_of_states_needed{std::max(source, target) + 1};
+	if (posts.size() < num_of_states_needed) { posts.resize(num_of_states_needed); }
+	posts[source].emplace_back(range, StateSet{target});
+}
+
+RangeNfa& RangeNfa::normalize() {
+	for (RangeStatePost& state_post : posts) { normalize_state_post(state_post); }
+	return *this;
+}
+
+bool RangeNfa::is_in_lang(const Run& word) const {
+	StateSet current{initial};
+	for (const Symbol symbol : word.word) {
+		StateSet next{};
+		for (const State state : current) {
+			if (state >= posts.size()) { continue; }
+			const RangeStatePost& state_post{posts[state]};
+			const auto range_post{std::ranges::upper_bound(
+				state_post, symbol, std::less<>{}, [](const RangePost& range_post) { return range_post.range.lo; }
+			)};
+			if (range_post != state_post.begin() && std::prev(range_post)->range.contains(symbol)) {
+				next.insert(std::prev(range_post)->targets);
+			}
+		}
+		if (next.empty()) { return false; }
+		current = std::move(next);
+	}
+	return std::ranges::any_of(current, [&](const State state) { return final.contains(state); });
+}
+
+RangeNfa RangeNfa::from_nfa(const Nfa& nfa) {
+	RangeNfa result{nfa.delta.num_of_states()};
+	result.initial = nfa.initial;
+	result.final = nfa.final;
+	for (State state{0}; state < nfa.delta.num_of_states(); ++state) {
+		result.posts[state] =
+			symbol_runs(nfa.delta[state], SymbolRange{0, std::numeric_limits<Symbol>::max()});
+	}
+	return result;
+}
+
+Nfa RangeNfa::to_nfa() const {
+	Nfa result{Delta(posts.size()), initial, final};
+	for (State state{0}; state < posts.size(); ++state) {
+		StatePost& state_post{result.delta.mutable_state_post(state)};
+		for (const RangePost& range_post : posts[state]) {
+			for (uint64_t symbol{range_post.range.lo}; symbol <= range_post.range.hi; ++symbol) {
+				state_post.emplace_back(static_cast<Symbol>(symbol), range_post.targets);
+			}
+		}
+	}
+	return result;
+}
+
+RangeNfa mata::nfa::decode_utf8_ranges(const Nfa& aut) {
+	RangeNfa result{aut.num_of_states()};
+	result.initial = aut.initial;
+	result.final = aut.final;
+	BoolVector used(aut.num_of_states(), false);
+	std::vector<State> worklist{};
+	auto push_state_set = [&](const StateSet& set) {
+		for (const State state : set) {
+			if (used[state]) { continue; }
+			worklist.push_back(state);
+			used[state] = true;
+		}
+	};
+	auto post_of = [&](const State state) -> const StatePost& {
+		static const StatePost EMPTY_POST{};
+		return state < aut.delta.num_of_states() ? aut.delta[state] : EMPTY_POST;
+	};
+
+	// See Nfa::decode_utf8() for the byte patterns. The bytes of a sequence except for the last one are decoded one by
+	//  one, the runs of the last continuation bytes with the same targets form ranges of code points.
+	push_state_set(StateSet{aut.initial});
+	while (!worklist.empty()) {
+		const State q1{worklist.back()};
+		worklist.pop_back();
+		RangeStatePost& state_post{result.posts[q1]};
+		auto add_range = [&](const Symbol prefix, const RangePost& run, const Symbol min_code_point) {
+			const Symbol lo{std::max(prefix | (run.range.lo & 0x3F), min_code_point)};
+			const Symbol hi{std::min(prefix | (run.range.hi & 0x3F), MAX_CODE_POINT)};
+			if (lo > hi) { return; } // Invalid UTF-8 sequences.
+			state_post.emplace_back(SymbolRange{lo, hi}, run.targets);
+			push_state_set(run.targets);
+		};
+
+		for (const RangePost& run : symbol_runs(post_of(q1), SymbolRange{0x00, 0x7F})) {
+			state_post.push_back(run);
+			push_state_set(run.targets);
+		}
+		for (const SymbolPost& sp1 : post_of(q1)) {
+			const Symbol s1{sp1.symbol};
+			if (s1 < 0xC0 || s1 > 0xF7) { continue; }
+			for (const State q2 : sp1.targets) {
+				if ((s1 & 0xE0) == 0xC0) {
+					for (const RangePost& run : symbol_runs(post_of(q2), UTF8_CONTINUATION_BYTES)) {
+						add_range((s1 & 0x1F) << 6, run, 0x80);
+					}
+					continue;
+				}
+				for (const SymbolPost& sp2 : post_of(q2)) {
+					const Symbol s2{sp2.symbol};
+					if (!UTF8_CONTINUATION_BYTES.contains(s2)) { continue; }
+					for (const State q3 : sp2.targets) {
+						if ((s1 & 0xF0) == 0xE0) {
+							for (const RangePost& run : symbol_runs(post_of(q3), UTF8_CONTINUATION_BYTES)) {
+								add_range(((s1 & 0x0F) << 12) | ((s2 & 0x3F) << 6), run, 0x8'00);
+							}
+							continue;
+						}
+						for (const SymbolPost& sp3 : post_of(q3)) {
+							const Symbol s3{sp3.symbol};
+							if (!UTF8_CONTINUATION_BYTES.contains(s3)) { continue; }
+							for (const State q4 : sp3.targets) {
+								for (const RangePost& run : symbol_runs(post_of(q4), UTF8_CONTINUATION_BYTES)) {
+									add_range(((s1 & 0x07) << 18) | ((s2 & 0x3F) << 12) | ((s3 & 0x3F) << 6), run,
+											  0x1'00'00);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+		normalize_state_post(state_post);
+	}
+	return result;
+}
+
+RangeNfa mata::nfa::intersection(const RangeNfa& lhs, const RangeNfa& rhs) {
+	RangeNfa result{};
+	std::unordered_map<std::pair<State, State>, State> product_map{};
+	std::vector<std::pair<State, State>> worklist{};
+	auto get_product_state = [&](const State lhs_state, const State rhs_state) {
+		const auto [it, inserted]{product_map.try_emplace({ lhs_state, rhs_state }, result.posts.size())};
+		if (inserted) {
+			result.posts.emplace_back();
+			worklist.emplace_back(lhs_state, rhs_state);
+			if (lhs.final.contains(lhs_state) && rhs.final.contains(rhs_state)) { result.final.insert(it->second); }
+		}
+		return it->second;
+	};
+	for (const State lhs_initial : lhs.initial) {
+		for (const State rhs_initial : rhs.initial) {
+			result.initial.insert(get_product_state(lhs_initial, rhs_initial));
+		}
+	}
+
+	static const RangeStatePost EMPTY_POST{};
+	while (!worklist.empty()) {
+		const auto [lhs_state, rhs_state]{worklist.back()};
+		worklist.pop_back();
+		const RangeStatePost& lhs_post{lhs_state < lhs.posts.size() ? lhs.posts[lhs_state] : EMPTY_POST};
+		const RangeStatePost& rhs_post{rhs_state < rhs.posts.size() ? rhs.posts[rhs_state] : EMPTY_POST};
+		RangeStatePost state_post{};
+		auto lhs_range_post{lhs_post.begin()};
+		auto rhs_range_post{rhs_post.begin()};
+		while (lhs_range_post != lhs_post.end() && rhs_range_post != rhs_post.end()) {
+			const SymbolRange range{
+				std::max(lhs_range_post->range.lo, rhs_range_post->range.lo),
+				std::min(lhs_range_post->range.hi, rhs_range_post->range.hi)
+			};
+			if (range.lo <= range.hi) {
+				std::vector<State> targets{};
+				targets.reserve(lhs_range_post->targets.size() * rhs_range_post->targets.size());
+				for (const State lhs_target : lhs_range_post->targets) {
+					for (const State rhs_target : rhs_range_post->targets) {
+						targets.push_back(get_product_state(lhs_target, rhs_target));
+					}
+				}
+				state_post.emplace_back(range, StateSet{targets});
+			}
+			if (lhs_range_post->range.hi <= rhs_range_post->range.hi) { ++lhs_range_post; }
+			if (range.hi == rhs_range_post->range.hi) { ++rhs_range_post; }
+		}
+		merge_adjacent(state_post);
+		result.posts[product_map.at({ lhs_state, rhs_state })] = std::move(state_post);
+	}
+	return result;
+}
+
+RangeNfa mata::nfa::determinize(const RangeNfa& aut, std::unordered_map<StateSet, State>* subset_map) {
+	RangeNfa result{};
+	std::unordered_map<StateSet, State> local_subset_map{};
+	if (subset_map == nullptr) { subset_map = &local_subset_map; }
+	std::vector<std::pair<State, StateSet>> worklist{};
+	auto get_macrostate = [&](const StateSet& macrostate) {
+		const auto [it, inserted]{subset_map->try_emplace(macrostate, result.posts.size())};
+		if (inserted) {
+			result.posts.emplace_back();
+			worklist.emplace_back(it->second, macrostate);
+			if (std::ranges::any_of(macrostate, [&](const State state) { return aut.final.contains(state); })) {
+				result.final.insert(it->second);
+			}
+		}
+		return it->second;
+	};
+	if (aut.initial.empty()) { return result; }
+	result.initial.insert(get_macrostate(StateSet{aut.initial}));
+
+	while (!worklist.empty()) {
+		const auto [macrostate_state, macrostate]{std::move(worklist.back())};
+		worklist.pop_back();
+		RangeStatePost united_post{};
+		for (const State state : macrostate) {
+			if (state >= aut.posts.size()) { continue; }
+			united_post.insert(united_post.end(), aut.posts[state].begin(), aut.posts[state].end());
+		}
+		normalize_state_post(united_post);
+		RangeStatePost state_post{};
+		state_post.reserve(united_post.size());
+		for (const RangePost& range_post : united_post) {
+			state_post.emplace_back(range_post.range, StateSet{get_macrostate(range_post.targets)});
+		}
+		result.posts[macrostate_state] = std::move(state_post);
+	}
+	return result;
+}
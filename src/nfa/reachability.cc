@@ -0,0 +1,227 @@
+/** @file
+ * @brief Bit-parallel reachability, trimming and emptiness for NFAs.
+ */
+
+#include <bit>
+#include <span>
+
+#include "mata/nfa/algorithms.hh"
+#include "mata/nfa/nfa.hh"
+
+using namespace mata::nfa;
+using mata::BoolVector;
+using mata::utils::SparseSet;
+
+namespace {
+/// Minimal number of states for which the bit-parallel algorithms are used automatically.
+constexpr size_t DENSE_MIN_NUM_OF_STATES{128};
+/// Minimal average number of transitions per state for which the bit-parallel algorithms are used automatically.
+constexpr size_t DENSE_MIN_TRANSITIONS_PER_STATE{16};
+/// Switch to the bottom-up step when the frontier has more than 1/ALPHA of the edges of the unvisited states.
+constexpr size_t TOP_DOWN_TO_BOTTOM_UP_RATIO{14};
+/// Switch back to the top-down step when the frontier has less than 1/BETA of all states.
+constexpr size_t BOTTOM_UP_TO_TOP_DOWN_RATIO{24};
+
+constexpr size_t BLOCK_SIZE{64};
+
+/// Set of states represented as a bit vector of 64-bit blocks.
+class StateBits {
+  public:
+	explicit StateBits(const size_t num_of_states) : blocks_((num_of_states + BLOCK_SIZE - 1) / BLOCK_SIZE, 0) {}
+
+	bool contains(const State state) const {
+		return (blocks_[state / BLOCK_SIZE] >> (state % BLOCK_SIZE) & uint64_t{1}) != 0;
+	}
+	void insert(const State state) { blocks_[state / BLOCK_SIZE] |= uint64_t{1} << (state % BLOCK_SIZE); }
+	void clear() { std::ranges::fill(blocks_, 0); }
+	size_t num_of_blocks() const { return blocks_.size(); }
+	uint64_t block(const size_t index) const { return blocks_[index]; }
+
+	/// Call @p function for each state in the set.
+	template <class Function> void for_each(Function function) const {
+		for (size_t index{0}; index < blocks_.size(); ++index) {
+			for (uint64_t bits{blocks_[index]}; bits != 0; bits &= bits - 1) {
+				function(index * BLOCK_SIZE + static_cast<size_t>(std::countr_zero(bits)));
+			}
+		}
+	}
+
+	void swap(StateBits& other) noexcept { blocks_.swap(other.blocks_); }
+
+  private:
+	std::vector<uint64_t> blocks_;
+};
+
+/**
+ * @brief Unlabelled transition graph of an automaton in compressed sparse row format, for both directions.
+ */
+class StateGraph {
+  public:
+	StateGraph(const Delta& delta, const size_t num_of_states)
+		: successor_offsets_(num_of_states + 1, 0),
+		  predecessor_offsets_(num_of_states + 1, 0) {
+		const size_t num_of_delta_states{std::min(delta.num_of_states(), num_of_states)};
+		for (State source{0}; source < num_of_delta_states; ++source) {
+			for (const SymbolPost& symbol_post : delta[source]) {
+				successor_offsets_[source + 1] += symbol_post.num_of_targets();
+				for (const State target : symbol_post.targets) { ++predecessor_offsets_[target + 1]; }
+			}
+		}
+		for (State state{0}; state < num_of_states; ++state) {
+			successor_offsets_[state + 1] += successor_offsets_[state];
+			predecessor_offsets_[state + 1] += predecessor_offsets_[state];
+		}
+		successors_.resize(successor_offsets_.back());
+		predecessors_.resize(predecessor_offsets_.back());
+		std::vector<size_t> predecessor_positions(predecessor_offsets_.begin(), predecessor_offsets_.end() - 1);
+		for (State source{0}; source < num_of_delta_states; ++source) {
+			size_t successor_position{successor_offsets_[source]};
+			for (const SymbolPost& symbol_post : delta[source]) {
+				for (const State target : symbol_post.targets) {
+					successors_[successor_position++] = target;
+					predecessors_[predecessor_positions[target]++] = source;
+				}
+			}
+		}
+	}
+
+	size_t num_of_states() const { return successor_offsets_.size() - 1; }
+	size_t num_of_edges() const { return successors_.size(); }
+
+	/// Get the neighbours of @p state: successors when searching forward, predecessors when searching backward.
+	std::span<const State> next(const State state, const bool backward) const {
+		if (backward) { return range(predecessors_, predecessor_offsets_, state); }
+		return range(successors_, successor_offsets_, state);
+	}
+	/// Get the neighbours of @p state in the opposite direction than @c next().
+	std::span<const State> previous(const State state, const bool backward) const { return next(state, !backward); }
+
+  private:
+	static std::span<const State>
+		range(const std::vector<State>& states, const std::vector<size_t>& offsets, const State state) {
+		return {states.data() + offsets[state], offsets[state + 1] - offsets[state]};
+	}
+
+	std::vector<size_t> successor_offsets_;
+	std::vector<State> successors_{};
+	std::vector<size_t> predecessor_offsets_;
+	std::vector<State> predecessors_{};
+};
+
+/**
+ * @brief Direction-optimizing breadth-first search from @p sources over frontiers represented as bit vectors.
+ *
+ * @param[in] graph Graph to search in.
+ * @param[in] sources States to start from.
+ * @param[in] backward Whether to search over reverted edges.
+ * @param[in] stop_states Optional states to stop the search at as soon as any of them is reached.
+ * @return Reached states and whether some of @p stop_states was reached.
+ */
+std::pair<StateBits, bool> frontier_search(
+	const StateGraph& graph,
+	const SparseSet<State>& sources,
+	const bool backward,
+	const StateBits* stop_states = nullptr
+) {
+	const size_t num_of_states{graph.num_of_states()};
+	StateBits visited{num_of_states};
+	StateBits frontier{num_of_states};
+	StateBits next_frontier{num_of_states};
+	size_t frontier_size{0};
+	// Edges to check from the frontier (top-down) and from the unvisited states (bottom-up).
+	size_t frontier_edges{0};
+	size_t unvisited_edges{graph.num_of_edges()};
+	bool stopped{false};
+
+	auto visit = [&](const State state, StateBits& new_frontier) {
+		visited.insert(state);
+		new_frontier.insert(state);
+		++frontier_size;
+		frontier_edges += graph.next(state, backward).size();
+		unvisited_edges -= graph.previous(state, backward).size();
+		if (stop_states != nullptr && stop_states->contains(state)) { stopped = true; }
+	};
+
+	for (const State source : sources) {
+		if (source < num_of_states && !visited.contains(source)) { visit(source, frontier); }
+	}
+
+	bool bottom_up{false};
+	while (frontier_size > 0 && !stopped) {
+		if (!bottom_up && frontier_edges > unvisited_edges / TOP_DOWN_TO_BOTTOM_UP_RATIO) {
+			bottom_up = true;
+		} else if (bottom_up && frontier_size < num_of_states / BOTTOM_UP_TO_TOP_DOWN_RATIO) {
+			bottom_up = false;
+		}
+
+		next_frontier.clear();
+		frontier_size = 0;
+		frontier_edges = 0;
+		if (bottom_up) {
+			for (size_t index{0}; index < visited.num_of_blocks(); ++index) {
+				for (uint64_t unvisited{~visited.block(index)}; unvisited != 0; unvisited &= unvisited - 1) {
+					const State state{index * BLOCK_SIZE + static_cast<size_t>(std::countr_zero(unvisited))};
+					if (state >= num_of_states) { break; }
+					for (const State neighbour : graph.previous(state, backward)) {
+						if (frontier.contains(neighbour)) {
+							visit(state, next_frontier);
+							break;
+						}
+					}
+				}
+			}
+		} else {
+			frontier.for_each([&](const State state) {
+				for (const State neighbour : graph.next(state, backward)) {
+					if (!visited.contains(neighbour)) { visit(neighbour, next_frontier); }
+				}
+			});
+		}
+		frontier.swap(next_frontier);
+	}
+	return {std::move(visited), stopped};
+}
+
+BoolVector to_bool_vector(const StateBits& states, const size_t num_of_states) {
+	BoolVector result(num_of_states, false);
+	states.for_each([&](const State state) { result[state] = true; });
+	return result;
+}
+} // namespace
+
+bool mata::nfa::algorithms::is_dense(const Nfa& aut) {
+	const size_t num_of_states{aut.num_of_states()};
+	return num_of_states >= DENSE_MIN_NUM_OF_STATES &&
+		   aut.delta.num_of_transitions() >= DENSE_MIN_TRANSITIONS_PER_STATE * num_of_states;
+}
+
+BoolVector mata::nfa::algorithms::get_reachable_states_bit_parallel(
+	const Nfa& aut, const SparseSet<State>& sources, const bool backward
+) {
+	const StateGraph graph{aut.delta, aut.num_of_states()};
+	return to_bool_vector(frontier_search(graph, sources, backward).first, graph.num_of_states());
+}
+
+BoolVector mata::nfa::algorithms::get_useful_states_bit_parallel(
+	const Nfa& aut, const SparseSet<State>& initial_states, const SparseSet<State>& final_states
+) {
+	const StateGraph graph{aut.delta, aut.num_of_states()};
+	const StateBits reachable{frontier_search(graph, initial_states, false).first};
+	SparseSet<State> reachable_final_states{};
+	for (const State state : final_states) {
+		if (state < graph.num_of_states() && reachable.contains(state)) { reachable_final_states.insert(state); }
+	}
+	const StateBits reaching{frontier_search(graph, reachable_final_states, true).first};
+	BoolVector useful(graph.num_of_states(), false);
+	reachable.for_each([&](const State state) { useful[state] = reaching.contains(state); });
+	return useful;
+}
+
+bool mata::nfa::algorithms::is_lang_empty_bit_parallel(const Nfa& aut) {
+	const StateGraph graph{aut.delta, aut.num_of_states()};
+	StateBits final_states{graph.num_of_states()};
+	for (const State state : aut.final) {
+		if (state < graph.num_of_states()) { final_states.insert(state); }
+	}
+	return !frontier_search(graph, aut.initial, false, &final_states).second;
+}
@@ -0,0 +1,243 @@
+/* result-cache.cc -- Cache of results of expensive NFA operations
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include "mata/nfa/result-cache.hh"
+#include "mata/parser/binary.hh"
+
+using namespace mata::nfa;
+using mata::utils::OrdVector;
+
+namespace {
+
+/// Extension of the files in the cache directory.
+constexpr const char* ENTRY_EXTENSION{".mata-cache"};
+
+/**
+ * @brief Describe the operation @p operation with @p params (in a deterministic order) and @p symbols.
+ */
+std::string make_key(
+	const std::string& operation, const mata::nfa::ParameterMap& params,
+	const OrdVector<mata::Symbol>* symbols = nullptr
+) {
+	std::vector<std::pair<std::string, std::string>> sorted_params(params.begin(), params.end());
+	std::ranges::sort(sorted_params);
+	std::string key{operation};
+	for (const auto& [name, value] : sorted_params) { key += ";" + name + "=" + value; }
+	if (symbols != nullptr) {
+		key += ";symbols=";
+		for (const mata::Symbol symbol : *symbols) { key += std::to_string(symbol) + ","; }
+	}
+	return key;
+}
+
+/// Whether @p lhs and @p rhs are the same input of an operation (including the isolated states).
+bool is_same_input(const Nfa& lhs, const Nfa& rhs) {
+	return lhs.num_of_states() == rhs.num_of_states() && lhs.is_identical(rhs);
+}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of @p key followed by @p input_binary.
+ *
+ * Unlike @c std::hash, the hash does not depend on the standard library implementation, so the names of the entries
+ *  in the cache directory are the same across builds and platforms.
+ */
+uint64_t get_disk_hash(const std::string& key, const std::string& input_binary) {
+	constexpr uint64_t FNV_OFFSET_BASIS{0xcbf29ce484222325};
+	constexpr uint64_t FNV_PRIME{0x100000001b3};
+	uint64_t hash{FNV_OFFSET_BASIS};
+	for (const std::string* const bytes : {&key, &input_binary}) {
+		for (const char byte : *bytes) {
+			hash ^= static_cast<uint8_t>(byte);
+			hash *= FNV_PRIME;
+		}
+	}
+	return hash;
+}
+
+void write_size(std::ostream& output, uint64_t size) {
+	for (size_t i{0}; i < sizeof(size); ++i) { output.put(static_cast<char>((size >> (8 * i)) & 0xFF)); }
+}
+
+/**
+ * @brief Read a size written by @c write_size() from @p data at @p position, and move @p position past it.
+ */
+std::optional<uint64_t> read_size(std::span<const std::byte> data, size_t& position) {
+	if (data.size() - position < sizeof(uint64_t)) { return std::nullopt; }
+	uint64_t size{0};
+	for (size_t i{0}; i < sizeof(size); ++i) {
+		size |= static_cast<uint64_t>(std::to_integer<uint8_t>(data[position + i])) << (8 * i);
+	}
+	position += sizeof(size);
+	return size;
+}
+
+} // namespace
+
+ResultCache::ResultCache(size_t max_num_of_entries, std::optional<std::filesystem::path> directory)
+	: max_num_of_entries_{max_num_of_entries}, directory_{std::move(directory)} {
+	if (directory_.has_value()) { std::filesystem::create_directories(*directory_); }
+}
+
+Nfa ResultCache::determinize(const Nfa& aut) {
+	return get_or_compute(make_key("determinize", {}), aut, [&aut]() { return mata::nfa::determinize(aut); });
+}
+
+Nfa ResultCache::minimize(const Nfa& aut, const ParameterMap& params) {
+	return get_or_compute(make_key("minimize", params), aut, [&]() { return mata::nfa::minimize(aut, params); });
+}
+
+Nfa ResultCache::reduce(const Nfa& aut, const ParameterMap& params) {
+	return get_or_compute(make_key("reduce", params), aut, [&]() { return mata::nfa::reduce(aut, nullptr, params); });
+}
+
+Nfa ResultCache::complement(const Nfa& aut, const OrdVector<Symbol>& symbols, const ParameterMap& params) {
+	return get_or_compute(make_key("complement", params, &symbols), aut, [&]() {
+		return mata::nfa::complement(aut, symbols, params);
+	});
+}
+
+Nfa ResultCache::complement(const Nfa& aut, const Alphabet& alphabet, const ParameterMap& params) {
+	return complement(aut, alphabet.get_alphabet_symbols(), params);
+}
+
+ResultCache::Statistics ResultCache::get_statistics() const {
+	const std::lock_guard lock{mutex_};
+	return statistics_;
+}
+
+size_t ResultCache::num_of_entries() const {
+	const std::lock_guard lock{mutex_};
+	return entries_.size();
+}
+
+void ResultCache::clear() {
+	const std::lock_guard lock{mutex_};
+	entries_.clear();
+	index_.clear();
+}
+
+Nfa ResultCache::get_or_compute(const std::string& key, const Nfa& aut, const std::function<Nfa()>& compute) {
+	const size_t hash{utils::hash_combine(std::hash<std::string>{}(key), aut)};
+	{
+		const std::lock_guard lock{mutex_};
+		if (std::optional<Nfa> result{find_in_memory(hash, key, aut)}; result.has_value()) {
+			++statistics_.hits;
+			return std::move(*result);
+		}
+	}
+
+	std::string input_binary{};
+	if (directory_.has_value()) {
+		std::ostringstream input{};
+		parser::write_binary(aut, input);
+		input_binary = input.str();
+		if (std::optional<Nfa> result{find_on_disk(key, aut, input_binary)}; result.has_value()) {
+			const std::lock_guard lock{mutex_};
+			++statistics_.disk_hits;
+			insert_in_memory(hash, key, aut, *result);
+			return std::move(*result);
+		}
+	}
+
+	Nfa result{compute()};
+	if (directory_.has_value()) { store_on_disk(key, input_binary, result); }
+	const std::lock_guard lock{mutex_};
+	++statistics_.misses;
+	insert_in_memory(hash, key, aut, result);
+	return result;
+}
+
+std::optional<Nfa> ResultCache::find_in_memory(size_t hash, const std::string& key, const Nfa& aut) {
+	const auto index_it{index_.find(hash)};
+	if (index_it == index_.end()) { return std::nullopt; }
+	for (const std::list<Entry>::iterator& entry_it : index_it->second) {
+		if (entry_it->key == key && is_same_input(entry_it->input, aut)) {
+			entries_.splice(entries_.begin(), entries_, entry_it); // Mark as the most recently used.
+			return entry_it->result;
+		}
+	}
+	return std::nullopt;
+}
+
+void ResultCache::insert_in_memory(size_t hash, const std::string& key, const Nfa& aut, const Nfa& result) {
+	if (max_num_of_entries_ == 0) { return; }
+	// Another thread may have inserted the same entry while the result was being computed.
+	if (find_in_memory(hash, key, aut).has_value()) { return; }
+	while (entries_.size() >= max_num_of_entries_) {
+		const std::list<Entry>::iterator least_recent{std::prev(entries_.end())};
+		std::vector<std::list<Entry>::iterator>& bucket{index_[least_recent->hash]};
+		std::erase(bucket, least_recent);
+		if (bucket.empty()) { index_.erase(least_recent->hash); }
+		entries_.pop_back();
+		++statistics_.evictions;
+	}
+	entries_.push_front(Entry{hash, key, aut, result});
+	index_[hash].push_back(entries_.begin());
+}
+
+std::filesystem::path ResultCache::entry_path(const uint64_t hash) const {
+	std::ostringstream name{};
+	name << std::hex << hash << ENTRY_EXTENSION;
+	return *directory_ / name.str();
+}
+
+// The entry file consists of the size of the key, the key, the size of the input automaton in the binary format,
+//  the input automaton, and the result in the binary format. Entries with colliding hashes overwrite each other.
+std::optional<Nfa> ResultCache::find_on_disk(
+	const std::string& key, const Nfa& aut, const std::string& input_binary
+) const {
+	std::ifstream file{entry_path(get_disk_hash(key, input_binary)), std::ios::binary};
+	if (!file) { return std::nullopt; }
+	const std::string content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+	const std::span<const std::byte> data{reinterpret_cast<const std::byte*>(content.data()), content.size()};
+
+	try {
+		size_t position{0};
+		const std::optional<uint64_t> key_size{read_size(data, position)};
+		if (!key_size.has_value() || *key_size != key.size() || data.size() - position < key.size() ||
+			content.compare(position, key.size(), key) != 0) {
+			return std::nullopt;
+		}
+		position += *key_size;
+		const std::optional<uint64_t> input_size{read_size(data, position)};
+		if (!input_size.has_value() || data.size() - position < *input_size) { return std::nullopt; }
+		if (!is_same_input(parser::read_nfa_binary(data.subspan(position, *input_size)), aut)) { return std::nullopt; }
+		position += *input_size;
+		return parser::read_nfa_binary(data.subspan(position));
+	} catch (const std::runtime_error&) {
+		return std::nullopt; // A corrupted entry is a miss; it is overwritten when the result is stored.
+	}
+}
+
+// Storing is best-effort: when the entry cannot be written (e.g., the directory is read-only or the disk is full), the
+//  result is only kept in memory.
+void ResultCache::store_on_disk(const std::string& key, const std::string& input_binary, const Nfa& result) const {
+	const std::filesystem::path path{entry_path(get_disk_hash(key, input_binary))};
+	std::filesystem::path temporary_path{path};
+	temporary_path += "." + std::to_string(std::random_device{}()) + ".tmp";
+	std::error_code error{};
+	{
+		std::ofstream file{temporary_path, std::ios::binary | std::ios::trunc};
+		if (!file) { return; }
+		write_size(file, key.size());
+		file << key;
+		write_size(file, input_binary.size());
+		file << input_binary;
+		parser::write_binary(result, file);
+		file.flush();
+		if (!file) {
+			file.close();
+			std::filesystem::remove(temporary_path, error);
+			return;
+		}
+	}
+	// Renaming replaces the entry atomically, so that concurrent readers never see a partially written entry.
+	std::filesystem::rename(temporary_path, path, error);
+	if (error) { std::filesystem::remove(temporary_path, error); }
+}
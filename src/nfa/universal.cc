@@ -1,38 +1,183 @@
 /* nfa-universal.cc -- NFA universality
  */
 
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <vector>
+
 // MATA headers
 #include "mata/nfa/algorithms.hh"
 #include "mata/nfa/nfa.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/parallel.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/sparse-set.hh"
 
 using namespace mata::nfa;
 using namespace mata::utils;
+using mata::Symbol;
+using mata::Word;
 
 // TODO: this could be merged with inclusion, or even removed, universality could be implemented using inclusion,
 //  it is not something needed in practice, so some little overhead is ok
 
 bool mata::nfa::algorithms::is_universal_naive(const Nfa& aut, const Alphabet& alphabet, Run* cex) {
+	OperationProfile profile{"nfa::is_universal_naive"};
 	return complement(aut, alphabet).is_lang_empty(cex);
 }
 
-bool mata::nfa::algorithms::is_universal_antichains(const Nfa& aut, const Alphabet& alphabet,
-													Run* cex) { // {{{
+namespace {
 
-	using WorklistType = std::list<StateSet>;
-	using ProcessedType = std::list<StateSet>;
+/// The posts of a round are computed sequentially if there are fewer than this number of them per thread, as starting
+///  the threads would take longer than computing the posts.
+constexpr size_t MIN_POSTS_PER_THREAD{256};
 
-	auto subsumes = [](const StateSet& lhs, const StateSet& rhs) {
-		if (lhs.size() > rhs.size()) { // bigger set cannot be subset
-			return false;
+/// Compute the post of @p macrostate over @p symbol. The targets are collected into a local vector and sorted once
+///  instead of being united one symbol post at a time; only local data are written, so the posts of a round can be
+///  computed concurrently.
+StateSet compute_post(const Nfa& aut, const StateSet& macrostate, const Symbol symbol) {
+	std::vector<State> targets{};
+	for (const State state : macrostate) {
+		const StatePost& state_post{aut.delta[state]};
+		if (const auto symbol_post_it{state_post.find(symbol)}; symbol_post_it != state_post.end()) {
+			targets.insert(targets.end(), symbol_post_it->targets.begin(), symbol_post_it->targets.end());
+		}
+	}
+	return StateSet{targets};
+}
+
+/// Get a Bloom filter of @p macrostate. A macrostate can be a subset of another one only if its signature is.
+uint64_t get_signature(const StateSet& macrostate) {
+	uint64_t signature{0};
+	for (const State state : macrostate) { signature |= uint64_t{1} << (state % 64); }
+	return signature;
+}
+
+/**
+ * Antichain of the macrostates reached by the universality check, grouped by their sizes, so that only the macrostates
+ *  which are not bigger (not smaller) are tested for being a subset (a superset) of another macrostate.
+ *
+ * The macrostates are identified by the order of their insertion. A removed macrostate is released, but its identifier
+ *  keeps its predecessor for building a counterexample.
+ */
+class Antichain {
+public:
+	static constexpr size_t NO_PREDECESSOR{std::numeric_limits<size_t>::max()};
+
+	/// Whether some macrostate in the antichain is a subset of @p macrostate with the signature @p signature.
+	bool subsumes(const StateSet& macrostate, const uint64_t signature) const {
+		for (size_t size{0}; size <= macrostate.size() && size < ids_by_size_.size(); ++size) {
+			for (const size_t id : ids_by_size_[size]) {
+				if ((signatures_[id] & ~signature) == 0 && macrostates_[id].is_subset_of(macrostate)) { return true; }
+			}
+		}
+		return false;
+	}
+
+	/// Remove the supersets of @p macrostate with the signature @p signature.
+	/// @return Number of the removed macrostates.
+	size_t remove_supersets(const StateSet& macrostate, const uint64_t signature) {
+		size_t num_of_removed{0};
+		for (size_t size{macrostate.size()}; size < ids_by_size_.size(); ++size) {
+			num_of_removed += std::erase_if(ids_by_size_[size], [&](const size_t id) {
+				if ((signature & ~signatures_[id]) != 0 || !macrostate.is_subset_of(macrostates_[id])) { return false; }
+				macrostates_[id] = StateSet{};
+				is_removed_[id] = true;
+				return true;
+			});
+		}
+		size_ -= num_of_removed;
+		return num_of_removed;
+	}
+
+	/// Insert @p macrostate reached from the macrostate @p predecessor over @p symbol. @return Id of the macrostate.
+	size_t insert(StateSet macrostate, const uint64_t signature, const size_t predecessor, const Symbol symbol) {
+		const size_t id{macrostates_.size()};
+		if (ids_by_size_.size() <= macrostate.size()) { ids_by_size_.resize(macrostate.size() + 1); }
+		ids_by_size_[macrostate.size()].push_back(id);
+		macrostates_.push_back(std::move(macrostate));
+		signatures_.push_back(signature);
+		is_removed_.push_back(false);
+		predecessors_.emplace_back(predecessor, symbol);
+		++size_;
+		return id;
+	}
+
+	const StateSet& operator[](const size_t id) const { return macrostates_[id]; }
+	bool contains(const size_t id) const { return !is_removed_[id]; }
+	/// Get the number of the macrostates in the antichain (not removed).
+	size_t size() const { return size_; }
+
+	/// Get the word leading from the initial macrostate to the macrostate @p id.
+	Word get_word(size_t id) const {
+		Word word{};
+		for (; predecessors_[id].first != NO_PREDECESSOR; id = predecessors_[id].first) {
+			word.push_back(predecessors_[id].second);
+		}
+		std::ranges::reverse(word);
+		return word;
+	}
+
+private:
+	std::vector<StateSet> macrostates_{};
+	std::vector<uint64_t> signatures_{};
+	std::vector<bool> is_removed_{};
+	std::vector<std::pair<size_t, Symbol>> predecessors_{};
+	std::vector<std::vector<size_t>> ids_by_size_{};
+	size_t size_{0};
+};
+
+/// Worklist of the ids of the macrostates to process, ordered by @c algorithms::SearchStrategy.
+class Worklist {
+public:
+	explicit Worklist(const algorithms::SearchStrategy strategy) : strategy_{strategy} {}
+
+	void push(const size_t id, const size_t size) {
+		if (strategy_ == algorithms::SearchStrategy::SmallestFirst) {
+			smallest_first_.emplace(size, id);
+		} else {
+			ids_.push_back(id);
 		}
+	}
 
-		return std::ranges::includes(rhs, lhs);
-	};
+	size_t pop() {
+		size_t id;
+		if (strategy_ == algorithms::SearchStrategy::SmallestFirst) {
+			id = smallest_first_.top().second;
+			smallest_first_.pop();
+		} else if (strategy_ == algorithms::SearchStrategy::Dfs) {
+			id = ids_.back();
+			ids_.pop_back();
+		} else {
+			id = ids_.front();
+			ids_.pop_front();
+		}
+		return id;
+	}
 
-	// process parameters
-	// TODO: set correctly!!!!
-	constexpr bool is_dfs = true;
+	bool empty() const { return ids_.empty() && smallest_first_.empty(); }
+
+private:
+	algorithms::SearchStrategy strategy_;
+	std::deque<size_t> ids_{};
+	/// Pairs (size, id) of the macrostates, the smallest (and the oldest of the same size) on the top.
+	std::priority_queue<std::pair<size_t, size_t>, std::vector<std::pair<size_t, size_t>>, std::greater<>>
+		smallest_first_{};
+};
+
+} // namespace
+
+bool mata::nfa::algorithms::is_universal_antichains(const Nfa& aut, const Alphabet& alphabet, Run* cex) {
+	return is_universal_antichains(aut, alphabet, cex, SearchStrategy::Dfs, 1);
+}
+
+bool mata::nfa::algorithms::is_universal_antichains(
+	const Nfa& aut, const Alphabet& alphabet, Run* cex, const SearchStrategy strategy, size_t num_of_threads
+) { // {{{
+	OperationProfile profile{"nfa::is_universal_antichains"};
 
 	// check the initial state
 	if (are_disjoint(aut.initial, aut.final)) {
@@ -40,85 +185,95 @@ bool mata::nfa::algorithms::is_universal_antichains(const Nfa& aut, const Alphab
 		return false;
 	}
 
-	// initialize
-	WorklistType worklist = {StateSet(aut.initial)};
-	ProcessedType processed = {StateSet(aut.initial)};
-	mata::utils::OrdVector<Symbol> alph_symbols = alphabet.get_alphabet_symbols();
+	const mata::utils::OrdVector<Symbol> alphabet_symbols{alphabet.get_alphabet_symbols()};
+	const std::vector<Symbol> symbols{alphabet_symbols.begin(), alphabet_symbols.end()};
+	num_of_threads = get_num_of_threads(num_of_threads, std::numeric_limits<size_t>::max());
 
-	// 'paths[s] == t' denotes that state 's' was accessed from state 't',
-	// 'paths[s] == s' means that 's' is an initial state
-	std::map<StateSet, std::pair<StateSet, Symbol>> paths = {{StateSet(aut.initial), {StateSet(aut.initial), 0}}};
+	Antichain antichain{};
+	Worklist worklist{strategy};
+	StateSet initial{aut.initial};
+	const uint64_t initial_signature{get_signature(initial)};
+	const size_t initial_size{initial.size()};
+	worklist.push(antichain.insert(std::move(initial), initial_signature, Antichain::NO_PREDECESSOR, 0), initial_size);
 
+	// Each round takes a macrostate from the worklist and computes its posts over all symbols in parallel. The antichain
+	//  is only read while computing the posts; the posts that are not subsumed are merged into the antichain
+	//  sequentially afterwards, in the order of the symbols. Hence, the macrostates are explored in the same order on
+	//  any number of threads.
+	std::vector<std::optional<std::pair<StateSet, uint64_t>>> successors{};
 	while (!worklist.empty()) {
-		// get a next state
-		StateSet state;
-		if (is_dfs) {
-			state = *worklist.rbegin();
-			worklist.pop_back();
-		} else { // BFS
-			state = *worklist.begin();
-			worklist.pop_front();
-		}
+		const size_t id{worklist.pop()};
+		// The macrostate might have been removed by a smaller macrostate after being pushed to the worklist.
+		if (!antichain.contains(id)) { continue; }
+		++profile.statistics.macrostates_explored;
+		utils::Budget::poll(antichain.size());
 
-		// process it
-		for (Symbol symb : alph_symbols) {
-			StateSet succ = aut.post(state, symb);
-			if (!aut.final.intersects_with(succ)) {
-				if (nullptr != cex) {
-					cex->word.clear();
-					cex->word.push_back(symb);
-					StateSet trav = state;
-					while (paths[trav].first != trav) { // go back until initial state
-						cex->word.push_back(paths[trav].second);
-						trav = paths[trav].first;
-					}
-
-					std::ranges::reverse(cex->word);
+		successors.assign(symbols.size(), std::nullopt);
+		// Index of the first symbol with a post without a final state. Picking the first one keeps the counterexample
+		//  independent of the number of threads.
+		std::atomic<size_t> first_rejecting{symbols.size()};
+		parallel_for(
+			symbols.size(), get_num_of_threads(num_of_threads, symbols.size() / MIN_POSTS_PER_THREAD),
+			[&](size_t, const size_t index) {
+				if (index > first_rejecting) { return; }
+				StateSet successor{compute_post(aut, antichain[id], symbols[index])};
+				if (!aut.final.intersects_with(successor)) {
+					size_t current{first_rejecting};
+					while (index < current && !first_rejecting.compare_exchange_weak(current, index)) {}
+					return;
 				}
-
-				return false;
-			}
-
-			bool is_subsumed = false;
-			for (const auto& anti_state : processed) {
-				// trying to find a smaller state in processed
-				if (subsumes(anti_state, succ)) {
-					is_subsumed = true;
-					break;
+				const uint64_t signature{get_signature(successor)};
+				if (!antichain.subsumes(successor, signature)) {
+					successors[index].emplace(std::move(successor), signature);
 				}
 			}
+		);
 
-			if (is_subsumed) { continue; }
-
-			// prune data structures and insert succ inside
-			for (std::list<StateSet>* ds : {&processed, &worklist}) {
-				auto it = ds->begin();
-				while (it != ds->end()) {
-					if (subsumes(succ, *it)) {
-						auto to_remove = it;
-						++it;
-						ds->erase(to_remove);
-					} else {
-						++it;
-					}
-				}
-
-				// TODO: set pushing strategy
-				ds->push_back(succ);
+		if (first_rejecting < symbols.size()) {
+			if (nullptr != cex) {
+				cex->word = antichain.get_word(id);
+				cex->word.push_back(symbols[first_rejecting]);
 			}
+			return false;
+		}
 
-			// also set that succ was accessed from state
-			paths[succ] = {state, symb};
+		for (size_t index{0}; index < symbols.size(); ++index) {
+			// The successor might be subsumed by a successor merged earlier in this round.
+			if (!successors[index].has_value() ||
+				antichain.subsumes(successors[index]->first, successors[index]->second)) {
+				++profile.statistics.antichain_prunes;
+				continue;
+			}
+			auto& [successor, signature]{*successors[index]};
+			++profile.statistics.states_created;
+			profile.statistics.antichain_prunes += antichain.remove_supersets(successor, signature);
+			const size_t size{successor.size()};
+			worklist.push(antichain.insert(std::move(successor), signature, id, symbols[index]), size);
 		}
 	}
 
 	return true;
 } // }}}
 
+namespace {
+algorithms::SearchStrategy get_search_strategy(const ParameterMap& params) {
+	if (!haskey(params, "strategy")) { return algorithms::SearchStrategy::Dfs; }
+	if (const std::string& str_strategy = params.at("strategy"); "dfs" == str_strategy) {
+		return algorithms::SearchStrategy::Dfs;
+	} else if ("bfs" == str_strategy) {
+		return algorithms::SearchStrategy::Bfs;
+	} else if ("smallest-first" == str_strategy) {
+		return algorithms::SearchStrategy::SmallestFirst;
+	} else {
+		throw std::runtime_error(
+			"Nfa::is_universal received an unknown value of the \"strategy\" key: " + str_strategy
+		);
+	}
+}
+} // namespace
+
 // The dispatching method that calls the correct one based on parameters.
 bool mata::nfa::Nfa::is_universal(const Alphabet& alphabet, Run* cex, const ParameterMap& params) const {
-	// setting the default algorithm
-	decltype(algorithms::is_universal_naive)* algo = algorithms::is_universal_naive;
 	if (!haskey(params, "algorithm")) {
 		throw std::runtime_error(
 			std::to_string(__func__) +
@@ -128,15 +283,16 @@ bool mata::nfa::Nfa::is_universal(const Alphabet& alphabet, Run* cex, const Para
 		);
 	}
 
-	if (const std::string& str_algo = params.at("algorithm"); "naive" == str_algo) { /* default */
+	if (const std::string& str_algo = params.at("algorithm"); "naive" == str_algo) {
+		return algorithms::is_universal_naive(*this, alphabet, cex);
 	} else if ("antichains" == str_algo) {
-		algo = algorithms::is_universal_antichains;
+		const size_t num_of_threads{haskey(params, "threads") ? std::stoul(params.at("threads")) : 1};
+		return algorithms::is_universal_antichains(*this, alphabet, cex, get_search_strategy(params), num_of_threads);
 	} else {
 		throw std::runtime_error(
 			std::to_string(__func__) + " received an unknown value of the \"algorithm\" key: " + str_algo
 		);
 	}
-	return algo(*this, alphabet, cex);
 } // is_universal()
 
 bool mata::nfa::Nfa::is_universal(const Alphabet& alphabet, const ParameterMap& params) const {
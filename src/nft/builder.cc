@@ -4,7 +4,9 @@
 #include "mata/utils/sparse-set.hh"
 #include "mata/utils/utils.hh"
 
+#include <cmath>
 #include <fstream>
+#include <random>
 
 using namespace mata::nft;
 using mata::Symbol;
@@ -346,3 +348,65 @@ Nft builder::from_nfa_with_levels_advancing(mata::nfa::Nfa nfa, const size_t num
 
 	return result;
 }
+
+Nft builder::create_random_nft_tabakov_vardi(
+	const size_t num_of_states,
+	const size_t num_of_levels,
+	const size_t alphabet_size,
+	const double states_transitions_ratio_per_symbol,
+	const double final_state_density,
+	const std::optional<unsigned int>& seed
+) {
+	if (num_of_states == 0) { return Nft::with_levels(num_of_levels); }
+	if (num_of_levels == 0 || num_of_states < num_of_levels) {
+		throw std::runtime_error("Number of states must be at least the number of levels, which must be at least 1");
+	}
+	if (states_transitions_ratio_per_symbol < 0 ||
+		static_cast<size_t>(states_transitions_ratio_per_symbol) > num_of_states / num_of_levels) {
+		throw std::runtime_error("Transition density must be in range [0, num_of_states / num_of_levels]");
+	}
+	if (final_state_density < 0 || final_state_density > 1) {
+		throw std::runtime_error("Final state density must be in range [0, 1]");
+	}
+
+	std::vector<Level> levels(num_of_states);
+	for (State state{0}; state < num_of_states; ++state) { levels[state] = static_cast<Level>(state % num_of_levels); }
+	Nft nft{Nft::with_levels(Levels{num_of_levels, std::move(levels)}, num_of_states, {0}, {0})};
+	std::mt19937 gen(seed.value_or(std::random_device{}()));
+
+	// Number of states on the level; the i-th state on the level is level + i * num_of_levels.
+	auto num_of_states_on = [&](const size_t level) {
+		return (num_of_states - level + num_of_levels - 1) / num_of_levels;
+	};
+
+	const size_t num_of_final_states{
+		static_cast<size_t>(std::round(static_cast<double>(num_of_states_on(0)) * final_state_density))
+	};
+	for (const size_t index : utils::sample_without_replacement(num_of_final_states, num_of_states_on(0), gen)) {
+		nft.final.insert(index * num_of_levels);
+	}
+
+	std::vector<State> sources{};
+	std::vector<Symbol> symbols{};
+	std::vector<State> targets{};
+	for (size_t level{0}; level < num_of_levels; ++level) {
+		const size_t next_level{(level + 1) % num_of_levels};
+		const size_t num_of_sources{num_of_states_on(level)};
+		const size_t num_of_targets{num_of_states_on(next_level)};
+		const size_t num_of_transitions_per_symbol{std::min(
+			static_cast<size_t>(std::round(static_cast<double>(num_of_sources) * states_transitions_ratio_per_symbol)),
+			num_of_sources * num_of_targets
+		)};
+		for (Symbol symbol{0}; symbol < alphabet_size; ++symbol) {
+			for (const size_t transition : utils::sample_without_replacement(
+					 num_of_transitions_per_symbol, num_of_sources * num_of_targets, gen
+				 )) {
+				sources.push_back(level + transition / num_of_targets * num_of_levels);
+				symbols.push_back(symbol);
+				targets.push_back(next_level + transition % num_of_targets * num_of_levels);
+			}
+		}
+	}
+	nft.delta.add(sources, symbols, targets);
+	return nft;
+}
@@ -2,11 +2,18 @@
  * @brief Complement of NFTs.
  */
 
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <optional>
+
 #include "mata/nft/algorithms.hh"
+#include "mata/nft/complement.hh"
 #include "mata/nft/nft.hh"
 
 using namespace mata::nft;
 using namespace mata::utils;
+using mata::Symbol;
 
 Nft algorithms::complement_classical(
 	const Nft& aut, const OrdVector<Symbol>& symbols, const bool minimize_during_determinization
@@ -90,3 +97,222 @@ Nft mata::nft::complement(const Nft& nft, const OrdVector<Symbol>& symbols, cons
 	}
 	return algo(nft, symbols, minimize_during_determinization);
 }
+
+namespace {
+
+/// Level reached from a state at @p level after reading a single symbol.
+Level next_level(const Level level, const size_t num_of_levels) {
+	return static_cast<Level>((level + 1) % num_of_levels);
+}
+
+/// Transition over @c DONT_CARE from @p state_post, or @c nullptr if there is none.
+const SymbolPost* find_dont_care(const StatePost& state_post) {
+	const auto symbol_post_it{state_post.find(DONT_CARE)};
+	return symbol_post_it == state_post.end() ? nullptr : &*symbol_post_it;
+}
+
+/// The least symbol from @p symbols without an explicit transition (other than over @c DONT_CARE) in @p state_post.
+std::optional<Symbol> find_missing_symbol(const StatePost& state_post, const OrdVector<Symbol>& symbols) {
+	auto symbol_post_it{state_post.begin()};
+	for (const Symbol symbol : symbols) {
+		while (symbol_post_it != state_post.end() &&
+			   (symbol_post_it->symbol < symbol || symbol_post_it->symbol == DONT_CARE)) {
+			++symbol_post_it;
+		}
+		if (symbol_post_it == state_post.end() || symbol_post_it->symbol != symbol) { return symbol; }
+	}
+	return std::nullopt;
+}
+
+} // namespace
+
+bool ImplicitComplement::is_in_lang(const Run& run) const {
+	if (dft.initial.empty()) { return false; }
+	State state{*dft.initial.begin()};
+	for (auto symbol_it{run.word.begin()}; symbol_it != run.word.end(); ++symbol_it) {
+		if (!symbols.contains(*symbol_it)) { return false; }
+		const StatePost& state_post{dft.delta[state]};
+		auto symbol_post_it{state_post.find(*symbol_it)};
+		if (symbol_post_it == state_post.end()) { symbol_post_it = state_post.find(DONT_CARE); }
+		if (symbol_post_it == state_post.end()) { // Entering the sink.
+			return run.word.size() % dft.levels.num_of_levels == 0 &&
+				std::all_of(std::next(symbol_it), run.word.end(), [&](const Symbol symbol) {
+					return symbols.contains(symbol);
+				});
+		}
+		state = *symbol_post_it->targets.begin();
+	}
+	return dft.final.contains(state);
+}
+
+bool ImplicitComplement::is_lang_empty(Run* const cex) const {
+	// Breadth-first search for a final state or a state with a transition into the sink.
+	std::vector<std::optional<std::pair<State, Symbol>>> predecessors(dft.num_of_states());
+	std::vector<bool> visited(dft.num_of_states(), false);
+	std::deque<State> worklist{};
+	for (const State initial_state : dft.initial) {
+		visited[initial_state] = true;
+		worklist.push_back(initial_state);
+	}
+
+	const auto make_cex = [&](State state, const Word& suffix) {
+		if (cex == nullptr) { return; }
+		cex->word.assign(suffix.rbegin(), suffix.rend());
+		cex->path = {state};
+		while (predecessors[state].has_value()) {
+			cex->word.push_back(predecessors[state]->second);
+			state = predecessors[state]->first;
+			cex->path.push_back(state);
+		}
+		std::ranges::reverse(cex->word);
+		std::ranges::reverse(cex->path);
+	};
+
+	while (!worklist.empty()) {
+		const State state{worklist.front()};
+		worklist.pop_front();
+		if (dft.final.contains(state)) {
+			make_cex(state, {});
+			return false;
+		}
+		const StatePost& state_post{dft.delta[state]};
+		const std::optional<Symbol> missing_symbol{find_missing_symbol(state_post, symbols)};
+		if (find_dont_care(state_post) == nullptr && missing_symbol.has_value()) {
+			// The missing symbol leads to the sink, which accepts after reading the remaining levels.
+			Word suffix{*missing_symbol};
+			for (Level level{next_level(dft.levels[state], dft.levels.num_of_levels)}; level != 0;
+				 level = next_level(level, dft.levels.num_of_levels)) {
+				suffix.push_back(*symbols.begin());
+			}
+			make_cex(state, suffix);
+			return false;
+		}
+		for (const SymbolPost& symbol_post : state_post) {
+			const State target{*symbol_post.targets.begin()};
+			if (!visited[target]) {
+				visited[target] = true;
+				// A transition over DONT_CARE is read by the symbols without other transitions.
+				predecessors[target] = std::make_pair(
+					state, symbol_post.symbol == DONT_CARE ? missing_symbol.value() : symbol_post.symbol
+				);
+				worklist.push_back(target);
+			}
+		}
+	}
+	return true;
+}
+
+Nft ImplicitComplement::to_nft() const {
+	const size_t num_of_levels{dft.levels.num_of_levels};
+	const size_t num_of_states{dft.num_of_states()};
+	Nft result{Nft::with_levels(Levels{num_of_levels})};
+	for (State state{0}; state < num_of_states; ++state) { result.add_state_with_level(dft.levels[state]); }
+	result.initial = dft.initial;
+	result.final = dft.final;
+	std::vector<State> sinks{};
+
+	for (State state{0}; state < num_of_states; ++state) {
+		const StatePost& state_post{dft.delta[state]};
+		const SymbolPost* const dont_care{find_dont_care(state_post)};
+		OrdVector<Symbol> explicit_symbols{};
+		for (const SymbolPost& symbol_post : state_post) {
+			if (&symbol_post == dont_care) { continue; }
+			explicit_symbols.push_back(symbol_post.symbol);
+			result.delta.add(state, symbol_post.symbol, *symbol_post.targets.begin());
+		}
+		const OrdVector<Symbol> missing_symbols{symbols.difference(explicit_symbols)};
+		if (missing_symbols.empty()) { continue; }
+		if (dont_care == nullptr && sinks.empty()) {
+			for (Level level{0}; level < num_of_levels; ++level) {
+				sinks.push_back(result.add_state_with_level(level));
+			}
+			result.final.insert(sinks[0]);
+		}
+		const State target{
+			dont_care != nullptr ? *dont_care->targets.begin()
+								 : sinks[next_level(dft.levels[state], num_of_levels)]
+		};
+		for (const Symbol symbol : missing_symbols) { result.delta.add(state, symbol, target); }
+	}
+
+	for (Level level{0}; level < sinks.size(); ++level) {
+		for (const Symbol symbol : symbols) {
+			result.delta.add(sinks[level], symbol, sinks[next_level(level, num_of_levels)]);
+		}
+	}
+	return result;
+}
+
+ImplicitComplement
+	mata::nft::complement_implicit(const Nft& nft, const OrdVector<Symbol>& symbols, const JumpMode jump_mode) {
+	using Position = algorithms::JumpSteps::Position;
+	using Label = algorithms::JumpSteps::Label;
+	using Macrostate = std::vector<Position>;
+
+	// Trimming makes the empty macrostate the only macrostate accepting no word, so the macrostates equivalent to the
+	//  sink are never constructed.
+	Nft trimmed{nft};
+	trimmed.trim();
+	const algorithms::JumpSteps steps{trimmed, symbols, jump_mode};
+	const size_t num_of_levels{trimmed.levels.num_of_levels};
+
+	ImplicitComplement result{Nft::with_levels(Levels{num_of_levels}), symbols};
+	Nft& dft{result.dft};
+	std::map<Macrostate, State> subset_map{};
+	std::vector<std::pair<State, Macrostate>> worklist{};
+	const auto get_state = [&](Macrostate&& macrostate, const Level level) {
+		std::ranges::sort(macrostate);
+		macrostate.erase(std::unique(macrostate.begin(), macrostate.end()), macrostate.end());
+		if (const auto subset_it{subset_map.find(macrostate)}; subset_it != subset_map.end()) {
+			return subset_it->second;
+		}
+		const State state{dft.add_state_with_level(level)};
+		if (level == 0 && std::ranges::none_of(macrostate, [&](const Position& position) {
+				return steps.is_final(position);
+			})) {
+			dft.final.insert(state);
+		}
+		subset_map.emplace(macrostate, state);
+		worklist.emplace_back(state, std::move(macrostate));
+		return state;
+	};
+	Macrostate initial{};
+	for (const State state : trimmed.initial) { initial.push_back(Position{state, 0, 0}); }
+	dft.initial.insert(get_state(std::move(initial), 0));
+
+	std::vector<std::pair<Label, Position>> successors{};
+	while (!worklist.empty()) {
+		const auto [state, macrostate]{std::move(worklist.back())};
+		worklist.pop_back();
+		const Level target_level{next_level(dft.levels[state], num_of_levels)};
+		successors.clear();
+		for (const Position& position : macrostate) { steps.append_steps(position, successors); }
+		// Steps over DONT_CARE (std::nullopt) are sorted first, followed by the steps over symbols.
+		std::ranges::sort(successors);
+		const auto symbols_begin{std::ranges::find_if(successors, [](const auto& step) {
+			return step.first.has_value();
+		})};
+		Macrostate dont_care_targets{};
+		for (auto step_it{successors.begin()}; step_it != symbols_begin; ++step_it) {
+			dont_care_targets.push_back(step_it->second);
+		}
+
+		size_t num_of_explicit_symbols{0};
+		for (auto step_it{symbols_begin}; step_it != successors.end();) {
+			const Symbol symbol{*step_it->first};
+			Macrostate targets{dont_care_targets};
+			for (; step_it != successors.end() && *step_it->first == symbol; ++step_it) {
+				targets.push_back(step_it->second);
+			}
+			if (!symbols.contains(symbol)) { continue; }
+			++num_of_explicit_symbols;
+			const State target{get_state(std::move(targets), target_level)};
+			dft.delta.mutable_state_post(state).insert(SymbolPost{symbol, target});
+		}
+		if (!dont_care_targets.empty() && num_of_explicit_symbols < symbols.size()) {
+			const State target{get_state(std::move(dont_care_targets), target_level)};
+			dft.delta.mutable_state_post(state).insert(SymbolPost{DONT_CARE, target});
+		}
+	}
+	return result;
+}
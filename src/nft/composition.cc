@@ -9,6 +9,8 @@
 #include "mata/nft/algorithms.hh"
 #include "mata/nft/nft.hh"
 #include "mata/utils/assert.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/two-dimensional-map.hh"
 
 using namespace mata::utils;
@@ -246,6 +248,7 @@ Nft algorithms::compose_fast_no_jump(
 	const bool project_out_sync_levels
 ) {
 	assert(lhs_sync_level < lhs.levels.num_of_levels && rhs_sync_level < rhs.levels.num_of_levels);
+	OperationProfile profile{"nft::compose_fast_no_jump"};
 
 	// Check that there are only explicit synchronization transitions of length 1 with exception for fast EPSILON
 	// transitions.
@@ -385,6 +388,7 @@ Nft algorithms::compose_fast_no_jump(
 		const State new_state = (composition_state_to_add != Limits::max_state) ? composition_state_to_add
 																				: result.add_state_with_level(level);
 		composition_storage.insert(key.first, key.second, new_state);
+		++profile.statistics.product_pairs;
 		if (level == 0) {
 			// If the level is zero, check for final states and add the state to the worklist.
 			if ((is_first_lhs && lhs.final.contains(first) && rhs.final.contains(second)) ||
@@ -929,6 +933,8 @@ Nft algorithms::compose_fast_no_jump(
 	while (!worklist.empty()) {
 		const auto [lhs_state, rhs_state] = worklist.front();
 		worklist.pop();
+		++profile.statistics.macrostates_explored;
+		Budget::poll(result.num_of_states());
 		const State composition_state = composition_storage.get(lhs_state, rhs_state);
 		assert(composition_state != Limits::max_state);
 		const Level lhs_level = lhs.levels[lhs_state];
@@ -1024,6 +1030,7 @@ Nft algorithms::compose_fast_no_jump(
 	// TODO: Make trim on demand.
 	if (project_out_sync_levels) { result.trim(); }
 
+	profile.statistics.states_created = result.num_of_states();
 	return result;
 }
 
@@ -1037,6 +1044,7 @@ Nft algorithms::compose_general(
 ) {
 	assert(!lhs_sync_levels.empty());
 	assert(lhs_sync_levels.size() == rhs_sync_levels.size());
+	OperationProfile profile{"nft::compose_general"};
 
 	// Inserts loop into the given Nft for each state with level 0.
 	// The loop word is constructed using the EPSILON symbol for all levels, except for the levels
@@ -1136,6 +1144,7 @@ Nft algorithms::compose_general(
 
 	Nft result{intersection(lhs_synced, rhs_synced, nullptr, jump_mode, lhs_first_aux_state, rhs_first_aux_state)};
 	if (project_out_sync_levels) { result = project_out(result, sync_levels_to_project_out, jump_mode); }
+	profile.statistics.states_created = result.num_of_states();
 	return result;
 }
 
@@ -1,6 +1,11 @@
 /* nft-incl.cc -- NFT language inclusion
  */
 
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <optional>
+
 // MATA headers
 #include "mata/nfa/algorithms.hh"
 #include "mata/nft/algorithms.hh"
@@ -8,6 +13,7 @@
 
 using namespace mata::nft;
 using namespace mata::utils;
+using mata::Symbol;
 
 /// naive language inclusion check (complementation + intersection + emptiness)
 bool algorithms::is_included_naive(
@@ -28,28 +34,196 @@ bool algorithms::is_included_naive(
 	return nft_isect.is_lang_empty(cex);
 } // is_included_naive }}}
 
+algorithms::JumpSteps::JumpSteps(const Nft& nft, const OrdVector<Symbol>& symbols, const JumpMode jump_mode)
+	: nft_{nft},
+	  jump_mode_{jump_mode},
+	  has_levels_{nft.levels.size() == nft.num_of_states()},
+	  dont_care_is_literal_{!has_levels_ || symbols == OrdVector<Symbol>{DONT_CARE}} {}
+
+void algorithms::JumpSteps::append_steps(
+	const Position& position, std::vector<std::pair<Label, Position>>& steps
+) const {
+	if (position.remaining > 0) {
+		steps.emplace_back(label(position.symbol), Position{position.state, position.remaining - 1, position.symbol});
+		return;
+	}
+	for (const SymbolPost& symbol_post : nft_.delta[position.state]) {
+		const Symbol next_symbol{jump_mode_ == JumpMode::AppendDontCares ? DONT_CARE : symbol_post.symbol};
+		for (const State target : symbol_post.targets) {
+			const Level length{jump_length(position.state, target)};
+			steps.emplace_back(
+				label(symbol_post.symbol), Position{target, length - 1, length > 1 ? next_symbol : Symbol{0}}
+			);
+		}
+	}
+}
+
+bool algorithms::JumpSteps::is_final(const Position& position) const {
+	return position.remaining == 0 && nft_.final[position.state];
+}
+
+algorithms::JumpSteps::Label algorithms::JumpSteps::label(const Symbol symbol) const {
+	if (symbol == DONT_CARE && !dont_care_is_literal_) { return std::nullopt; }
+	return symbol;
+}
+
+Level algorithms::JumpSteps::jump_length(const State source, const State target) const {
+	if (!has_levels_) { return 1; }
+	const Level source_level{nft_.levels[source]};
+	const Level target_level{nft_.levels[target]};
+	if (target_level == 0) { return static_cast<Level>(nft_.levels.num_of_levels) - source_level; }
+	return target_level > source_level ? target_level - source_level : 1;
+}
+
+namespace {
+
+using Position = algorithms::JumpSteps::Position;
+using Label = algorithms::JumpSteps::Label;
+using algorithms::JumpSteps;
+
+OrdVector<Symbol> get_symbols(const Nft& lhs, const Nft& rhs, const mata::Alphabet* const alphabet) {
+	if (alphabet != nullptr) { return alphabet->get_alphabet_symbols(); }
+	OrdVector<Symbol> symbols{create_alphabet(lhs, rhs).get_alphabet_symbols()};
+	if (symbols.contains(DONT_CARE) && symbols.size() > 1) { symbols.erase(DONT_CARE); }
+	return symbols;
+}
+
+/**
+ * @brief Check inclusion by the antichain algorithm over the positions of the transducers.
+ *
+ * Steps over @c DONT_CARE are handled symbolically: a @c DONT_CARE step of @p smaller is explored once for each
+ *  symbol on the steps of @p bigger, and once for a representative of all other symbols of @p symbols.
+ */
+bool is_included_over_positions(
+	const Nft& smaller, const Nft& bigger, const OrdVector<Symbol>& symbols, Run* cex, const JumpMode jump_mode
+) {
+	using Macrostate = std::vector<Position>;
+	struct Node {
+		Position smaller;
+		Macrostate bigger;
+		/// Index of the predecessor node and the symbol read from it.
+		std::optional<std::pair<size_t, Symbol>> predecessor;
+	};
+
+	const JumpSteps smaller_steps{smaller, symbols, jump_mode};
+	const JumpSteps bigger_steps{bigger, symbols, jump_mode};
+	std::vector<Node> nodes{};
+	std::deque<size_t> worklist{};
+	// Minimal macrostates processed with each position of smaller.
+	std::map<Position, std::vector<Macrostate>> antichain{};
+
+	const auto add_node = [&](const Position& position, Macrostate&& macrostate, const auto& predecessor) {
+		std::ranges::sort(macrostate);
+		macrostate.erase(std::unique(macrostate.begin(), macrostate.end()), macrostate.end());
+		std::vector<Macrostate>& processed{antichain[position]};
+		if (std::ranges::any_of(processed, [&](const Macrostate& smaller_macrostate) {
+				return std::ranges::includes(macrostate, smaller_macrostate);
+			})) {
+			return;
+		}
+		std::erase_if(processed, [&](const Macrostate& bigger_macrostate) {
+			return std::ranges::includes(bigger_macrostate, macrostate);
+		});
+		processed.push_back(macrostate);
+		nodes.push_back(Node{position, std::move(macrostate), predecessor});
+		worklist.push_back(nodes.size() - 1);
+	};
+
+	Macrostate bigger_initial{};
+	for (const State state : bigger.initial) { bigger_initial.push_back(Position{state, 0, 0}); }
+	for (const State state : smaller.initial) {
+		add_node(Position{state, 0, 0}, Macrostate{bigger_initial}, std::nullopt);
+	}
+
+	std::vector<std::pair<Label, Position>> smaller_successors{};
+	std::vector<std::pair<Label, Position>> bigger_successors{};
+	while (!worklist.empty()) {
+		const size_t node_index{worklist.front()};
+		worklist.pop_front();
+		const Position position{nodes[node_index].smaller};
+		if (smaller_steps.is_final(position) &&
+			std::ranges::none_of(nodes[node_index].bigger, [&](const Position& bigger_position) {
+				return bigger_steps.is_final(bigger_position);
+			})) {
+			if (cex != nullptr) {
+				cex->word.clear();
+				cex->path.clear();
+				for (size_t index{node_index};; index = nodes[index].predecessor->first) {
+					if (nodes[index].smaller.remaining == 0) { cex->path.push_back(nodes[index].smaller.state); }
+					if (!nodes[index].predecessor.has_value()) { break; }
+					cex->word.push_back(nodes[index].predecessor->second);
+				}
+				std::ranges::reverse(cex->word);
+				std::ranges::reverse(cex->path);
+			}
+			return false;
+		}
+
+		smaller_successors.clear();
+		smaller_steps.append_steps(position, smaller_successors);
+		if (smaller_successors.empty()) { continue; }
+		bigger_successors.clear();
+		for (const Position& bigger_position : nodes[node_index].bigger) {
+			bigger_steps.append_steps(bigger_position, bigger_successors);
+		}
+		// Steps over DONT_CARE (std::nullopt) are sorted first, followed by the steps over symbols.
+		std::ranges::sort(bigger_successors);
+		const auto symbols_begin{std::ranges::find_if(bigger_successors, [](const auto& step) {
+			return step.first.has_value();
+		})};
+		Macrostate dont_care_targets{};
+		for (auto step_it{bigger_successors.begin()}; step_it != symbols_begin; ++step_it) {
+			dont_care_targets.push_back(step_it->second);
+		}
+		const auto targets_over = [&](const Symbol symbol) {
+			Macrostate targets{symbols.contains(symbol) ? dont_care_targets : Macrostate{}};
+			const auto [first, last]{std::equal_range(
+				symbols_begin, bigger_successors.end(), std::make_pair(Label{symbol}, Position{0, 0, 0}),
+				[](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }
+			)};
+			for (auto step_it{first}; step_it != last; ++step_it) { targets.push_back(step_it->second); }
+			return targets;
+		};
+
+		for (const auto& [label, smaller_target] : smaller_successors) {
+			if (label.has_value()) {
+				add_node(smaller_target, targets_over(*label), std::make_pair(node_index, *label));
+				continue;
+			}
+			// Symbols distinguished by bigger, and the first symbol not distinguished by bigger as a representative of
+			//  the others.
+			std::optional<Symbol> representative{};
+			auto symbol_it{symbols.begin()};
+			for (auto step_it{symbols_begin}; step_it != bigger_successors.end();) {
+				const Symbol symbol{*step_it->first};
+				while (step_it != bigger_successors.end() && *step_it->first == symbol) { ++step_it; }
+				if (!symbols.contains(symbol)) { continue; }
+				add_node(smaller_target, targets_over(symbol), std::make_pair(node_index, symbol));
+				while (!representative.has_value() && symbol_it != symbols.end() && *symbol_it <= symbol) {
+					if (*symbol_it < symbol) { representative = *symbol_it; }
+					++symbol_it;
+				}
+			}
+			if (!representative.has_value() && symbol_it != symbols.end()) { representative = *symbol_it; }
+			if (representative.has_value()) {
+				add_node(
+					smaller_target, Macrostate{dont_care_targets}, std::make_pair(node_index, *representative)
+				);
+			}
+		}
+	}
+	return true;
+}
+
+} // namespace
+
 /// language inclusion check using Antichains
 // TODO, what about to construct the separator from this?
 bool mata::nft::algorithms::is_included_antichains(
-	const Nft& smaller,
-	const Nft& bigger,
-	const Alphabet* const alphabet, // TODO: this parameter is not used
-	Run* cex,
-	const JumpMode jump_mode
+	const Nft& smaller, const Nft& bigger, const Alphabet* const alphabet, Run* cex, const JumpMode jump_mode
 ) { // {{{
 	if (smaller.levels.num_of_levels != bigger.levels.num_of_levels) { return false; }
-
-	OrdVector<mata::Symbol> symbols;
-	if (alphabet == nullptr) {
-		symbols = create_alphabet(smaller, bigger).get_alphabet_symbols();
-		if (symbols.contains(DONT_CARE) && symbols.size() > 1) { symbols.erase(DONT_CARE); }
-	} else {
-		symbols = alphabet->get_alphabet_symbols();
-	}
-
-	return nfa::algorithms::is_included_antichains(
-		smaller.unwind_jumps(symbols, jump_mode), bigger.unwind_jumps(symbols, jump_mode), alphabet, cex
-	);
+	return is_included_over_positions(smaller, bigger, get_symbols(smaller, bigger, alphabet), cex, jump_mode);
 } // }}}
 
 namespace {
@@ -99,14 +273,11 @@ bool mata::nft::are_equivalent(
 ) {
 	if (lhs.levels.num_of_levels != rhs.levels.num_of_levels) { return false; }
 
-	OrdVector<mata::Symbol> symbols;
-	if (alphabet == nullptr) {
-		symbols = create_alphabet(lhs, rhs).get_alphabet_symbols();
-		if (symbols.contains(DONT_CARE) && symbols.size() > 1) { symbols.erase(DONT_CARE); }
-	} else {
-		symbols = alphabet->get_alphabet_symbols();
+	const OrdVector<mata::Symbol> symbols{get_symbols(lhs, rhs, alphabet)};
+	if (set_algorithm(std::to_string(__func__), params) == algorithms::is_included_antichains) {
+		return is_included_over_positions(lhs, rhs, symbols, nullptr, jump_mode) &&
+			is_included_over_positions(rhs, lhs, symbols, nullptr, jump_mode);
 	}
-
 	return nfa::are_equivalent(
 		lhs.unwind_jumps(symbols, jump_mode), rhs.unwind_jumps(symbols, jump_mode), alphabet, params
 	);
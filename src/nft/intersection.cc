@@ -4,6 +4,8 @@
 
 #include "mata/nft/algorithms.hh"
 #include "mata/nft/nft.hh"
+#include "mata/utils/budget.hh"
+#include "mata/utils/profiling.hh"
 #include "mata/utils/two-dimensional-map.hh"
 
 #include <fstream>
@@ -46,6 +48,7 @@ Nft mata::nft::algorithms::product(
 ) {
 	assert(lhs.levels.num_of_levels == rhs.levels.num_of_levels);
 
+	utils::OperationProfile profile{"nft::product"};
 	Nft product{}; // The product automaton.
 	product.levels.num_of_levels = lhs.levels.num_of_levels;
 	utils::TwoDimensionalMap<State> product_storage{lhs.num_of_states(), rhs.num_of_states()};
@@ -72,6 +75,7 @@ Nft mata::nft::algorithms::product(
 			assert(product_target < Limits::max_state);
 
 			product_storage.insert(lhs_target, rhs_target, product_target);
+			++profile.statistics.product_pairs;
 			if (product_map != nullptr) { (*product_map)[{lhs_target, rhs_target}] = product_target; }
 			worklist.push_back(product_target);
 
@@ -164,6 +168,7 @@ Nft mata::nft::algorithms::product(
 			// Update product with initial state pairs.
 			const State product_initial_state = product.add_state();
 			product_storage.insert(lhs_initial_state, rhs_initial_state, product_initial_state);
+			++profile.statistics.product_pairs;
 			if (product_map != nullptr) {
 				(*product_map)[{lhs_initial_state, rhs_initial_state}] = product_initial_state;
 			}
@@ -177,6 +182,8 @@ Nft mata::nft::algorithms::product(
 		State product_source = worklist.back();
 		;
 		worklist.pop_back();
+		++profile.statistics.macrostates_explored;
+		utils::Budget::poll(product.num_of_states());
 		const State lhs_source = product_storage.get_first_inverted(product_source);
 		const State rhs_source = product_storage.get_second_inverted(product_source);
 		const Level lhs_source_level = lhs.levels[lhs_source];
@@ -266,6 +273,7 @@ Nft mata::nft::algorithms::product(
 			}
 		}
 	}
+	profile.statistics.states_created = product.num_of_states();
 	return product;
 } // intersection().
 } // namespace mata::nft.
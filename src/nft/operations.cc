@@ -514,7 +514,9 @@ Nft mata::nft::project_out(const Nft& nft, const utils::OrdVector<Level>& levels
 	while (changed) { // Compute the fixpoint.
 		changed = false;
 		for (const State s : states_to_project) {
-			for (const State cls_state : closure[s]) {
+			// Iterate over a copy, as the unions below replace the vector of the closure.
+			const StateSet cls_states{closure[s]};
+			for (const State cls_state : cls_states) {
 				if (!closure[cls_state].is_subset_of(closure[s])) {
 					closure[s].insert(closure[cls_state]);
 					changed = true;
@@ -1394,6 +1396,20 @@ bool nft::symbols_match(const Symbol a, const Symbol b) {
 										  : (a == b || a == DONT_CARE || b == DONT_CARE);
 }
 
+mata::nft::WordEnumerator::WordEnumerator(
+	const Nft& nft, const size_t max_length, const size_t max_num_of_words, const JumpMode jump_mode
+)
+	: unwound_nft_{nft.unwind_jumps({DONT_CARE}, jump_mode)},
+	  enumerator_{unwound_nft_, max_length, max_num_of_words} {
+	if (jump_mode == JumpMode::NoJump && nft.levels.size() == nft.num_of_states()) {
+		for (const Transition& transition : nft.delta.transitions()) {
+			if (nft.levels.next_level_after(nft.levels[transition.source]) != nft.levels[transition.target]) {
+				throw std::runtime_error("nft::WordEnumerator: Unsupported jump mode.");
+			}
+		}
+	}
+}
+
 std::set<Word> Nft::get_words(const size_t max_length, const JumpMode jump_mode) const {
 	std::set<Word> result;
 
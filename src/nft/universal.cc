@@ -122,6 +122,16 @@ bool mata::nft::algorithms::is_universal_antichains(const Nft& aut, const Alphab
 	return true;
 } // }}}
 
+bool mata::nft::algorithms::is_universal_levels(
+	const Nft& aut, const Alphabet& alphabet, Run* cex, const JumpMode jump_mode
+) {
+	Nft universal{Nft::with_levels(Levels{aut.levels.num_of_levels, {0}}, 1, {0}, {0})};
+	universal.delta.add(0, DONT_CARE, 0);
+	if (is_included_antichains(universal, aut, &alphabet, cex, jump_mode)) { return true; }
+	if (cex != nullptr) { cex->path.clear(); } // The path is in the universal transducer.
+	return false;
+}
+
 // The dispatching method that calls the correct one based on parameters.
 bool mata::nft::Nft::is_universal(const Alphabet& alphabet, Run* cex, const ParameterMap& params) const {
 	// TODO(nft): Revert back to the naive algorithm when implemented for NFTs?
@@ -141,6 +151,8 @@ bool mata::nft::Nft::is_universal(const Alphabet& alphabet, Run* cex, const Para
 		throw std::runtime_error(std::to_string(__func__) + " naive algorithm is not implemented for NFTs");
 	} else if ("antichains" == str_algo) {
 		algo = algorithms::is_universal_antichains;
+	} else if ("levels" == str_algo) {
+		return algorithms::is_universal_levels(*this, alphabet, cex);
 	} else {
 		throw std::runtime_error(
 			std::to_string(__func__) + " received an unknown value of the \"algorithm\" key: " + str_algo
@@ -0,0 +1,144 @@
+/* profiling.cc -- Operation-level profiling of the expensive operations
+ */
+
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+
+#include "mata/utils/profiling.hh"
+
+using namespace mata::utils;
+
+namespace {
+
+thread_local size_t depth{0}; ///< Number of the instrumented calls in progress on the current thread.
+thread_local size_t num_of_allocations{0}; ///< Number of heap allocations on the current thread, if counted.
+
+std::mutex records_mutex{};
+std::vector<OperationStatistics> records{};
+
+// Recursive, so that the callback may call instrumented operations itself.
+std::recursive_mutex callback_mutex{};
+Profiler::Callback callback{};
+
+void write_json_string(std::ostream& output, const std::string& string) {
+	output << '"';
+	for (const char character : string) {
+		if (character == '"' || character == '\\') { output << '\\'; }
+		output << character;
+	}
+	output << '"';
+}
+
+/// Write the counters of @p statistics as JSON members (without the surrounding braces).
+void write_json_counters(std::ostream& output, const OperationStatistics& statistics) {
+	output << "\"wall_time_ns\": " << statistics.wall_time.count() << ", \"states_created\": "
+		   << statistics.states_created << ", \"macrostates_explored\": " << statistics.macrostates_explored
+		   << ", \"antichain_prunes\": " << statistics.antichain_prunes
+		   << ", \"product_pairs\": " << statistics.product_pairs << ", \"allocations\": " << statistics.allocations;
+}
+
+} // namespace
+
+#ifdef MATA_PROFILE_ALLOCATIONS
+void* operator new(std::size_t size) {
+	++num_of_allocations;
+	if (void* const pointer{std::malloc(size == 0 ? 1 : size)}; pointer != nullptr) { return pointer; }
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+#endif
+
+void Profiler::set_callback(Callback new_callback) {
+	const std::lock_guard lock{callback_mutex};
+	callback = std::move(new_callback);
+}
+
+bool Profiler::counts_allocations() {
+#ifdef MATA_PROFILE_ALLOCATIONS
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::vector<OperationStatistics> Profiler::get_records() {
+	const std::lock_guard lock{records_mutex};
+	return records;
+}
+
+void Profiler::clear() {
+	const std::lock_guard lock{records_mutex};
+	records.clear();
+}
+
+void Profiler::record(OperationStatistics statistics) {
+	{
+		const std::lock_guard lock{callback_mutex};
+		if (callback) {
+			callback(statistics);
+			return;
+		}
+	}
+	const std::lock_guard lock{records_mutex};
+	records.push_back(std::move(statistics));
+}
+
+void Profiler::write_json(std::ostream& output) {
+	const std::vector<OperationStatistics> recorded{get_records()};
+	std::map<std::string, std::pair<size_t, OperationStatistics>> summary{};
+	output << "{\n  \"operations\": [";
+	for (size_t i{0}; i < recorded.size(); ++i) {
+		const OperationStatistics& statistics{recorded[i]};
+		output << (i == 0 ? "\n" : ",\n") << "    {\"operation\": ";
+		write_json_string(output, statistics.operation);
+		output << ", \"depth\": " << statistics.depth << ", ";
+		write_json_counters(output, statistics);
+		output << "}";
+
+		auto& [num_of_calls, total]{summary[statistics.operation]};
+		++num_of_calls;
+		total.wall_time += statistics.wall_time;
+		total.states_created += statistics.states_created;
+		total.macrostates_explored += statistics.macrostates_explored;
+		total.antichain_prunes += statistics.antichain_prunes;
+		total.product_pairs += statistics.product_pairs;
+		total.allocations += statistics.allocations;
+	}
+	output << (recorded.empty() ? "],\n" : "\n  ],\n") << "  \"summary\": {";
+	bool first{true};
+	for (const auto& [operation, calls_and_total] : summary) {
+		output << (first ? "\n" : ",\n") << "    ";
+		write_json_string(output, operation);
+		output << ": {\"calls\": " << calls_and_total.first << ", ";
+		write_json_counters(output, calls_and_total.second);
+		output << "}";
+		first = false;
+	}
+	output << (summary.empty() ? "}\n}\n" : "\n  }\n}\n");
+}
+
+OperationProfile::OperationProfile(const char* operation) : operation_{operation}, enabled_{Profiler::is_enabled()} {
+	if (!enabled_) { return; }
+	++depth;
+	allocations_at_start_ = num_of_allocations;
+	start_ = std::chrono::steady_clock::now();
+}
+
+OperationProfile::~OperationProfile() {
+	if (!enabled_) { return; }
+	statistics.wall_time = std::chrono::steady_clock::now() - start_;
+	statistics.allocations = num_of_allocations - allocations_at_start_;
+	--depth;
+	statistics.depth = depth;
+	statistics.operation = operation_;
+	try {
+		Profiler::record(std::move(statistics));
+	} catch (...) {
+		// Destructors may not throw; the statistics of the call are lost if they cannot be recorded.
+	}
+}
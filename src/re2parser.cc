@@ -459,6 +459,303 @@ class RegexParser {
 		return mapped_states;
 	}
 };
+
+/**
+ * Glushkov (position) automaton of a parsed regex.
+ *
+ * Every occurrence of a symbol class in the regex (a position) becomes a state, entered over the symbols of the class.
+ *  The automaton is built directly from the Regexp AST by computing for each subexpression whether it accepts the empty
+ *  word and its first and last positions, and for each position the positions which can follow it. For n positions,
+ *  the automaton has n + 1 states and no epsilon transitions.
+ *
+ * In UTF8 encoding, the positions are bytes: a code point is a sequence of positions and a class of code points is
+ *  an alternative of sequences of byte ranges.
+ */
+class GlushkovConstruction {
+  public:
+	explicit GlushkovConstruction(const Encoding encoding) : encoding_{encoding} {}
+
+	Nfa build(re2::Regexp* regex) {
+		Fragment fragment{this->fragment_of(regex)};
+		const size_t num_of_positions{this->position_symbols_.size()};
+		Nfa result{num_of_positions + 1};
+		result.initial.insert(0);
+		if (fragment.nullable) { result.final.insert(0); }
+		for (const size_t position : fragment.last) { result.final.insert(position + 1); }
+		this->add_transitions(result, 0, fragment.first);
+		for (size_t position{0}; position < num_of_positions; ++position) {
+			this->add_transitions(result, position + 1, this->follow_[position]);
+		}
+		return result;
+	}
+
+  private:
+	using ByteRanges = std::vector<std::pair<mata::Symbol, mata::Symbol>>;
+
+	/// Subexpression: whether it accepts the empty word, its first and last positions.
+	struct Fragment {
+		bool nullable{true};
+		std::vector<size_t> first{};
+		std::vector<size_t> last{};
+	};
+
+	Encoding encoding_;
+	/// Symbols (closed ranges) of each position.
+	std::vector<ByteRanges> position_symbols_{};
+	/// Positions which can follow each position.
+	std::vector<std::vector<size_t>> follow_{};
+
+	static Fragment empty_language() { return Fragment{false, {}, {}}; }
+
+	size_t new_position(ByteRanges symbols) {
+		this->position_symbols_.push_back(std::move(symbols));
+		this->follow_.emplace_back();
+		return this->position_symbols_.size() - 1;
+	}
+
+	/// A fragment accepting exactly one word over the given sequence of symbol ranges.
+	Fragment sequence(const std::vector<ByteRanges>& symbol_sequence) {
+		Fragment result{empty_language()};
+		size_t previous{0};
+		for (size_t index{0}; index < symbol_sequence.size(); ++index) {
+			const size_t position{this->new_position(symbol_sequence[index])};
+			if (index == 0) {
+				result.first.push_back(position);
+			} else {
+				this->follow_[previous].push_back(position);
+			}
+			previous = position;
+		}
+		result.last.push_back(previous);
+		return result;
+	}
+
+	static Fragment alternate(Fragment lhs, const Fragment& rhs) {
+		lhs.nullable = lhs.nullable || rhs.nullable;
+		lhs.first.insert(lhs.first.end(), rhs.first.begin(), rhs.first.end());
+		lhs.last.insert(lhs.last.end(), rhs.last.begin(), rhs.last.end());
+		return lhs;
+	}
+
+	Fragment concatenate(Fragment lhs, const Fragment& rhs) {
+		for (const size_t position : lhs.last) {
+			this->follow_[position].insert(this->follow_[position].end(), rhs.first.begin(), rhs.first.end());
+		}
+		if (lhs.nullable) { lhs.first.insert(lhs.first.end(), rhs.first.begin(), rhs.first.end()); }
+		if (rhs.nullable) {
+			lhs.last.insert(lhs.last.end(), rhs.last.begin(), rhs.last.end());
+		} else {
+			lhs.last = rhs.last;
+		}
+		lhs.nullable = lhs.nullable && rhs.nullable;
+		return lhs;
+	}
+
+	/// Make @p fragment iterable (the Kleene plus).
+	Fragment iterate(Fragment fragment) {
+		for (const size_t position : fragment.last) {
+			this->follow_[position].insert(
+				this->follow_[position].end(), fragment.first.begin(), fragment.first.end()
+			);
+		}
+		return fragment;
+	}
+
+	Fragment fragment_of(re2::Regexp* regex) {
+		switch (regex->op()) {
+			case re2::kRegexpNoMatch:
+				return empty_language();
+			case re2::kRegexpEmptyMatch:
+			case re2::kRegexpHaveMatch:
+			// Anchors and word boundaries are ignored, as by create_nfa().
+			case re2::kRegexpBeginLine:
+			case re2::kRegexpEndLine:
+			case re2::kRegexpBeginText:
+			case re2::kRegexpEndText:
+			case re2::kRegexpWordBoundary:
+			case re2::kRegexpNoWordBoundary:
+				return Fragment{};
+			case re2::kRegexpLiteral:
+				return this->literal(regex->rune(), regex->parse_flags());
+			case re2::kRegexpLiteralString: {
+				Fragment result{};
+				for (int index{0}; index < regex->nrunes(); ++index) {
+					result = this->concatenate(result, this->literal(regex->runes()[index], regex->parse_flags()));
+				}
+				return result;
+			}
+			case re2::kRegexpConcat: {
+				Fragment result{};
+				for (int index{0}; index < regex->nsub(); ++index) {
+					result = this->concatenate(result, this->fragment_of(regex->sub()[index]));
+				}
+				return result;
+			}
+			case re2::kRegexpAlternate: {
+				Fragment result{empty_language()};
+				for (int index{0}; index < regex->nsub(); ++index) {
+					result = alternate(result, this->fragment_of(regex->sub()[index]));
+				}
+				return result;
+			}
+			case re2::kRegexpStar: {
+				Fragment result{this->iterate(this->fragment_of(regex->sub()[0]))};
+				result.nullable = true;
+				return result;
+			}
+			case re2::kRegexpPlus:
+				return this->iterate(this->fragment_of(regex->sub()[0]));
+			case re2::kRegexpQuest: {
+				Fragment result{this->fragment_of(regex->sub()[0])};
+				result.nullable = true;
+				return result;
+			}
+			case re2::kRegexpRepeat:
+				return this->repeat(regex->sub()[0], regex->min(), regex->max());
+			case re2::kRegexpCapture:
+				return this->fragment_of(regex->sub()[0]);
+			case re2::kRegexpAnyChar:
+				return this->rune_ranges({ { 0, re2::Runemax } });
+			case re2::kRegexpAnyByte:
+				return this->sequence({ { { 0x00, 0xFF } } });
+			case re2::kRegexpCharClass: {
+				std::vector<std::pair<re2::Rune, re2::Rune>> ranges{};
+				for (const re2::RuneRange& range : *regex->cc()) { ranges.emplace_back(range.lo, range.hi); }
+				return this->rune_ranges(ranges);
+			}
+		}
+		throw std::runtime_error("Unsupported regular expression operator");
+	}
+
+	/// Repetition {min, max} of @p regex, where max is -1 for an unbounded repetition.
+	Fragment repeat(re2::Regexp* regex, const int min, const int max) {
+		Fragment result{};
+		for (int index{0}; index < min; ++index) { result = this->concatenate(result, this->fragment_of(regex)); }
+		if (max == -1) {
+			Fragment star{this->iterate(this->fragment_of(regex))};
+			star.nullable = true;
+			return this->concatenate(result, star);
+		}
+		for (int index{min}; index < max; ++index) {
+			Fragment optional{this->fragment_of(regex)};
+			optional.nullable = true;
+			result = this->concatenate(result, optional);
+		}
+		return result;
+	}
+
+	Fragment literal(const re2::Rune rune, const re2::Regexp::ParseFlags flags) {
+		// RE2 keeps case-folded literals only for ASCII letters; other literals are turned into classes.
+		if ((flags & re2::Regexp::FoldCase) != 0 && rune < 0x80 && std::isalpha(rune) != 0) {
+			const auto lower{static_cast<re2::Rune>(std::tolower(rune))};
+			const auto upper{static_cast<re2::Rune>(std::toupper(rune))};
+			return this->rune_ranges({ { upper, upper }, { lower, lower } });
+		}
+		return this->rune_ranges({ { rune, rune } });
+	}
+
+	/// A fragment accepting a single code point (UTF8) or byte (Latin1) from the sorted @p ranges.
+	Fragment rune_ranges(const std::vector<std::pair<re2::Rune, re2::Rune>>& ranges) {
+		if (this->encoding_ == Encoding::Latin1) {
+			ByteRanges bytes{};
+			for (const auto& [lo, hi] : ranges) {
+				if (lo > 0xFF) { break; }
+				bytes.emplace_back(lo, std::min(hi, 0xFF));
+			}
+			if (bytes.empty()) { return empty_language(); }
+			return this->sequence({ bytes });
+		}
+
+		std::vector<std::vector<ByteRanges>> sequences{};
+		for (const auto& [lo, hi] : ranges) { split_utf8_range(lo, hi, sequences); }
+		// Single-byte sequences share a single position.
+		ByteRanges single_bytes{};
+		Fragment result{empty_language()};
+		for (const std::vector<ByteRanges>& symbol_sequence : sequences) {
+			if (symbol_sequence.size() == 1) {
+				single_bytes.push_back(symbol_sequence[0][0]);
+			} else {
+				result = alternate(result, this->sequence(symbol_sequence));
+			}
+		}
+		if (!single_bytes.empty()) { result = alternate(result, this->sequence({ single_bytes })); }
+		return result;
+	}
+
+	static std::vector<mata::Symbol> encode_utf8(const re2::Rune rune) {
+		const auto code_point{static_cast<mata::Symbol>(rune)};
+		if (code_point < 0x80) { return { code_point }; }
+		if (code_point < 0x8'00) { return { 0xC0 | (code_point >> 6), 0x80 | (code_point & 0x3F) }; }
+		if (code_point < 0x1'00'00) {
+			return { 0xE0 | (code_point >> 12), 0x80 | ((code_point >> 6) & 0x3F), 0x80 | (code_point & 0x3F) };
+		}
+		return {
+			0xF0 | (code_point >> 18), 0x80 | ((code_point >> 12) & 0x3F), 0x80 | ((code_point >> 6) & 0x3F),
+			0x80 | (code_point & 0x3F)
+		};
+	}
+
+	/**
+	 * Split the range of code points [@p lo, @p hi] into sequences of byte ranges such that the sequences accept
+	 *  exactly the UTF8 encodings of the code points in the range.
+	 */
+	static void
+		split_utf8_range(const re2::Rune lo, const re2::Rune hi, std::vector<std::vector<ByteRanges>>& sequences) {
+		if (lo > hi) { return; }
+		// Split at the boundaries of the encoding lengths.
+		for (const re2::Rune max_of_length : { 0x7F, 0x7'FF, 0xFF'FF }) {
+			if (lo <= max_of_length && max_of_length < hi) {
+				split_utf8_range(lo, max_of_length, sequences);
+				split_utf8_range(max_of_length + 1, hi, sequences);
+				return;
+			}
+		}
+		// Split until all continuation bytes of the range form full ranges after the first differing byte.
+		for (int continuation_bytes{1}; continuation_bytes < 4; ++continuation_bytes) {
+			const re2::Rune mask{(1 << (6 * continuation_bytes)) - 1};
+			if ((lo & ~mask) != (hi & ~mask)) {
+				if ((lo & mask) != 0) {
+					split_utf8_range(lo, lo | mask, sequences);
+					split_utf8_range((lo | mask) + 1, hi, sequences);
+					return;
+				}
+				if ((hi & mask) != mask) {
+					split_utf8_range(lo, (hi & ~mask) - 1, sequences);
+					split_utf8_range(hi & ~mask, hi, sequences);
+					return;
+				}
+			}
+		}
+		const std::vector<mata::Symbol> lo_bytes{encode_utf8(lo)};
+		const std::vector<mata::Symbol> hi_bytes{encode_utf8(hi)};
+		std::vector<ByteRanges>& symbol_sequence{sequences.emplace_back()};
+		for (size_t index{0}; index < lo_bytes.size(); ++index) {
+			symbol_sequence.push_back({ { lo_bytes[index], hi_bytes[index] } });
+		}
+	}
+
+	void add_transitions(Nfa& nfa, const State source, std::vector<size_t>& positions) const {
+		std::ranges::sort(positions);
+		positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+		std::vector<std::pair<mata::Symbol, State>> transitions{};
+		for (const size_t position : positions) {
+			for (const auto& [lo, hi] : this->position_symbols_[position]) {
+				for (mata::Symbol symbol{lo}; symbol <= hi; ++symbol) {
+					transitions.emplace_back(symbol, position + 1);
+				}
+			}
+		}
+		std::ranges::sort(transitions);
+		transitions.erase(std::unique(transitions.begin(), transitions.end()), transitions.end());
+		StatePost& state_post{nfa.delta.mutable_state_post(source)};
+		for (auto transition{transitions.begin()}; transition != transitions.end();) {
+			SymbolPost& symbol_post{state_post.emplace_back(transition->first)};
+			for (; transition != transitions.end() && transition->first == symbol_post.symbol; ++transition) {
+				symbol_post.targets.push_back(transition->second);
+			}
+		}
+	}
+};
 } // namespace
 
 mata::nfa::Nfa mata::parser::create_nfa(
@@ -466,11 +763,23 @@ mata::nfa::Nfa mata::parser::create_nfa(
 	const bool use_epsilon,
 	const mata::Symbol epsilon_value,
 	const bool use_reduce,
-	const Encoding encoding
+	const Encoding encoding,
+	const RegexConstruction construction
 ) {
 	mata::nfa::Nfa result;
 	RegexParser regex_parser{};
 	const auto parsed_regex = regex_parser.parse_regex_string(pattern, encoding);
+	if (construction == RegexConstruction::Glushkov) {
+		try {
+			result = GlushkovConstruction{encoding}.build(parsed_regex);
+		} catch (...) {
+			parsed_regex->Decref();
+			throw;
+		}
+		parsed_regex->Decref();
+		if (use_reduce) { result = mata::nfa::reduce(result.trim()); }
+		return result;
+	}
 	const auto program = parsed_regex->CompileToProg(regex_parser.options.max_mem() * 2 / 3);
 	// FIXME: use_epsilon = false completely breaks the method convert_pro_to_nfa(). Needs fixing before allowing to
 	//  pass the argument use_epsilon to convert_pro_to_nfa().
@@ -497,7 +806,15 @@ void mata::parser::create_nfa(
 	const bool use_epsilon,
 	const mata::Symbol epsilon_value,
 	const bool use_reduce,
-	const Encoding encoding
+	const Encoding encoding,
+	const RegexConstruction construction
 ) {
-	*nfa = create_nfa(pattern, use_epsilon, epsilon_value, use_reduce, encoding);
+	*nfa = create_nfa(pattern, use_epsilon, epsilon_value, use_reduce, encoding, construction);
+}
+
+mata::nfa::RangeNfa
+mata::parser::create_range_nfa(const std::string& pattern, const Encoding encoding, const bool use_reduce) {
+	const nfa::Nfa byte_nfa{create_nfa(pattern, false, 306, use_reduce, encoding)};
+	if (encoding == Encoding::Utf8) { return nfa::decode_utf8_ranges(byte_nfa); }
+	return nfa::RangeNfa::from_nfa(byte_nfa);
 }
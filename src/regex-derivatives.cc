@@ -0,0 +1,505 @@
+/* regex-derivatives.cc -- lazy matching of regular expressions based on Brzozowski derivatives
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <initializer_list>
+#include <unordered_map>
+
+#include "mata/parser/regex-derivatives.hh"
+#include "re2/re2.h"
+#include "re2/regexp.h"
+
+using mata::Symbol;
+using mata::parser::DerivativeMatcher;
+
+/**
+ * Hash-consed store of regex terms with their derivatives.
+ *
+ * A term is identified by its index in the store. Operands of a term are indices of other terms, the operands of a
+ *  class are the bounds of its (sorted, disjoint and non-adjacent) ranges of symbols.
+ */
+class DerivativeMatcher::Terms {
+  public:
+	using Term = size_t;
+	static constexpr Term EMPTY{0};
+	static constexpr Term EPSILON{1};
+
+	Terms(const Encoding encoding, const size_t max_cached_transitions)
+		: max_symbol_{encoding == Encoding::Latin1 ? Symbol{0xFF} : Symbol{re2::Runemax}},
+		  max_cached_transitions_{max_cached_transitions} {
+		this->make(Kind::Empty, {}, false);
+		this->make(Kind::Epsilon, {}, true);
+	}
+
+	Term from_regexp(re2::Regexp* regex) {
+		switch (regex->op()) {
+			case re2::kRegexpNoMatch:
+				return EMPTY;
+			case re2::kRegexpEmptyMatch:
+			case re2::kRegexpHaveMatch:
+			case re2::kRegexpBeginLine:
+			case re2::kRegexpEndLine:
+			case re2::kRegexpBeginText:
+			case re2::kRegexpEndText:
+			case re2::kRegexpWordBoundary:
+			case re2::kRegexpNoWordBoundary:
+				return EPSILON;
+			case re2::kRegexpLiteral:
+				return this->literal(regex->rune(), regex->parse_flags());
+			case re2::kRegexpLiteralString: {
+				Term result{EPSILON};
+				for (int index{regex->nrunes() - 1}; index >= 0; --index) {
+					result = this->concatenate(this->literal(regex->runes()[index], regex->parse_flags()), result);
+				}
+				return result;
+			}
+			case re2::kRegexpConcat: {
+				Term result{EPSILON};
+				for (int index{regex->nsub() - 1}; index >= 0; --index) {
+					result = this->concatenate(this->from_regexp(regex->sub()[index]), result);
+				}
+				return result;
+			}
+			case re2::kRegexpAlternate: {
+				std::vector<Term> alternatives{};
+				for (int index{0}; index < regex->nsub(); ++index) {
+					alternatives.push_back(this->from_regexp(regex->sub()[index]));
+				}
+				return this->alternate(std::move(alternatives));
+			}
+			case re2::kRegexpStar:
+				return this->star(this->from_regexp(regex->sub()[0]));
+			case re2::kRegexpPlus: {
+				const Term sub{this->from_regexp(regex->sub()[0])};
+				return this->concatenate(sub, this->star(sub));
+			}
+			case re2::kRegexpQuest:
+				return this->alternate({ this->from_regexp(regex->sub()[0]), EPSILON });
+			case re2::kRegexpRepeat: {
+				// Hash-consing shares the copies of the repeated term.
+				const Term sub{this->from_regexp(regex->sub()[0])};
+				Term result{regex->max() == -1 ? this->star(sub) : EPSILON};
+				for (int index{regex->min()}; index < regex->max(); ++index) {
+					result = this->alternate({ this->concatenate(sub, result), EPSILON });
+				}
+				for (int index{0}; index < regex->min(); ++index) { result = this->concatenate(sub, result); }
+				return result;
+			}
+			case re2::kRegexpCapture:
+				return this->from_regexp(regex->sub()[0]);
+			case re2::kRegexpAnyChar:
+				return this->make_class({ 0, this->max_symbol_ });
+			case re2::kRegexpAnyByte:
+				return this->make_class({ 0, 0xFF });
+			case re2::kRegexpCharClass: {
+				std::vector<size_t> bounds{};
+				for (const re2::RuneRange& range : *regex->cc()) {
+					if (static_cast<Symbol>(range.lo) > this->max_symbol_) { break; }
+					bounds.push_back(static_cast<Symbol>(range.lo));
+					bounds.push_back(std::min(static_cast<Symbol>(range.hi), this->max_symbol_));
+				}
+				return this->make_class(std::move(bounds));
+			}
+		}
+		throw std::runtime_error("Unsupported regular expression operator");
+	}
+
+	bool is_nullable(const Term term) const { return this->nodes_[term].nullable; }
+	size_t num_of_terms() const { return this->nodes_.size(); }
+	size_t num_of_cached_transitions() const { return this->transitions_.size(); }
+
+	Term derivative(const Term term, const Symbol symbol) {
+		if (term == EMPTY || term == EPSILON) { return EMPTY; }
+		if (const auto transition{this->transitions_.find({ term, symbol })}; transition != this->transitions_.end()) {
+			return transition->second;
+		}
+		const Term result{this->compute_derivative(term, symbol)};
+		if (this->transitions_.size() >= this->max_cached_transitions_) {
+			this->transitions_.clear();
+			this->needs_compaction_ = true;
+		}
+		this->transitions_.emplace(std::make_pair(term, symbol), result);
+		return result;
+	}
+
+	/**
+	 * Representative symbols of the classes of symbols which @p term does not distinguish: the lower bounds of the
+	 *  maximal intervals of symbols not split by any range in @p term.
+	 */
+	const std::vector<Symbol>& representatives(const Term term) {
+		if (const auto found{this->representatives_.find(term)}; found != this->representatives_.end()) {
+			return found->second;
+		}
+		std::vector<Symbol> boundaries{0};
+		std::vector<bool> visited(this->nodes_.size(), false);
+		std::vector<Term> worklist{term};
+		visited[term] = true;
+		while (!worklist.empty()) {
+			const Node& node{this->nodes_[worklist.back()]};
+			worklist.pop_back();
+			if (node.kind == Kind::Class) {
+				for (size_t index{0}; index < node.operands.size(); index += 2) {
+					boundaries.push_back(static_cast<Symbol>(node.operands[index]));
+					if (node.operands[index + 1] < this->max_symbol_) {
+						boundaries.push_back(static_cast<Symbol>(node.operands[index + 1] + 1));
+					}
+				}
+				continue;
+			}
+			for (const Term operand : node.operands) {
+				if (!visited[operand]) {
+					visited[operand] = true;
+					worklist.push_back(operand);
+				}
+			}
+		}
+		std::ranges::sort(boundaries);
+		boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+		return this->representatives_.emplace(term, std::move(boundaries)).first->second;
+	}
+
+	/**
+	 * Release the terms which are not subterms of @p roots if the cache of transitions has been cleared since the last
+	 *  compaction, so that the store is bounded together with the cache. The remaining terms keep their order (the
+	 *  operands of a term precede it) and are renumbered, @p roots are updated to the new numbers.
+	 */
+	void compact(const std::initializer_list<Term*> roots) {
+		if (!this->needs_compaction_) { return; }
+		this->needs_compaction_ = false;
+		std::vector<bool> reachable(this->nodes_.size(), false);
+		reachable[EMPTY] = true;
+		reachable[EPSILON] = true;
+		std::vector<Term> worklist{};
+		for (const Term* const root : roots) {
+			if (!reachable[*root]) {
+				reachable[*root] = true;
+				worklist.push_back(*root);
+			}
+		}
+		while (!worklist.empty()) {
+			const Node& node{this->nodes_[worklist.back()]};
+			worklist.pop_back();
+			if (node.kind == Kind::Class) { continue; } // The operands are bounds of ranges, not terms.
+			for (const Term operand : node.operands) {
+				if (!reachable[operand]) {
+					reachable[operand] = true;
+					worklist.push_back(operand);
+				}
+			}
+		}
+
+		std::vector<Term> renamed(this->nodes_.size(), EMPTY);
+		std::vector<Node> nodes{};
+		this->index_.clear();
+		for (Term term{0}; term < this->nodes_.size(); ++term) {
+			if (!reachable[term]) { continue; }
+			Node& node{this->nodes_[term]};
+			if (node.kind != Kind::Class) {
+				for (size_t& operand : node.operands) { operand = renamed[operand]; }
+			}
+			renamed[term] = nodes.size();
+			this->index_.emplace(make_key(node.kind, node.operands), nodes.size());
+			nodes.push_back(std::move(node));
+		}
+		this->nodes_ = std::move(nodes);
+		this->transitions_.clear();
+		this->representatives_.clear();
+		for (Term* const root : roots) { *root = renamed[*root]; }
+	}
+
+  private:
+	enum class Kind : size_t { Empty, Epsilon, Class, Concat, Alternate, Star };
+
+	struct Node {
+		Kind kind;
+		std::vector<size_t> operands;
+		bool nullable;
+	};
+
+	Symbol max_symbol_;
+	size_t max_cached_transitions_;
+	std::vector<Node> nodes_{};
+	/// Map of the keys (kind followed by the operands) of the terms to the terms.
+	std::unordered_map<std::vector<size_t>, Term> index_{};
+	std::unordered_map<std::pair<Term, Symbol>, Term> transitions_{};
+	std::unordered_map<Term, std::vector<Symbol>> representatives_{};
+	/// Whether the cache of transitions has been cleared since the last compaction.
+	bool needs_compaction_{false};
+
+	static std::vector<size_t> make_key(const Kind kind, const std::vector<size_t>& operands) {
+		std::vector<size_t> key{static_cast<size_t>(kind)};
+		key.insert(key.end(), operands.begin(), operands.end());
+		return key;
+	}
+
+	Term make(const Kind kind, const std::vector<size_t>& operands, const bool nullable) {
+		const auto [it, inserted]{this->index_.try_emplace(make_key(kind, operands), this->nodes_.size())};
+		if (inserted) { this->nodes_.push_back(Node{kind, operands, nullable}); }
+		return it->second;
+	}
+
+	/// Class of the symbols in the ranges given by the bounds @p bounds (lo, hi, lo, hi, ...).
+	Term make_class(std::vector<size_t> bounds) {
+		std::vector<std::pair<size_t, size_t>> ranges{};
+		for (size_t index{0}; index < bounds.size(); index += 2) {
+			ranges.emplace_back(bounds[index], bounds[index + 1]);
+		}
+		std::ranges::sort(ranges);
+		bounds.clear();
+		for (const auto& [lo, hi] : ranges) {
+			if (!bounds.empty() && lo <= bounds.back() + 1) {
+				bounds.back() = std::max(bounds.back(), hi);
+			} else {
+				bounds.push_back(lo);
+				bounds.push_back(hi);
+			}
+		}
+		if (bounds.empty()) { return EMPTY; }
+		return this->make(Kind::Class, bounds, false);
+	}
+
+	Term literal(const re2::Rune rune, const re2::Regexp::ParseFlags flags) {
+		const auto symbol{static_cast<size_t>(rune)};
+		if (symbol > this->max_symbol_) { return EMPTY; }
+		// RE2 keeps case-folded literals only for ASCII letters; other literals are turned into classes.
+		if ((flags & re2::Regexp::FoldCase) != 0 && rune < 0x80 && std::isalpha(rune) != 0) {
+			const auto lower{static_cast<size_t>(std::tolower(rune))};
+			const auto upper{static_cast<size_t>(std::toupper(rune))};
+			return this->make_class({ upper, upper, lower, lower });
+		}
+		return this->make_class({ symbol, symbol });
+	}
+
+	Term concatenate(const Term lhs, const Term rhs) {
+		if (lhs == EMPTY || rhs == EMPTY) { return EMPTY; }
+		if (lhs == EPSILON) { return rhs; }
+		if (rhs == EPSILON) { return lhs; }
+		// Keep concatenations associated to the right: (a b) c = a (b c).
+		if (const Node& node{this->nodes_[lhs]}; node.kind == Kind::Concat) {
+			const Term first{node.operands[0]};
+			const Term rest{node.operands[1]};
+			return this->concatenate(first, this->concatenate(rest, rhs));
+		}
+		return this->make(Kind::Concat, { lhs, rhs }, this->is_nullable(lhs) && this->is_nullable(rhs));
+	}
+
+	Term alternate(std::vector<Term> alternatives) {
+		std::vector<Term> flattened{};
+		for (const Term alternative : alternatives) {
+			if (alternative == EMPTY) { continue; }
+			if (const Node& node{this->nodes_[alternative]}; node.kind == Kind::Alternate) {
+				flattened.insert(flattened.end(), node.operands.begin(), node.operands.end());
+			} else {
+				flattened.push_back(alternative);
+			}
+		}
+		std::ranges::sort(flattened);
+		flattened.erase(std::unique(flattened.begin(), flattened.end()), flattened.end());
+		if (flattened.empty()) { return EMPTY; }
+		if (flattened.size() == 1) { return flattened[0]; }
+		const bool nullable{std::ranges::any_of(flattened, [&](const Term term) { return this->is_nullable(term); })};
+		return this->make(Kind::Alternate, flattened, nullable);
+	}
+
+	Term star(const Term term) {
+		if (term == EMPTY || term == EPSILON) { return EPSILON; }
+		if (this->nodes_[term].kind == Kind::Star) { return term; }
+		return this->make(Kind::Star, { term }, true);
+	}
+
+	Term compute_derivative(const Term term, const Symbol symbol) {
+		// Copy the node, the store may be reallocated by the construction of the derivatives of the operands.
+		const Node node{this->nodes_[term]};
+		switch (node.kind) {
+			case Kind::Empty:
+			case Kind::Epsilon:
+				return EMPTY;
+			case Kind::Class: {
+				const auto upper{std::ranges::upper_bound(node.operands, size_t{symbol})};
+				// The symbol is in a range iff it is preceded by an odd number of bounds or equals an upper bound.
+				const auto position{static_cast<size_t>(upper - node.operands.begin())};
+				const bool contains{position % 2 == 1 || (position > 0 && node.operands[position - 1] == symbol)};
+				return contains ? EPSILON : EMPTY;
+			}
+			case Kind::Concat: {
+				const Term lhs{node.operands[0]};
+				const Term rhs{node.operands[1]};
+				const Term lhs_derivative{this->concatenate(this->derivative(lhs, symbol), rhs)};
+				if (!this->is_nullable(lhs)) { return lhs_derivative; }
+				return this->alternate({ lhs_derivative, this->derivative(rhs, symbol) });
+			}
+			case Kind::Alternate: {
+				std::vector<Term> derivatives{};
+				derivatives.reserve(node.operands.size());
+				for (const Term operand : node.operands) { derivatives.push_back(this->derivative(operand, symbol)); }
+				return this->alternate(std::move(derivatives));
+			}
+			case Kind::Star:
+				return this->concatenate(this->derivative(node.operands[0], symbol), term);
+		}
+		throw std::runtime_error("Unknown kind of a regex term");
+	}
+};
+
+DerivativeMatcher::DerivativeMatcher(
+	const std::string& pattern, const Encoding encoding, const size_t max_cached_transitions
+)
+	: terms_{std::make_unique<Terms>(encoding, max_cached_transitions)},
+	  initial_state_{[&] {
+		  const RE2::Options options{};
+		  re2::RegexpStatus status{};
+		  re2::Regexp* const regex{re2::Regexp::Parse(
+			  pattern, static_cast<re2::Regexp::ParseFlags>(options.ParseFlags() | static_cast<int>(encoding)), &status
+		  )};
+		  if (regex == nullptr) { throw std::runtime_error("Error parsing '" + pattern + "': " + status.Text()); }
+		  try {
+			  const State initial_state{this->terms_->from_regexp(regex)};
+			  regex->Decref();
+			  return initial_state;
+		  } catch (...) {
+			  regex->Decref();
+			  throw;
+		  }
+	  }()} {}
+
+DerivativeMatcher::DerivativeMatcher(DerivativeMatcher&& other) noexcept = default;
+DerivativeMatcher& DerivativeMatcher::operator=(DerivativeMatcher&& other) noexcept = default;
+DerivativeMatcher::~DerivativeMatcher() = default;
+
+DerivativeMatcher::State DerivativeMatcher::initial_state() const { return this->initial_state_; }
+
+DerivativeMatcher::State DerivativeMatcher::next_state(const State state, const Symbol symbol) {
+	return this->terms_->derivative(state, symbol);
+}
+
+bool DerivativeMatcher::is_final(const State state) const { return this->terms_->is_nullable(state); }
+
+bool DerivativeMatcher::is_sink(const State state) const { return state == Terms::EMPTY; }
+
+bool DerivativeMatcher::is_in_lang(const Word& word) {
+	this->terms_->compact({ &this->initial_state_ });
+	State state{this->initial_state_};
+	for (const Symbol symbol : word) {
+		state = this->next_state(state, symbol);
+		if (this->is_sink(state)) { return false; }
+		this->terms_->compact({ &this->initial_state_, &state });
+	}
+	return this->is_final(state);
+}
+
+bool DerivativeMatcher::is_lang_empty(nfa::Run* cex) {
+	this->terms_->compact({ &this->initial_state_ });
+	// Breadth-first search, remembering the predecessor and the symbol for each discovered state.
+	std::unordered_map<State, std::pair<State, Symbol>> predecessors{};
+	std::vector<State> worklist{this->initial_state_};
+	predecessors.emplace(this->initial_state_, std::make_pair(this->initial_state_, Symbol{0}));
+	for (size_t next{0}; next < worklist.size(); ++next) {
+		const State state{worklist[next]};
+		if (this->is_final(state)) {
+			if (cex != nullptr) {
+				cex->word.clear();
+				cex->path.clear();
+				for (State current{state}; current != this->initial_state_;) {
+					const auto [predecessor, symbol]{predecessors.at(current)};
+					cex->word.push_back(symbol);
+					current = predecessor;
+				}
+				std::ranges::reverse(cex->word);
+			}
+			return false;
+		}
+		// Copy the representatives, the cache of the representatives may be rehashed by the derivatives.
+		const std::vector<Symbol> representatives{this->terms_->representatives(state)};
+		for (const Symbol symbol : representatives) {
+			const State successor{this->next_state(state, symbol)};
+			if (!this->is_sink(successor) && predecessors.emplace(successor, std::make_pair(state, symbol)).second) {
+				worklist.push_back(successor);
+			}
+		}
+	}
+	return true;
+}
+
+bool DerivativeMatcher::is_intersection_empty(const nfa::Nfa& nfa, nfa::Run* cex) {
+	this->terms_->compact({ &this->initial_state_ });
+	using ProductState = std::pair<State, nfa::State>;
+	// Predecessor product state and the symbol for each discovered product state; initial states are their own.
+	std::unordered_map<ProductState, std::pair<ProductState, Symbol>> predecessors{};
+	std::vector<ProductState> worklist{};
+	for (const nfa::State initial : nfa.initial) {
+		const ProductState product_state{this->initial_state_, initial};
+		predecessors.emplace(product_state, std::make_pair(product_state, Symbol{0}));
+		worklist.push_back(product_state);
+	}
+	for (size_t next{0}; next < worklist.size(); ++next) {
+		const auto [state, nfa_state]{worklist[next]};
+		if (this->is_final(state) && nfa.final.contains(nfa_state)) {
+			if (cex != nullptr) {
+				cex->word.clear();
+				cex->path.clear();
+				for (ProductState current{worklist[next]};;) {
+					cex->path.push_back(current.second);
+					const auto& [predecessor, symbol]{predecessors.at(current)};
+					if (predecessor == current) { break; }
+					cex->word.push_back(symbol);
+					current = predecessor;
+				}
+				std::ranges::reverse(cex->word);
+				std::ranges::reverse(cex->path);
+			}
+			return false;
+		}
+		if (nfa_state >= nfa.delta.num_of_states()) { continue; }
+		for (const nfa::SymbolPost& symbol_post : nfa.delta[nfa_state]) {
+			const State successor{this->next_state(state, symbol_post.symbol)};
+			if (this->is_sink(successor)) { continue; }
+			for (const nfa::State target : symbol_post.targets) {
+				const ProductState product_state{successor, target};
+				if (predecessors.emplace(product_state, std::make_pair(worklist[next], symbol_post.symbol)).second) {
+					worklist.push_back(product_state);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+mata::nfa::Nfa DerivativeMatcher::intersection(const nfa::Nfa& nfa) {
+	this->terms_->compact({ &this->initial_state_ });
+	using ProductState = std::pair<State, nfa::State>;
+	nfa::Nfa result{};
+	std::unordered_map<ProductState, nfa::State> product_map{};
+	std::vector<ProductState> worklist{};
+	auto get_product_state = [&](const ProductState& product_state) {
+		const auto [it, inserted]{product_map.try_emplace(product_state, product_map.size())};
+		if (inserted) {
+			worklist.push_back(product_state);
+			if (this->is_final(product_state.first) && nfa.final.contains(product_state.second)) {
+				result.final.insert(it->second);
+			}
+		}
+		return it->second;
+	};
+	for (const nfa::State initial : nfa.initial) {
+		result.initial.insert(get_product_state({ this->initial_state_, initial }));
+	}
+	while (!worklist.empty()) {
+		const ProductState product_state{worklist.back()};
+		worklist.pop_back();
+		if (product_state.second >= nfa.delta.num_of_states()) { continue; }
+		const nfa::State source{product_map.at(product_state)};
+		for (const nfa::SymbolPost& symbol_post : nfa.delta[product_state.second]) {
+			const State successor{this->next_state(product_state.first, symbol_post.symbol)};
+			if (this->is_sink(successor)) { continue; }
+			for (const nfa::State target : symbol_post.targets) {
+				result.delta.add(source, symbol_post.symbol, get_product_state({ successor, target }));
+			}
+		}
+	}
+	return result;
+}
+
+size_t DerivativeMatcher::num_of_terms() const { return this->terms_->num_of_terms(); }
+
+size_t DerivativeMatcher::num_of_cached_transitions() const { return this->terms_->num_of_cached_transitions(); }
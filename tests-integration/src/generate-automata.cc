@@ -0,0 +1,89 @@
+/**
+ * Generator of scalable random automata for the stress and scaling benchmarks.
+ *
+ * Usage: generate-automata <family> <size> <alphabet-size> <seed> <output>
+ *
+ * The families are:
+ *   - `tabakov-vardi`: random NFA with <size> states and 1.25 transitions per state and symbol,
+ *   - `nth-from-last`: NFA accepting words with symbol 0 at the <size>-th position from the end,
+ *   - `inclusion-pair`: pair of NFAs with hard (and holding) inclusion, written to `<output>-lhs` and `<output>-rhs`,
+ *   - `epsilon-chain`: random NFA with an epsilon chain of <size> states,
+ *   - `nft`: random NFT with <size> states on 2 levels,
+ *   - `equation`: random string equation x_1 x_2 x_3 = y_1 y_2 with constraints of <size> states, written to
+ *     `<output>-lhs-<i>` and `<output>-rhs-<i>`.
+ *
+ * The automata are written in the binary format if <output> ends with `.bin`, or in the `.mata` format otherwise.
+ * The same seed always generates the same automata.
+ */
+
+#include "mata/applications/strings.hh"
+#include "mata/nfa/builder.hh"
+#include "mata/nft/builder.hh"
+#include "mata/parser/binary.hh"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace {
+
+std::filesystem::path with_suffix(const std::filesystem::path& path, const std::string& suffix) {
+	std::filesystem::path result{ path };
+	result.replace_filename(path.stem().string() + suffix + path.extension().string());
+	return result;
+}
+
+template<class Automaton> void write(const Automaton& aut, const std::filesystem::path& path) {
+	if (path.extension() == ".bin") {
+		mata::parser::write_binary(aut, path);
+	} else {
+		aut.print_to_mata(path.string());
+	}
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	if (argc != 6) {
+		std::cerr << "Usage: " << argv[0] << " <family> <size> <alphabet-size> <seed> <output>\n";
+		return EXIT_FAILURE;
+	}
+
+	const std::string family{ argv[1] };
+	const size_t size{ std::stoul(argv[2]) };
+	const size_t alphabet_size{ std::stoul(argv[3]) };
+	const auto seed{ static_cast<unsigned>(std::stoul(argv[4])) };
+	const std::filesystem::path output{ argv[5] };
+
+	using namespace mata::nfa;
+	if (family == "tabakov-vardi") {
+		write(builder::create_random_nfa_tabakov_vardi(size, alphabet_size, 1.25, 0.5, seed), output);
+	} else if (family == "nth-from-last") {
+		write(builder::create_nth_from_last_nfa(size, alphabet_size), output);
+	} else if (family == "inclusion-pair") {
+		const auto [smaller, bigger]{ builder::create_hard_inclusion_pair(size, alphabet_size) };
+		write(smaller, with_suffix(output, "-lhs"));
+		write(bigger, with_suffix(output, "-rhs"));
+	} else if (family == "epsilon-chain") {
+		// The .mata format has no epsilon symbol, so the epsilon is the first symbol outside the alphabet.
+		const auto epsilon{ static_cast<mata::Symbol>(alphabet_size) };
+		write(builder::create_epsilon_chain_nfa(size, alphabet_size, seed, epsilon), output);
+	} else if (family == "nft") {
+		write(mata::nft::builder::create_random_nft_tabakov_vardi(size, 2, alphabet_size, 1.25, 0.5, seed), output);
+	} else if (family == "equation") {
+		const auto equation{
+			mata::applications::strings::seg_nfa::create_random_equation(3, 2, size, alphabet_size, 1.25, seed)
+		};
+		for (size_t i{ 0 }; i < equation.lhs_automata.size(); ++i) {
+			write(*equation.lhs_automata[i], with_suffix(output, "-lhs-" + std::to_string(i)));
+		}
+		for (size_t i{ 0 }; i < equation.rhs_automata.size(); ++i) {
+			write(*equation.rhs_automata[i], with_suffix(output, "-rhs-" + std::to_string(i)));
+		}
+	} else {
+		std::cerr << "Unknown family " << family << "\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/**
+ * Benchmark: scaling of the operations on the generated automata families
+ *
+ * Usage: scaling-operations <family> <size> <alphabet-size> <seed>
+ *
+ * Generates an instance of the family (see `generate-automata.cc`) in memory and measures the operations the family
+ *  stresses. Run it on increasing sizes to see how the operations scale.
+ *
+ * Optimal Inputs: inputs/scaling-families.input
+ */
+
+#include "mata/applications/strings.hh"
+#include "mata/nfa/builder.hh"
+#include "mata/nft/builder.hh"
+#include "utils/utils.hh"
+
+int main(int argc, char* argv[]) {
+	if (argc != 5) {
+		std::cerr << "Usage: " << argv[0] << " <family> <size> <alphabet-size> <seed>\n";
+		return EXIT_FAILURE;
+	}
+
+	const std::string family{ argv[1] };
+	const size_t size{ std::stoul(argv[2]) };
+	const size_t alphabet_size{ std::stoul(argv[3]) };
+	const auto seed{ static_cast<unsigned>(std::stoul(argv[4])) };
+
+	// Setting precision of the times to fixed points and 4 decimal places
+	std::cout << std::fixed << std::setprecision(4);
+
+	if (family == "tabakov-vardi") {
+		TIME_BEGIN(generate);
+		const Nfa aut{ builder::create_random_nfa_tabakov_vardi(size, alphabet_size, 1.25, 0.5, seed) };
+		TIME_END(generate);
+		TIME_STATEMENT(trim, Nfa{ aut }.trim());
+		TIME_STATEMENT(reduce, reduce(aut));
+		TIME_STATEMENT(determinize, determinize(aut));
+	} else if (family == "nth-from-last") {
+		const Nfa aut{ builder::create_nth_from_last_nfa(size, alphabet_size) };
+		TIME_STATEMENT(determinize, determinize(aut));
+		TIME_STATEMENT(minimize, minimize(aut));
+	} else if (family == "inclusion-pair") {
+		const auto [smaller, bigger]{ builder::create_hard_inclusion_pair(size, alphabet_size) };
+		TIME_STATEMENT(inclusion_antichains, is_included(smaller, bigger));
+		TIME_STATEMENT(inclusion_naive, algorithms::is_included_naive(smaller, bigger));
+	} else if (family == "epsilon-chain") {
+		const Nfa aut{ builder::create_epsilon_chain_nfa(size, alphabet_size, seed) };
+		TIME_STATEMENT(remove_epsilon, remove_epsilon(aut));
+	} else if (family == "nft") {
+		const mata::nft::Nft nft{
+			mata::nft::builder::create_random_nft_tabakov_vardi(size, 2, alphabet_size, 1.25, 0.5, seed)
+		};
+		TIME_STATEMENT(compose, mata::nft::compose(nft, nft, 1, 0));
+		TIME_STATEMENT(project, mata::nft::project_out(nft, 1));
+	} else if (family == "equation") {
+		const auto equation{
+			mata::applications::strings::seg_nfa::create_random_equation(3, 2, size, alphabet_size, 1.25, seed)
+		};
+		TIME_STATEMENT(
+			noodlify,
+			mata::applications::strings::seg_nfa::noodlify_for_equation(equation.lhs_automata, equation.rhs_automata)
+		);
+	} else {
+		std::cerr << "Unknown family " << family << "\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+#ifndef LIBMATA_PERFTEST_CONFIG_H
+#define LIBMATA_PERFTEST_CONFIG_H
+
+#include <string>
+
+namespace mata::PerformanceTesting {
+    const std::string AUTOMATA_DIR = "/root/repo/tests-integration/automata";
+    const std::string BENCHMARK_DIR = "/root/repo/tests-integration/benchmark";
+}
+
+#endif //LIBMATA_PERFTEST_CONFIG_H
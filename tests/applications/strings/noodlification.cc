@@ -150,6 +150,90 @@ TEST_CASE("mata::nfa::SegNfa::noodlify()")
     }
 }
 
+TEST_CASE("mata::applications::strings::seg_nfa::NoodleGenerator") {
+    Nfa aut{20};
+    aut.initial.insert({0, 1, 2});
+    aut.final.insert({11, 12, 13, 14, 15, 16});
+    aut.delta.add(0, 'e', 3);
+    aut.delta.add(0, 'e', 4);
+    aut.delta.add(0, 'e', 5);
+    aut.delta.add(1, 'e', 3);
+    aut.delta.add(1, 'e', 4);
+    aut.delta.add(2, 'e', 5);
+
+    aut.delta.add(3, 'e', 6);
+    aut.delta.add(3, 'e', 7);
+    aut.delta.add(4, 'e', 8);
+    aut.delta.add(4, 'e', 9);
+    aut.delta.add(5, 'e', 10);
+
+    aut.delta.add(6, 'e', 11);
+    aut.delta.add(7, 'e', 12);
+    aut.delta.add(8, 'e', 13);
+    aut.delta.add(8, 'e', 14);
+    aut.delta.add(9, 'e', 15);
+    aut.delta.add(10, 'e', 16);
+
+    SECTION("lazy generation") {
+        seg_nfa::NoodleGenerator generator{ aut, 'e' };
+        size_t num_of_noodles{ 0 };
+        while (std::optional<seg_nfa::Noodle> noodle{ generator.next() }) {
+            CHECK(noodle->size() == 4);
+            ++num_of_noodles;
+        }
+        CHECK(num_of_noodles == 12);
+        CHECK(generator.finished());
+        CHECK(!generator.next().has_value());
+    }
+
+    SECTION("early stopping") {
+        seg_nfa::NoodleGenerator generator{ aut, 'e' };
+        CHECK(generator.next().has_value());
+        CHECK(!generator.finished());
+    }
+
+    SECTION("find noodle") {
+        Nfa branching{ 30, { 0 }, { 21 } };
+        branching.delta.add(0, 'a', 1);
+        const std::vector<mata::Symbol> middle_symbols{ 'b', 'c', 'd', 'f' };
+        for (State i{ 0 }; i < middle_symbols.size(); ++i) {
+            branching.delta.add(1, 'e', 2 + i);
+            branching.delta.add(2 + i, middle_symbols[i], 10 + i);
+            branching.delta.add(10 + i, 'e', 20);
+        }
+        branching.delta.add(20, 'z', 21);
+
+        const std::vector<seg_nfa::Noodle> noodles{ seg_nfa::noodlify(branching, 'e') };
+        REQUIRE(noodles.size() == 4);
+        const auto predicate = [](const seg_nfa::Noodle& noodle) {
+            return noodle[1]->is_in_lang(mata::Word{ 'd' }) || noodle[1]->is_in_lang(mata::Word{ 'f' });
+        };
+        const auto expected{ std::ranges::find_if(noodles, predicate) };
+        REQUIRE(expected != noodles.end());
+        for (const size_t num_of_threads : { 1UL, 4UL }) {
+            seg_nfa::NoodleGenerator generator{ branching, 'e' };
+            std::optional<seg_nfa::Noodle> found{ seg_nfa::find_noodle(generator, predicate, num_of_threads) };
+            REQUIRE(found.has_value());
+            REQUIRE(found->size() == expected->size());
+            for (size_t i{ 0 }; i < found->size(); ++i) { CHECK(are_equivalent(*(*found)[i], *(*expected)[i])); }
+        }
+
+        seg_nfa::NoodleGenerator generator{ branching, 'e' };
+        CHECK(!seg_nfa::find_noodle(generator, [](const seg_nfa::Noodle&) { return false; }, 3).has_value());
+
+        for (const size_t num_of_threads : { 1UL, 4UL }) {
+            seg_nfa::NoodleGenerator throwing_generator{ branching, 'e' };
+            const auto throwing_predicate = [](const seg_nfa::Noodle& noodle) -> bool {
+                if (noodle[1]->is_in_lang(mata::Word{ 'c' })) { throw std::runtime_error("predicate failed"); }
+                return false;
+            };
+            CHECK_THROWS_WITH(
+                seg_nfa::find_noodle(throwing_generator, throwing_predicate, num_of_threads), "predicate failed"
+            );
+        }
+    }
+}
+
 TEST_CASE("mata::nfa::SegNfa::noodlify_for_equation()") {
     SECTION("Empty input") {
         CHECK(seg_nfa::noodlify_for_equation(std::vector<std::reference_wrapper<Nfa>>{}, Nfa{}).empty());
@@ -536,6 +620,127 @@ q3 0 q4
     }
 }
 
+TEST_CASE("mata::applications::strings::seg_nfa::NoodlificationCache") {
+    seg_nfa::NoodlificationCache cache{};
+
+    SECTION("Equation with single right side") {
+        Nfa left1{ create_from_regex("a*") };
+        Nfa left2{ create_from_regex("(a|b)*") };
+        const Nfa right{ create_from_regex("a*b*") };
+        const std::vector<seg_nfa::Noodle> expected{ seg_nfa::noodlify_for_equation({ left1, left2 }, right) };
+
+        const std::vector<seg_nfa::Noodle> noodles{ seg_nfa::noodlify_for_equation({ left1, left2 }, right, false, {}, &cache) };
+        CHECK(cache.get_statistics().noodles_hits == 0);
+        CHECK(cache.get_statistics().segments_misses > 0);
+        CHECK(cache.num_of_entries() > 0);
+        REQUIRE(noodles.size() == expected.size());
+        for (size_t i{ 0 }; i < noodles.size(); ++i) {
+            REQUIRE(noodles[i].size() == expected[i].size());
+            for (size_t j{ 0 }; j < noodles[i].size(); ++j) { CHECK(are_equivalent(*noodles[i][j], *expected[i][j])); }
+        }
+
+        const std::vector<seg_nfa::Noodle> cached_noodles{ seg_nfa::noodlify_for_equation({ left1, left2 }, right, false, {}, &cache) };
+        CHECK(cache.get_statistics().noodles_hits == 1);
+        CHECK(cached_noodles == noodles);
+
+        // A different reduction is a different entry for the equation (missed for both the equation and the product).
+        CHECK(cache.get_statistics().noodles_misses == 2);
+        seg_nfa::noodlify_for_equation({ left1, left2 }, right, false, { { "reduce", "forward" } }, &cache);
+        CHECK(cache.get_statistics().noodles_misses == 3);
+
+        cache.clear();
+        CHECK(cache.num_of_entries() == 0);
+        seg_nfa::noodlify_for_equation({ left1, left2 }, right, false, {}, &cache);
+        CHECK(cache.get_statistics().noodles_misses == 5);
+    }
+
+    SECTION("Reused segments") {
+        Nfa aut{ 5, { 0 }, { 4 } };
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, EPSILON, 2);
+        aut.delta.add(2, 'b', 3);
+        aut.delta.add(3, EPSILON, 4);
+        seg_nfa::noodlify(aut, EPSILON, false, &cache);
+        const size_t num_of_segments_misses{ cache.get_statistics().segments_misses };
+        CHECK(cache.get_statistics().segments_hits == 0);
+
+        // Only the last segment changes.
+        aut.delta.add(4, 'c', 4);
+        const std::vector<seg_nfa::Noodle> noodles{ seg_nfa::noodlify(aut, EPSILON, false, &cache) };
+        CHECK(cache.get_statistics().noodles_hits == 0);
+        CHECK(cache.get_statistics().segments_hits == 2);
+        CHECK(cache.get_statistics().segments_misses == num_of_segments_misses + 1);
+        REQUIRE(noodles.size() == 1);
+        REQUIRE(noodles[0].size() == 3);
+        CHECK(noodles[0][2]->is_in_lang(mata::Word{ 'c', 'c' }));
+    }
+
+    SECTION("Equation with both sides") {
+        const std::vector<std::shared_ptr<Nfa>> lhs{ std::make_shared<Nfa>(create_from_regex("a*")), std::make_shared<Nfa>(create_from_regex("(a|b)*")) };
+        const std::vector<std::shared_ptr<Nfa>> rhs{ std::make_shared<Nfa>(create_from_regex("(a|b)*")), std::make_shared<Nfa>(create_from_regex("(a|b)*")) };
+        const std::vector<seg_nfa::NoodleWithEpsilonsCounter> noodles{ seg_nfa::noodlify_for_equation(lhs, rhs, false, {}, &cache) };
+        CHECK(cache.get_statistics().noodles_hits == 0);
+        CHECK(seg_nfa::noodlify_for_equation(lhs, rhs, false, {}, &cache) == noodles);
+        CHECK(cache.get_statistics().noodles_hits == 1);
+        // Swapping the automata between the sides is a different equation.
+        CHECK(seg_nfa::noodlify_for_equation({ lhs[0] }, { lhs[1], rhs[0], rhs[1] }, false, {}, &cache) != noodles);
+        CHECK(cache.get_statistics().noodles_hits == 1);
+    }
+
+    SECTION("Bounded number of entries") {
+        seg_nfa::NoodlificationCache small_cache{ 2 };
+        Nfa aut{ 5, { 0 }, { 4 } };
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, EPSILON, 2);
+        aut.delta.add(2, 'b', 3);
+        aut.delta.add(3, EPSILON, 4);
+        seg_nfa::noodlify(aut, EPSILON, false, &small_cache);
+        CHECK(small_cache.num_of_entries() <= 2);
+    }
+
+    SECTION("Least recently used entries are evicted") {
+        seg_nfa::NoodlificationCache small_cache{ 2 };
+        const Nfa first{ create_from_regex("a+") };
+        const Nfa second{ create_from_regex("b+") };
+        const Nfa third{ create_from_regex("c+") };
+        small_cache.get_segment(first, std::nullopt, std::nullopt);
+        small_cache.get_segment(second, std::nullopt, std::nullopt);
+        // Using the first segment again makes the second one the least recently used.
+        small_cache.get_segment(first, std::nullopt, std::nullopt);
+        small_cache.get_segment(third, std::nullopt, std::nullopt);
+        CHECK(small_cache.get_statistics().evictions == 1);
+        CHECK(small_cache.num_of_entries() == 2);
+        small_cache.get_segment(first, std::nullopt, std::nullopt);
+        CHECK(small_cache.get_statistics().segments_hits == 2);
+        small_cache.get_segment(second, std::nullopt, std::nullopt);
+        CHECK(small_cache.get_statistics().segments_hits == 2);
+        CHECK(small_cache.get_statistics().segments_misses == 4);
+        small_cache.clear();
+        CHECK(small_cache.num_of_entries() == 0);
+    }
+
+    SECTION("Cache without capacity stores nothing") {
+        seg_nfa::NoodlificationCache empty_cache{ 0 };
+        const Nfa segment{ create_from_regex("a+") };
+        CHECK(empty_cache.get_segment(segment, std::nullopt, std::nullopt)->is_identical(reduce(segment)));
+        CHECK(empty_cache.get_segment(segment, std::nullopt, std::nullopt)->is_identical(reduce(segment)));
+        CHECK(empty_cache.num_of_entries() == 0);
+        CHECK(empty_cache.get_statistics().segments_hits == 0);
+        CHECK(empty_cache.get_statistics().segments_misses == 2);
+        CHECK(empty_cache.get_statistics().evictions == 0);
+    }
+}
+
+TEST_CASE("mata::applications::strings::seg_nfa::create_random_equation()") {
+    const seg_nfa::Equation equation{ seg_nfa::create_random_equation(3, 2, 8, 2, 1.5, 13) };
+    REQUIRE(equation.lhs_automata.size() == 3);
+    REQUIRE(equation.rhs_automata.size() == 2);
+    const seg_nfa::Equation same{ seg_nfa::create_random_equation(3, 2, 8, 2, 1.5, 13) };
+    for (size_t i{ 0 }; i < 3; ++i) { CHECK(equation.lhs_automata[i]->is_identical(*same.lhs_automata[i])); }
+    // Each constraint accepts the empty word, hence the equation has a solution.
+    CHECK(!seg_nfa::noodlify_for_equation(equation.lhs_automata, equation.rhs_automata).empty());
+}
+
 TEST_CASE("mata::nfa::SegNfa::noodlify_for_equation() for profiling", "[.profiling][noodlify]") {
     Nfa left1{ 3};
     left1.initial.insert(0);
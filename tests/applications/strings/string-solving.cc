@@ -240,6 +240,62 @@ TEST_CASE("mata::applications::strings::get_lengths()") {
     }
 }
 
+TEST_CASE("mata::applications::strings::LengthAbstraction") {
+    SECTION("empty language") {
+        const LengthAbstraction lengths{ Nfa{} };
+        CHECK(lengths.is_empty());
+        CHECK(lengths.is_finite());
+        CHECK(!lengths.contains(0));
+        CHECK(!lengths.get_max_length().has_value());
+        CHECK(lengths.get_word_lengths().empty());
+    }
+
+    SECTION("finite language") {
+        const LengthAbstraction lengths{ create_from_regex("ab|abcd") };
+        CHECK(lengths.is_finite());
+        CHECK(lengths.get_period() == 0);
+        CHECK(lengths.get_min_length() == 2);
+        CHECK(lengths.get_max_length() == 4);
+        CHECK(lengths.contains(2));
+        CHECK(!lengths.contains(3));
+        CHECK(lengths.contains(4));
+        CHECK(!lengths.contains(100));
+    }
+
+    SECTION("infinite language") {
+        const LengthAbstraction lengths{ create_from_regex("(cd(abcde)*)|(a(aaa)*)") };
+        CHECK(!lengths.is_finite());
+        CHECK(lengths.get_period() == 15);
+        CHECK(lengths.get_min_length() == 1);
+        CHECK(!lengths.get_max_length().has_value());
+        for (size_t length{ 0 }; length < 100; ++length) {
+            CHECK(lengths.contains(length) == (length % 3 == 1 || (length >= 2 && length % 5 == 2)));
+        }
+    }
+
+    SECTION("loop without final states") {
+        Nfa aut{ 4, { 0 }, { 1 } };
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, 'b', 2);
+        aut.delta.add(2, 'c', 3);
+        aut.delta.add(3, 'c', 2);
+        const LengthAbstraction lengths{ aut };
+        CHECK(lengths.get_loop_start() == 2);
+        CHECK(lengths.get_period() == 2);
+        CHECK(lengths.is_finite());
+        CHECK(lengths.get_word_lengths() == std::set<std::pair<int, int>>{ { 1, 0 } });
+    }
+
+    SECTION("lengths of the one-letter automaton") {
+        Nfa aut{ create_from_regex("a(aaaa|aaaaaaa)*b(cc|ccccc)*|(ccc)*") };
+        const LengthAbstraction lengths{ aut };
+        const Nfa one_letter{ aut.get_one_letter_aut('a') };
+        for (size_t length{ 0 }; length < 60; ++length) {
+            CHECK(lengths.contains(length) == one_letter.is_in_lang(mata::Word(length, 'a')));
+        }
+    }
+}
+
 TEST_CASE("mata::applications::strings::is_lang_eps()") {
 
     SECTION("basic") {
@@ -0,0 +1,106 @@
+/* tests/binary.cc -- tests of the binary format for NFAs and NFTs.
+ */
+
+#include <filesystem>
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/nft/nft.hh"
+#include "mata/parser/binary.hh"
+
+using namespace mata::parser;
+using mata::OnTheFlyAlphabet;
+using mata::nfa::Nfa;
+using mata::nft::Nft;
+
+namespace {
+std::vector<std::byte> to_bytes(const std::string& string) {
+	const auto* const begin{reinterpret_cast<const std::byte*>(string.data())};
+	return {begin, begin + string.size()};
+}
+} // namespace
+
+TEST_CASE("mata::parser::write_binary() and read_nfa_binary()") {
+	Nfa nfa{6};
+	nfa.initial = {0, 3};
+	nfa.final = {5};
+	nfa.delta.add(0, 'a', 1);
+	nfa.delta.add(0, 'a', 2);
+	nfa.delta.add(0, 'b', 4);
+	nfa.delta.add(1, 'c', 5);
+	nfa.delta.add(3, mata::nfa::EPSILON, 5);
+	nfa.delta.add(4, 'b', 0);
+
+	SECTION("round trip over a stream") {
+		std::stringstream stream{};
+		write_binary(nfa, stream);
+		const Nfa read_nfa{read_nfa_binary(stream)};
+		CHECK(read_nfa.is_identical(nfa));
+		CHECK(read_nfa.num_of_states() == nfa.num_of_states());
+	}
+
+	SECTION("round trip over a memory-mapped file") {
+		const std::filesystem::path file{std::filesystem::temp_directory_path() / "mata-binary-test.nfa"};
+		write_binary(nfa, file);
+		const Nfa read_nfa{read_nfa_binary(file)};
+		std::filesystem::remove(file);
+		CHECK(read_nfa.is_identical(nfa));
+	}
+
+	SECTION("empty automaton") {
+		std::stringstream stream{};
+		write_binary(Nfa{}, stream);
+		const Nfa read_nfa{read_nfa_binary(stream)};
+		CHECK(read_nfa.num_of_states() == 0);
+		CHECK(read_nfa.initial.empty());
+		CHECK(read_nfa.final.empty());
+	}
+
+	SECTION("alphabet") {
+		OnTheFlyAlphabet alphabet{};
+		alphabet.add_new_symbol("a", 'a');
+		alphabet.add_new_symbol("b", 'b');
+		alphabet.add_new_symbol("long symbol name", 'c');
+		std::stringstream stream{};
+		write_binary(nfa, stream, &alphabet);
+		OnTheFlyAlphabet read_alphabet{};
+		const Nfa read_nfa{read_nfa_binary(stream, &read_alphabet)};
+		CHECK(read_nfa.is_identical(nfa));
+		CHECK(read_alphabet.get_symbol_map() == alphabet.get_symbol_map());
+	}
+
+	SECTION("invalid input") {
+		std::stringstream stream{};
+		write_binary(nfa, stream);
+		const std::string binary{stream.str()};
+
+		CHECK_THROWS_AS(read_nfa_binary(to_bytes("not an automaton")), std::runtime_error);
+		CHECK_THROWS_AS(read_nft_binary(to_bytes(binary)), std::runtime_error);
+		for (const size_t size : { size_t{0}, size_t{12}, size_t{40}, binary.size() - 1 }) {
+			CHECK_THROWS_AS(read_nfa_binary(to_bytes(binary.substr(0, size))), std::runtime_error);
+		}
+		// Rewrite the last target to a state out of range.
+		std::string corrupted{binary};
+		corrupted[corrupted.size() - 8] = 42;
+		CHECK_THROWS_AS(read_nfa_binary(to_bytes(corrupted)), std::runtime_error);
+		CHECK_THROWS_AS(read_nfa_binary(std::filesystem::path{"nonexistent-mata-binary-file"}), std::runtime_error);
+	}
+}
+
+TEST_CASE("mata::parser::write_binary() and read_nft_binary()") {
+	Nft nft{Nft::with_levels(mata::nft::Levels(3, { 0, 1, 2, 0 }), 4, { 0 }, { 3 })};
+	nft.delta.add(0, 'a', 1);
+	nft.delta.add(1, 'b', 2);
+	nft.delta.add(2, 'c', 3);
+	nft.delta.add(3, mata::nft::DONT_CARE, 3);
+
+	std::stringstream stream{};
+	write_binary(nft, stream);
+	const Nft read_nft{read_nft_binary(stream)};
+	CHECK(read_nft.is_identical(nft));
+	CHECK(read_nft.levels.num_of_levels == 3);
+	CHECK(read_nft.levels == nft.levels);
+	CHECK_THROWS_AS(read_nfa_binary(to_bytes(stream.str())), std::runtime_error);
+}
@@ -0,0 +1,117 @@
+/* budget.cc -- Tests for the budgets of the long-running operations
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/nft/nft.hh"
+#include "mata/parser/re2parser.hh"
+#include "mata/utils/budget.hh"
+
+using namespace mata::nfa;
+using mata::utils::Budget;
+using mata::utils::BudgetExhausted;
+using mata::utils::BudgetScope;
+
+namespace {
+template<class Operation>
+std::optional<BudgetExhausted::Reason> run_exhausting(Operation operation) {
+    try {
+        operation();
+    } catch (const BudgetExhausted& exception) {
+        return exception.reason;
+    }
+    return std::nullopt;
+}
+} // namespace
+
+TEST_CASE("mata::utils::Budget") {
+    // The determinization has 2^11 states.
+    const Nfa aut{ mata::parser::create_nfa("(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)") };
+    const Nfa other{ mata::parser::create_nfa("(a|b)*") };
+
+    SECTION("operations without a budget") {
+        CHECK(Budget::get_active() == nullptr);
+        CHECK(determinize(aut).num_of_states() == 2048);
+    }
+
+    SECTION("unexhausted budget") {
+        Budget budget{};
+        budget.set_timeout(std::chrono::hours{ 1 }).set_max_states(10'000);
+        const BudgetScope scope{ budget };
+        CHECK(determinize(aut).num_of_states() == 2048);
+        CHECK(is_included(aut, other));
+        CHECK(!aut.is_universal(mata::EnumAlphabet{ 'a', 'b' }));
+    }
+
+    SECTION("cancelled budget") {
+        Budget budget{};
+        budget.cancel();
+        CHECK(budget.is_cancelled());
+        const BudgetScope scope{ budget };
+        CHECK(run_exhausting([&] { determinize(aut); }) == BudgetExhausted::Reason::Cancelled);
+        CHECK(run_exhausting([&] { is_included(aut, other); }) == BudgetExhausted::Reason::Cancelled);
+        CHECK(run_exhausting([&] { intersection(aut, other); }) == BudgetExhausted::Reason::Cancelled);
+        CHECK(run_exhausting([&] { is_included_many(other, { &aut, &other }); }) == BudgetExhausted::Reason::Cancelled);
+        mata::nft::Nft nft{ mata::nft::Nft::with_levels({ 2, { 0 } }, 1, { 0 }, { 0 }) };
+        nft.insert_identity(0, std::vector<mata::Symbol>{ 'a', 'b' });
+        CHECK(run_exhausting([&] { mata::nft::compose(nft, nft, 1, 0); }) == BudgetExhausted::Reason::Cancelled);
+    }
+
+    SECTION("limit on states") {
+        Budget budget{};
+        budget.set_max_states(100);
+        const BudgetScope scope{ budget };
+        CHECK(run_exhausting([&] { determinize(aut); }) == BudgetExhausted::Reason::States);
+        CHECK(run_exhausting([&] { minimize(aut); }) == BudgetExhausted::Reason::States);
+        CHECK(!run_exhausting([&] { determinize(other); }).has_value());
+    }
+
+    SECTION("limit on states bounds the antichain") {
+        // Each macrostate {i, ..., 200} replaces its superset in the antichain, so the antichain stays small even
+        //  though 200 macrostates are created.
+        Nfa shrinking{ 201 };
+        for (mata::nfa::State state{ 0 }; state <= 200; ++state) {
+            shrinking.initial.insert(state);
+            shrinking.final.insert(state);
+            shrinking.delta.add(state, 'a', std::min<mata::nfa::State>(state + 1, 200));
+        }
+        Nfa loop{ 1, { 0 }, { 0 } };
+        loop.delta.add(0, 'a', 0);
+        Budget budget{};
+        budget.set_max_states(100);
+        const BudgetScope scope{ budget };
+        CHECK(shrinking.is_universal(mata::EnumAlphabet{ 'a' }));
+        CHECK(is_included(loop, shrinking));
+    }
+
+    SECTION("deadline") {
+        Budget budget{};
+        budget.set_deadline(std::chrono::steady_clock::now() - std::chrono::seconds{ 1 });
+        CHECK_THROWS_AS(budget.check(), BudgetExhausted);
+        const BudgetScope scope{ budget };
+        CHECK(run_exhausting([&] { determinize(aut); }) == BudgetExhausted::Reason::Deadline);
+    }
+
+    SECTION("limit on memory") {
+        Budget budget{};
+        budget.set_max_memory(1);
+        if (Budget::get_resident_memory() > 0) {
+            CHECK(run_exhausting([&] { budget.check(); }) == BudgetExhausted::Reason::Memory);
+        }
+    }
+
+    SECTION("nested scopes") {
+        Budget outer{};
+        Budget inner{};
+        inner.cancel();
+        const BudgetScope outer_scope{ outer };
+        {
+            const BudgetScope inner_scope{ inner };
+            CHECK(Budget::get_active() == &inner);
+            CHECK_THROWS_AS(determinize(aut), BudgetExhausted);
+        }
+        CHECK(Budget::get_active() == &outer);
+        CHECK(determinize(aut).num_of_states() == 2048);
+    }
+}
@@ -2,6 +2,9 @@
  * @brief Tests for mintermization.
  */
 
+#include <algorithm>
+#include <set>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -128,8 +131,95 @@ TEST_CASE("mata::Mintermization::compute_minterms")
         auto res = mintermization.compute_minterms(bdds);
         REQUIRE(res.size() == 3);
     }
+
+    SECTION("Minterm from trans with negated and constant predicates")
+    {
+        std::string file =
+                "@NFA-bits\n"
+                "%States-enum q r\n"
+                "%Alphabet-auto\n"
+                "%Initial q\n"
+                "%Final r\n"
+                "q (a1 | a2) r\n"
+                "q (!a1 & !a2) r\n"
+                "q \\true r\n"
+                "q a3 r\n";
+
+        parsed = parse_mf(file);
+        std::vector<mata::IntermediateAut> auts = mata::IntermediateAut::parse_from_mf(parsed);
+        const auto& aut= auts[0];
+        std::unordered_set<BDD> bdds;
+        for (const auto& transition : aut.transitions) {
+            bdds.insert(mintermization.graph_to_bdd_nfa(transition.second.children[0]));
+        }
+        REQUIRE(bdds.size() == 4);
+        auto res = mintermization.compute_minterms(bdds);
+        REQUIRE(res.size() == 4);
+        BDD all_minterms{ res.begin()->Xor(*res.begin()) };
+        for (const BDD& minterm : res) {
+            CHECK(!minterm.IsZero());
+            CHECK((all_minterms * minterm).IsZero());
+            all_minterms += minterm;
+        }
+        CHECK(all_minterms.IsOne());
+    }
 } // compute_minterms
 
+TEST_CASE("mata::Mintermization::mintermize_incrementally") {
+    mata::Mintermization mintermization{};
+    std::vector<mata::IntermediateAut> first_auts = mata::IntermediateAut::parse_from_mf(parse_mf(
+        "@NFA-bits\n"
+        "%States-enum q r\n"
+        "%Alphabet-auto\n"
+        "%Initial q\n"
+        "%Final r\n"
+        "q (a1 | a2) r\n"
+        "r !a1 q\n"
+    ));
+    const auto first_res = mintermization.mintermize_incrementally({ &first_auts[0] });
+    const size_t num_of_first_minterms{ mintermization.get_minterms().size() };
+    CHECK(num_of_first_minterms == 3);
+    REQUIRE(first_res.size() == 1);
+    CHECK(first_res[0].transitions.size() == 4);
+
+    SECTION("known predicates do not refine the minterms") {
+        std::vector<mata::IntermediateAut> second_auts = mata::IntermediateAut::parse_from_mf(parse_mf(
+            "@NFA-bits\n"
+            "%States-enum s\n"
+            "%Alphabet-auto\n"
+            "%Initial s\n"
+            "%Final s\n"
+            "s a1 s\n"
+        ));
+        const auto second_res = mintermization.mintermize_incrementally({ &second_auts[0] });
+        CHECK(mintermization.get_minterms().size() == num_of_first_minterms);
+        CHECK(second_res[0].transitions.size() == 1);
+    }
+
+    SECTION("new predicates refine the minterms") {
+        const std::vector<BDD> first_minterms{ mintermization.get_minterms() };
+        std::vector<mata::IntermediateAut> second_auts = mata::IntermediateAut::parse_from_mf(parse_mf(
+            "@NFA-bits\n"
+            "%States-enum s\n"
+            "%Alphabet-auto\n"
+            "%Initial s\n"
+            "%Final s\n"
+            "s a3 s\n"
+        ));
+        const auto second_res = mintermization.mintermize_incrementally({ &second_auts[0] });
+        const std::vector<BDD>& minterms{ mintermization.get_minterms() };
+        REQUIRE(minterms.size() == 2 * num_of_first_minterms);
+        CHECK(second_res[0].transitions.size() == num_of_first_minterms);
+
+        const std::vector<size_t> origins{ mintermization.get_minterm_origins(num_of_first_minterms) };
+        REQUIRE(origins.size() == minterms.size());
+        for (size_t minterm{ 0 }; minterm < minterms.size(); ++minterm) {
+            CHECK(minterms[minterm].Leq(first_minterms[origins[minterm]]));
+            if (minterm < num_of_first_minterms) { CHECK(origins[minterm] == minterm); }
+        }
+    }
+}
+
 TEST_CASE("mata::Mintermization::mintermization") {
     Parsed parsed;
     mata::Mintermization mintermization{};
@@ -233,4 +323,56 @@ TEST_CASE("mata::Mintermization::mintermization") {
         REQUIRE(res[1].transitions[0].second.children[1].node.name == "r");
         REQUIRE(res[1].transitions[1].second.children[1].node.name == "r");
     }
+
+    SECTION("Mintermization NFA multiple in parallel") {
+        Parsed parsed;
+        std::string file =
+                "@NFA-bits\n"
+                "%States-enum q r s t\n"
+                "%Alphabet-auto\n"
+                "%Initial q\n"
+                "%Final q | r\n"
+                "q (a1 | a2) r\n"
+                "s (a3 & a4) t\n"
+                "@NFA-bits\n"
+                "%States-enum q r\n"
+                "%Alphabet-auto\n"
+                "%Initial q\n"
+                "%Final q | r\n"
+                "q (a1 & a4) r\n"
+                "@NFA-bits\n"
+                "%States-enum q r\n"
+                "%Alphabet-auto\n"
+                "%Initial q\n"
+                "%Final r\n"
+                "q (!a4 & a5) r\n"
+                "r \\false q\n";
+
+        parsed = parse_mf(file);
+        std::vector<mata::IntermediateAut> auts = mata::IntermediateAut::parse_from_mf(parsed);
+
+        mata::Mintermization sequential_mintermization{};
+        const auto sequential_res = sequential_mintermization.mintermize(auts);
+        for (const size_t num_of_threads : { 2u, 3u, 8u }) {
+            mata::Mintermization mintermization{};
+            const auto res = mintermization.mintermize(auts, num_of_threads);
+            REQUIRE(res.size() == 3);
+            for (size_t index{ 0 }; index < res.size(); ++index) {
+                CHECK(res[index].alphabet_type == mata::IntermediateAut::AlphabetType::Explicit);
+                CHECK(res[index].transitions.size() == sequential_res[index].transitions.size());
+            }
+            CHECK(res[2].transitions.size() != 0);
+
+            // Transitions of different automata over the same bitvectors share the same minterms.
+            std::set<std::string> symbols_q_r_first{};
+            std::set<std::string> symbols_q_r_second{};
+            for (const auto& transition : res[0].transitions) {
+                if (transition.first.name == "q") { symbols_q_r_first.insert(transition.second.children[0].node.name); }
+            }
+            for (const auto& transition : res[1].transitions) {
+                symbols_q_r_second.insert(transition.second.children[0].node.name);
+            }
+            CHECK(std::ranges::includes(symbols_q_r_first, symbols_q_r_second));
+        }
+    }
 } // TEST_CASE("mata::Mintermization::mintermization")
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <sstream>
 #include <unordered_set>
 
 #include <catch2/catch_test_macros.hpp>
@@ -17,6 +18,19 @@ using OnTheFlyAlphabet = mata::OnTheFlyAlphabet;
 
 using Word = std::vector<Symbol>;
 
+namespace {
+/// Stream buffer over a string which does not support seeking, such as the one of a pipe.
+class UnseekableBuffer : public std::streambuf {
+public:
+    explicit UnseekableBuffer(std::string content) : content_{ std::move(content) } {
+        setg(content_.data(), content_.data(), content_.data() + content_.size());
+    }
+
+private:
+    std::string content_;
+};
+} // namespace
+
 TEST_CASE("parse_from_mata()") {
     Delta delta;
 
@@ -143,6 +157,178 @@ TEST_CASE("parse_from_mata()") {
     }
 }
 
+TEST_CASE("mata::nfa::builder::parse_from_mata_explicit()") {
+    using mata::nfa::builder::parse_from_mata_explicit;
+
+    SECTION("plain explicit NFA") {
+        const std::string nfa_in_mata{
+            "# comment\n"
+            "@NFA-explicit\n"
+            "%Alphabet-auto\n"
+            "%Initial q1 init\n"
+            "%Final q3   q4 # final states\n"
+            "q1 0 q2\r\n"
+            "q2\t1 q3\n"
+            "\n"
+            "init 1 q3\n"
+            "q1 2 q2\n"
+            "q1 0 q2\n"
+            "q1 0 init\n"
+        };
+        mata::nfa::builder::NameStateMap state_map{};
+        const std::optional<Nfa> parsed{ parse_from_mata_explicit(nfa_in_mata, &state_map) };
+        REQUIRE(parsed.has_value());
+        CHECK(state_map == mata::nfa::builder::NameStateMap{ { "q1", 0 }, { "init", 1 }, { "q3", 2 }, { "q4", 3 }, { "q2", 4 } });
+        CHECK(parsed->num_of_states() == 5);
+        CHECK(parsed->initial.size() == 2);
+        CHECK((parsed->initial.contains(0) && parsed->initial.contains(1)));
+        CHECK(parsed->final.size() == 2);
+        CHECK((parsed->final.contains(2) && parsed->final.contains(3)));
+        CHECK(parsed->delta.num_of_transitions() == 5);
+        CHECK(parsed->delta.contains(0, 0, 4));
+        CHECK(parsed->delta.contains(0, 0, 1));
+        CHECK(parsed->delta.contains(0, 2, 4));
+        CHECK(parsed->delta.contains(4, 1, 2));
+        CHECK(parsed->delta.contains(1, 1, 2));
+        CHECK(parsed->is_in_lang(Word{ 0, 1 }));
+        CHECK(parsed->is_in_lang(Word{ 1 }));
+        CHECK(!parsed->is_in_lang(Word{ 2 }));
+    }
+
+    SECTION("numbering of states differs from the generic parser only by renaming") {
+        const std::string nfa_in_mata{
+            "@NFA-explicit\n%Alphabet-auto\n%Initial s2 s0 s1\n%Final s4 s0\ns3 0 s2\ns0 1 s3\ns4 0 s4\ns1 1 s4\n"
+        };
+        mata::nfa::builder::NameStateMap fast_state_map{};
+        const std::optional<Nfa> fast{ parse_from_mata_explicit(nfa_in_mata, &fast_state_map) };
+        REQUIRE(fast.has_value());
+        // The fast path numbers the states in the order of their first occurrence.
+        CHECK(fast_state_map == mata::nfa::builder::NameStateMap{ { "s2", 0 }, { "s0", 1 }, { "s1", 2 }, { "s4", 3 }, { "s3", 4 } });
+
+        mata::nfa::builder::NameStateMap generic_state_map{};
+        IntAlphabet alphabet{};
+        const Nfa generic{ mata::nfa::builder::construct(
+            mata::IntermediateAut::parse_from_mf(mata::parser::parse_mf(nfa_in_mata))[0], &alphabet, &generic_state_map) };
+        REQUIRE(generic_state_map.size() == fast_state_map.size());
+        std::vector<State> renaming(generic.num_of_states());
+        for (const auto& [name, state]: generic_state_map) { renaming[state] = fast_state_map.at(name); }
+        CHECK(fast->num_of_states() == generic.num_of_states());
+        CHECK(fast->delta.num_of_transitions() == generic.delta.num_of_transitions());
+        for (const Transition& transition: generic.delta.transitions()) {
+            CHECK(fast->delta.contains(renaming[transition.source], transition.symbol, renaming[transition.target]));
+        }
+        CHECK(fast->initial.size() == generic.initial.size());
+        for (const State state: generic.initial) { CHECK(fast->initial.contains(renaming[state])); }
+        CHECK(fast->final.size() == generic.final.size());
+        for (const State state: generic.final) { CHECK(fast->final.contains(renaming[state])); }
+    }
+
+    SECTION("streams are parsed line by line") {
+        const std::string plain{ "@NFA-explicit\n%Alphabet-auto\n%Initial q0\n%Final q1\nq0 0 q1\nq1 1 q1" };
+        const std::string formula{ "@NFA-explicit\n%Alphabet-auto\n%Initial q0\n%Final !q0\nq0 0 q1\nq1 1 q1\n" };
+        for (const std::string& nfa_in_mata: { plain, formula }) {
+            CAPTURE(nfa_in_mata);
+            std::istringstream seekable{ nfa_in_mata };
+            UnseekableBuffer buffer{ nfa_in_mata };
+            std::istream unseekable{ &buffer };
+            REQUIRE(unseekable.tellg() == std::istream::pos_type(-1));
+            for (std::istream* nfa_stream: { static_cast<std::istream*>(&seekable), &unseekable }) {
+                const Nfa parsed{ mata::nfa::builder::parse_from_mata(*nfa_stream) };
+                CHECK(parsed.num_of_states() == 2);
+                CHECK(parsed.is_in_lang(Word{ 0, 1, 1 }));
+                CHECK(!parsed.is_in_lang(Word{}));
+            }
+        }
+        UnseekableBuffer buffer{ "@NFA-explicit\n%Initial q0\nq0 a q1\n" };
+        std::istream invalid{ &buffer };
+        CHECK_THROWS_AS(mata::nfa::builder::parse_from_mata(invalid), std::runtime_error);
+    }
+
+    SECTION("round trip of printed automaton") {
+        Nfa nfa{ mata::nfa::builder::create_random_nfa_tabakov_vardi(50, 5, 3, 0.3, 42) };
+        nfa.alphabet = nullptr;
+        const std::optional<Nfa> parsed{ parse_from_mata_explicit(nfa.print_to_mata()) };
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->delta.num_of_transitions() == nfa.delta.num_of_transitions());
+        CHECK(are_equivalent(*parsed, nfa));
+    }
+
+    SECTION("unsupported input falls back to the generic parser") {
+        const std::string formula_final{ "@NFA-explicit\n%Alphabet-auto\n%Initial q0\n%Final !q0\nq0 0 q1\n" };
+        CHECK(!parse_from_mata_explicit(formula_final).has_value());
+        const Nfa parsed{ mata::nfa::builder::parse_from_mata(formula_final) };
+        CHECK(parsed.final.size() == 1);
+        CHECK(parsed.is_in_lang(Word{ 0 }));
+
+        CHECK(!parse_from_mata_explicit("@NFA-bits\n%Alphabet-auto\n%Initial q0\n%Final q0\n").has_value());
+        CHECK(!parse_from_mata_explicit("@NFA-explicit\n%Alphabet-auto\n%Initial q0\nq0 a q1\n").has_value());
+        CHECK(!parse_from_mata_explicit("@NFA-explicit\n%Alphabet-auto\n%Initial \"q 0\"\n").has_value());
+        CHECK(!parse_from_mata_explicit("@NFA-explicit\n%Initial q0\nq0 0\n").has_value());
+        CHECK(!parse_from_mata_explicit("@NFA-explicit\n%Initial q0\n@NFA-explicit\n").has_value());
+        CHECK(!parse_from_mata_explicit("").has_value());
+        CHECK_THROWS_AS(mata::nfa::builder::parse_from_mata(std::string{ "@NFA-explicit\n%Initial q0\nq0 a q1\n" }), std::runtime_error);
+    }
+}
+
+TEST_CASE("mata::nfa::builder::load_automata()") {
+    const std::vector<std::string> contents{
+        "@NFA-bits\n%States-enum q r\n%Alphabet-auto\n%Initial q\n%Final r\nq (a1 | a2) r\nr (!a1 & a3) q\n",
+        "@NFA-explicit\n%Alphabet-auto\n%Initial p\n%Final p\np x p\np y s\n",
+        "@NFA-bits\n%States-enum q r\n%Alphabet-auto\n%Initial q\n%Final r\nq (a1 & a3) r\n",
+        "@NFA-bits\n%States-enum q\n%Alphabet-auto\n%Initial q\n%Final q\nq \\true q\n",
+        "@NFA-explicit\n%Alphabet-auto\n%Initial p\n%Final s\np 2 s\ns 007 s\n",
+    };
+    std::vector<std::filesystem::path> nfa_files{};
+    for (size_t index{ 0 }; index < contents.size(); ++index) {
+        nfa_files.emplace_back("./temp-test-load_automata-" + std::to_string(index) + ".mata");
+        std::ofstream{ nfa_files.back() } << contents[index];
+    }
+
+    for (const size_t num_of_threads : { 1u, 2u, 4u }) {
+        OnTheFlyAlphabet alphabet{};
+        const std::vector<Nfa> nfas{ mata::nfa::builder::load_automata(nfa_files, alphabet, num_of_threads) };
+        REQUIRE(nfas.size() == 5);
+        CHECK(alphabet.get_symbol_map().contains("x"));
+        CHECK(alphabet.get_symbol_map().contains("y"));
+        CHECK(nfas[1].num_of_states() == 2);
+        CHECK(nfas[1].is_in_lang(Word{ alphabet.translate_symb("x") }));
+
+        // Over the minterms of a1, a2, a3, 'true' contains all of them, the third automaton is included in the first.
+        const mata::utils::OrdVector<Symbol> minterm_symbols{ nfas[3].delta.get_used_symbols() };
+        for (const size_t index : { 0u, 2u }) {
+            for (const Symbol symbol : nfas[index].delta.get_used_symbols()) { CHECK(minterm_symbols.contains(symbol)); }
+        }
+        CHECK(is_included(nfas[2], nfas[0]));
+        CHECK(!is_included(nfas[0], nfas[2]));
+
+        // Numeric symbols of explicit automata do not clash with the minterms, keep their names, and are added in the
+        //  order of their occurrence.
+        CHECK(alphabet.get_symbol_map().contains("minterm:0"));
+        CHECK(alphabet.get_symbol_map().contains("007"));
+        CHECK(!alphabet.get_symbol_map().contains("7"));
+        CHECK(alphabet.get_symbol_map().at("x") < alphabet.get_symbol_map().at("2"));
+        CHECK(alphabet.get_symbol_map().at("2") < alphabet.get_symbol_map().at("007"));
+        const Word two_seven{ alphabet.translate_symb("2"), alphabet.translate_symb("007") };
+        CHECK(nfas[4].is_in_lang(two_seven));
+        CHECK(!nfas[3].is_in_lang(two_seven));
+    }
+
+    {
+        const std::filesystem::path clashing_file{ "./temp-test-load_automata-clashing.mata" };
+        std::ofstream{ clashing_file } << "@NFA-explicit\n%Alphabet-auto\n%Initial p\n%Final p\np minterm:0 p\n";
+        OnTheFlyAlphabet alphabet{};
+        CHECK_THROWS_AS(
+            mata::nfa::builder::load_automata({ nfa_files[0], clashing_file }, alphabet, 2), std::runtime_error
+        );
+        std::filesystem::remove(clashing_file);
+    }
+
+    nfa_files.emplace_back("./temp-test-load_automata-nonexistent.mata");
+    OnTheFlyAlphabet alphabet{};
+    CHECK_THROWS_AS(mata::nfa::builder::load_automata(nfa_files, alphabet, 2), std::runtime_error);
+    for (const std::filesystem::path& nfa_file : nfa_files) { std::filesystem::remove(nfa_file); }
+}
+
 TEST_CASE("Create Tabakov-Vardi NFA") {
     size_t num_of_states;
     size_t alphabet_size;
@@ -298,3 +484,52 @@ TEST_CASE("Create Tabakov-Vardi NFA") {
         CHECK(!nfa1_2.is_identical(nfa2));
     }
 }
+
+TEST_CASE("Create large sparse Tabakov-Vardi NFA") {
+    // The transitions are sampled without materializing all num_of_states^2 possible transitions.
+    const Nfa nfa{ mata::nfa::builder::create_random_nfa_tabakov_vardi(200'000, 2, 1.5, 0.1, 7) };
+    CHECK(nfa.num_of_states() == 200'000);
+    CHECK(nfa.final.size() == 20'000);
+    CHECK(nfa.delta.num_of_transitions() == 600'000);
+    CHECK(nfa.is_identical(mata::nfa::builder::create_random_nfa_tabakov_vardi(200'000, 2, 1.5, 0.1, 7)));
+}
+
+TEST_CASE("mata::nfa::builder::create_nth_from_last_nfa()") {
+    const Nfa nfa{ mata::nfa::builder::create_nth_from_last_nfa(6, 2, 1) };
+    CHECK(nfa.num_of_states() == 7);
+    CHECK(nfa.is_in_lang(Word{ 1, 0, 0, 0, 0, 0 }));
+    CHECK(nfa.is_in_lang(Word{ 0, 0, 1, 1, 0, 1, 1, 0 }));
+    CHECK(!nfa.is_in_lang(Word{ 0, 1, 1, 1, 1, 1 }));
+    CHECK(!nfa.is_in_lang(Word{ 1, 1, 1, 1, 1 }));
+    CHECK(minimize(nfa).num_of_states() == 64);
+
+    CHECK_THROWS_AS(mata::nfa::builder::create_nth_from_last_nfa(0), std::runtime_error);
+    CHECK_THROWS_AS(mata::nfa::builder::create_nth_from_last_nfa(3, 2, 2), std::runtime_error);
+}
+
+TEST_CASE("mata::nfa::builder::create_hard_inclusion_pair()") {
+    for (const size_t alphabet_size: { 1u, 2u, 3u }) {
+        const auto [smaller, bigger]{ mata::nfa::builder::create_hard_inclusion_pair(4, alphabet_size) };
+        CHECK(is_included(smaller, bigger));
+        CHECK(is_included(bigger, smaller));
+
+        const auto [not_smaller, same_bigger]{
+            mata::nfa::builder::create_hard_inclusion_pair(4, alphabet_size, false)
+        };
+        Run cex{};
+        CHECK(!is_included(not_smaller, same_bigger, &cex));
+        CHECK(cex.word.size() == 3);
+    }
+}
+
+TEST_CASE("mata::nfa::builder::create_epsilon_chain_nfa()") {
+    const Nfa nfa{ mata::nfa::builder::create_epsilon_chain_nfa(100, 3, 5) };
+    CHECK(nfa.num_of_states() == 100);
+    CHECK(nfa.delta.num_of_transitions() <= 199);
+    CHECK(nfa.is_identical(mata::nfa::builder::create_epsilon_chain_nfa(100, 3, 5)));
+    for (State state{ 0 }; state + 1 < 100; ++state) { CHECK(nfa.delta.contains(state, mata::nfa::EPSILON, state + 1)); }
+    // All states are in the epsilon closure of the initial state.
+    const Nfa without_epsilon{ remove_epsilon(nfa) };
+    CHECK(without_epsilon.final.contains(0));
+    CHECK(without_epsilon.is_in_lang(Word{}));
+}
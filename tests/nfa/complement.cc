@@ -0,0 +1,106 @@
+/* complement.cc -- Tests for implicitly complete complements of NFAs
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/complement.hh"
+#include "mata/nfa/nfa.hh"
+#include "mata/parser/re2parser.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+using mata::Word;
+using mata::utils::OrdVector;
+
+TEST_CASE("mata::nfa::complement_implicit()") {
+    const OrdVector<Symbol> symbols{ 'a', 'b', 'c' };
+
+    SECTION("agrees with complement()") {
+        for (const char* const regex: { "(a|b)*a(a|b)", "abc", "(a|b|c)*", "", "a*b*c*", "(ab)*|c" }) {
+            const Nfa aut{ mata::parser::create_nfa(regex) };
+            const ImplicitComplement implicit{ complement_implicit(aut, symbols) };
+            const Nfa expected{ complement(aut, symbols) };
+            CHECK(implicit.dfa.is_deterministic());
+            CHECK(are_equivalent(implicit.to_nfa(), expected));
+            CHECK(implicit.dfa.delta.num_of_transitions() <= expected.delta.num_of_transitions());
+
+            Run cex{};
+            CHECK(implicit.is_lang_empty(&cex) == expected.is_lang_empty());
+            if (!expected.is_lang_empty()) {
+                CHECK(implicit.is_in_lang(cex));
+                CHECK(expected.is_in_lang(cex));
+                CHECK(!aut.is_in_lang(cex));
+            }
+            for (const mata::Word& word: { mata::Word{}, mata::Word{ 'a' }, mata::Word{ 'a', 'b', 'c' },
+                                           mata::Word{ 'c', 'c', 'a' }, mata::Word{ 'a', 'd' } }) {
+                CHECK(implicit.is_in_lang(Run{ word, {} }) == expected.is_in_lang(Run{ word, {} }));
+            }
+        }
+    }
+
+    SECTION("empty automaton") {
+        const ImplicitComplement implicit{ complement_implicit(Nfa{ 2, { 0 }, {} }, symbols) };
+        CHECK(implicit.dfa.num_of_states() == 1);
+        CHECK(implicit.dfa.delta.empty());
+        CHECK(implicit.is_in_lang(Run{ { 'a', 'b' }, {} }));
+        CHECK(!implicit.is_in_lang(Run{ { 'a', 'd' }, {} }));
+    }
+
+    SECTION("large alphabet") {
+        OrdVector<Symbol> large_symbols{};
+        for (Symbol symbol{ 0 }; symbol < 10'000; ++symbol) { large_symbols.push_back(symbol); }
+        const Nfa aut{ mata::parser::create_nfa("ab*") };
+        const ImplicitComplement implicit{ complement_implicit(aut, large_symbols) };
+        CHECK(implicit.dfa.delta.num_of_transitions() == 2);
+        CHECK(implicit.is_in_lang(Run{ { 'a', 'b', 5'000 }, {} }));
+        CHECK(!implicit.is_in_lang(Run{ { 'a', 'b', 'b' }, {} }));
+        CHECK(!implicit.is_lang_empty());
+    }
+
+    SECTION("universal automaton") {
+        const ImplicitComplement implicit{ complement_implicit(mata::parser::create_nfa("(a|b|c)*"), symbols) };
+        Run cex{};
+        CHECK(implicit.is_lang_empty(&cex));
+        CHECK(!complement_implicit(mata::parser::create_nfa("(a|b)*"), symbols).is_lang_empty(&cex));
+        CHECK(cex.word == mata::Word{ 'c' });
+    }
+}
+
+TEST_CASE("mata::nfa::intersection() and is_included() with implicitly complete complements") {
+    const OrdVector<Symbol> symbols{ 'a', 'b', 'c' };
+    const std::vector<Nfa> automata{
+        mata::parser::create_nfa("(a|b)*a(a|b)"), mata::parser::create_nfa("a*b*"), mata::parser::create_nfa("abc"),
+        mata::parser::create_nfa("(a|b|c)*"), mata::parser::create_nfa("(ab)*|c"), mata::parser::create_nfa("ad*"),
+        mata::parser::create_nfa("ad"), mata::parser::create_nfa("c"),
+    };
+
+    for (const Nfa& lhs: automata) {
+        for (const Nfa& rhs: automata) {
+            const ImplicitComplement implicit{ complement_implicit(rhs, symbols) };
+            const Nfa materialized{ complement(rhs, symbols) };
+            CHECK(are_equivalent(intersection(lhs, implicit), intersection(lhs, materialized)));
+
+            Run cex{};
+            const bool included{ is_included(lhs, implicit, &cex) };
+            CHECK(included == is_included(lhs, materialized));
+            if (!included) {
+                CHECK(lhs.is_in_lang(cex));
+                CHECK(!implicit.is_in_lang(cex));
+                REQUIRE(cex.path.size() == cex.word.size() + 1);
+                CHECK(lhs.final.contains(cex.path.back()));
+            }
+        }
+    }
+}
+
+TEST_CASE("mata::nfa::is_included() leaving the implicit sink over a symbol outside the complement symbols") {
+    // The word "ad" enters the sink of the complement over 'a' and leaves the symbols of the complement over 'd'.
+    const Nfa smaller{ mata::parser::create_nfa("ad") };
+    const ImplicitComplement bigger{ complement_implicit(mata::parser::create_nfa("c"), { 'a', 'b', 'c' }) };
+    Run cex{};
+    CHECK(!is_included(smaller, bigger, &cex));
+    CHECK(cex.word == Word{ 'a', 'd' });
+    CHECK(!bigger.is_in_lang(cex));
+
+    CHECK(is_included(mata::parser::create_nfa("a(a|b)*"), bigger));
+}
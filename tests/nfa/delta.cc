@@ -469,6 +469,49 @@ TEST_CASE("mata::nfa::Delta::add_symbols_to()") {
     });
 }
 
+TEST_CASE("mata::nfa::Delta::add() and copy_transitions_to() with arrays") {
+    const std::vector<State> sources{ 3, 0, 0, 3, 0, 1, 0 };
+    const std::vector<Symbol> symbols{ 1, 2, 0, 1, 2, 1, 0 };
+    const std::vector<State> targets{ 0, 1, 5, 0, 0, 4, 2 };
+
+    Delta delta{};
+    delta.add(sources, symbols, targets);
+    Delta expected{};
+    for (size_t i{ 0 }; i < sources.size(); ++i) { expected.add(sources[i], symbols[i], targets[i]); }
+    CHECK(delta == expected);
+    CHECK(delta.num_of_states() == 6);
+    CHECK(delta.num_of_transitions() == 6);
+
+    SECTION("adding to an existing delta") {
+        delta.add(std::vector<State>{ 0, 2, 0 }, std::vector<Symbol>{ 1, 0, 2 }, std::vector<State>{ 3, 7, 3 });
+        expected.add(0, 1, 3);
+        expected.add(2, 0, 7);
+        expected.add(0, 2, 3);
+        CHECK(delta == expected);
+    }
+
+    SECTION("copying transitions") {
+        std::vector<State> copied_sources(delta.num_of_transitions());
+        std::vector<Symbol> copied_symbols(delta.num_of_transitions());
+        std::vector<State> copied_targets(delta.num_of_transitions());
+        delta.copy_transitions_to(copied_sources, copied_symbols, copied_targets);
+        CHECK(copied_sources == std::vector<State>{ 0, 0, 0, 0, 1, 3 });
+        CHECK(copied_symbols == std::vector<Symbol>{ 0, 0, 2, 2, 1, 1 });
+        CHECK(copied_targets == std::vector<State>{ 2, 5, 0, 1, 4, 0 });
+
+        std::vector<State> short_sources(delta.num_of_transitions() - 1);
+        CHECK_THROWS_AS(
+            delta.copy_transitions_to(short_sources, copied_symbols, copied_targets), std::invalid_argument
+        );
+    }
+
+    SECTION("arrays of different sizes") {
+        CHECK_THROWS_AS(
+            delta.add(std::vector<State>{ 0 }, std::vector<Symbol>{}, std::vector<State>{ 0 }), std::invalid_argument
+        );
+    }
+}
+
 TEST_CASE("Transition comparison") {
     Transition tr1 {1, 2, 3};
     Transition tr2 {1, 3, 1};
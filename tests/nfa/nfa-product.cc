@@ -6,6 +6,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include "mata/nfa/builder.hh"
 #include "mata/nfa/nfa.hh"
 
 using namespace mata::nfa;
@@ -271,6 +272,55 @@ TEST_CASE("mata::nfa::intersection() with preserving epsilon transitions")
     CHECK(result.delta.state_post(prod_map[{ 5, 8 }]).empty());
 }
 
+TEST_CASE("mata::nfa::product_parallel()")
+{
+    // Checks that the product is the same as the product computed sequentially, up to the numbering of the states.
+    auto check_same_product = [](const Nfa& lhs, const Nfa& rhs, const ProductFinalStateCondition final_condition,
+                                 const size_t num_of_threads, const bool deterministic_numbering) {
+        std::unordered_map<std::pair<State, State>, State> expected_map;
+        const Nfa expected{ product(lhs, rhs, final_condition, EPSILON, &expected_map) };
+        std::unordered_map<std::pair<State, State>, State> result_map;
+        const Nfa result{
+            product_parallel(lhs, rhs, final_condition, num_of_threads, deterministic_numbering, EPSILON, &result_map)
+        };
+        REQUIRE(result.num_of_states() == expected.num_of_states());
+        REQUIRE(result_map.size() == expected_map.size());
+        CHECK(result.delta.num_of_transitions() == expected.delta.num_of_transitions());
+        std::vector<State> renaming(expected.num_of_states());
+        for (const auto& [pair, state] : expected_map) {
+            REQUIRE(result_map.contains(pair));
+            renaming[state] = result_map.at(pair);
+        }
+        for (const Transition& transition : expected.delta.transitions()) {
+            CHECK(result.delta.contains(renaming[transition.source], transition.symbol, renaming[transition.target]));
+        }
+        for (const State state : expected.initial) { CHECK(result.initial.contains(renaming[state])); }
+        for (const State state : expected.final) { CHECK(result.final.contains(renaming[state])); }
+        CHECK(result.initial.size() == expected.initial.size());
+        CHECK(result.final.size() == expected.final.size());
+        return result;
+    };
+
+    for (unsigned seed{ 0 }; seed < 5; ++seed) {
+        Nfa lhs{ builder::create_random_nfa_tabakov_vardi(40, 3, 1.5, 0.3, seed) };
+        Nfa rhs{ builder::create_random_nfa_tabakov_vardi(40, 3, 1.5, 0.3, seed + 100) };
+        lhs.delta.add(1, EPSILON, 2);
+        rhs.delta.add(3, EPSILON, 4);
+        rhs.delta.add(5, EPSILON - 1, 6);
+        for (const ProductFinalStateCondition condition : { ProductFinalStateCondition::And,
+                                                            ProductFinalStateCondition::Or }) {
+            check_same_product(lhs, rhs, condition, 4, false);
+            const Nfa single_thread{ check_same_product(lhs, rhs, condition, 1, true) };
+            const Nfa multiple_threads{ check_same_product(lhs, rhs, condition, 4, true) };
+            CHECK(single_thread.is_identical(multiple_threads));
+        }
+    }
+
+    SECTION("empty automata") {
+        CHECK(product_parallel(Nfa{}, Nfa{ 1, { 0 }, { 0 } }).num_of_states() == 0);
+    }
+}
+
 TEST_CASE("mata::nfa::intersection() for profiling", "[.profiling],[intersection]")
 {
     Nfa a{6};
@@ -2,6 +2,7 @@
  * @brief Tests for Nondeterministic Finite Automata (NFAs).
  */
 
+#include <random>
 #include <unordered_set>
 
 #include <catch2/catch_test_macros.hpp>
@@ -986,6 +987,35 @@ TEST_CASE("mata::nfa::Nfa::is_in_lang()") {
     }
 }
 
+TEST_CASE("mata::nfa::is_in_lang_batch()") {
+    const Nfa aut{ builder::create_from_regex("(a|b)*ab") };
+    const std::vector<Word> words{ {}, { 'a', 'b' }, { 'b', 'a' }, { 'a', 'a', 'b' }, { 'c' }, { 'b', 'a', 'b' } };
+    for (const size_t num_of_threads: { 0u, 1u, 4u }) {
+        const BoolVector result{ is_in_lang_batch(aut, words, num_of_threads) };
+        REQUIRE(result.size() == words.size());
+        for (size_t i{ 0 }; i < words.size(); ++i) { CHECK(static_cast<bool>(result[i]) == aut.is_in_lang(words[i])); }
+    }
+    CHECK(is_in_lang_batch(aut, {}).empty());
+}
+
+TEST_CASE("mata::nfa::is_in_lang_batch() stress") {
+    // Many words read concurrently through the same automaton exercise the reentrancy of post().
+    const Nfa aut{ builder::create_random_nfa_tabakov_vardi(64, 4, 1.5, 0.5, 7) };
+    std::mt19937 generator{ 13 };
+    std::uniform_int_distribution<Symbol> symbol_distribution{ 0, 3 };
+    std::uniform_int_distribution<size_t> length_distribution{ 0, 32 };
+    std::vector<Word> words(4096);
+    for (Word& word: words) {
+        word.resize(length_distribution(generator));
+        for (Symbol& symbol: word) { symbol = symbol_distribution(generator); }
+    }
+    BoolVector expected(words.size(), false);
+    for (size_t i{ 0 }; i < words.size(); ++i) { expected[i] = aut.is_in_lang(words[i]); }
+    for (const size_t num_of_threads: { 2u, 8u, 16u }) {
+        CHECK(is_in_lang_batch(aut, words, num_of_threads) == expected);
+    }
+}
+
 TEST_CASE("mata::nfa::Nfa::is_in_lang_prefix()") {
     SECTION("without epsilon transitions") {
         SECTION("empty language") {
@@ -2223,6 +2253,91 @@ TEST_CASE("mata::nfa::is_universal()")
     }
 } // }}}
 
+TEST_CASE("mata::nfa::is_universal() with search strategies and threads") {
+    const std::vector<std::string> STRATEGIES{ "dfs", "bfs", "smallest-first" };
+
+    SECTION("random automata") {
+        const EnumAlphabet alphabet{ 0, 1, 2 };
+        for (unsigned seed{ 0 }; seed < 30; ++seed) {
+            const Nfa aut{ builder::create_random_nfa_tabakov_vardi(8, 3, 2.5, 0.6, seed) };
+            const bool expected{ aut.is_universal(alphabet, { { "algorithm", "naive" } }) };
+            for (const std::string& strategy : STRATEGIES) {
+                for (const std::string threads : { "1", "4" }) {
+                    Run cex{};
+                    const ParameterMap params{
+                        { "algorithm", "antichains" }, { "strategy", strategy }, { "threads", threads }
+                    };
+                    CHECK(aut.is_universal(alphabet, &cex, params) == expected);
+                    if (!expected) { CHECK(!aut.is_in_lang(cex.word)); }
+                }
+            }
+        }
+    }
+
+    SECTION("random automata over a big alphabet") {
+        // The rounds have enough posts to be computed on several threads.
+        constexpr Symbol ALPHABET_SIZE{ 1024 };
+        EnumAlphabet alphabet{};
+        for (Symbol symbol{ 0 }; symbol < ALPHABET_SIZE; ++symbol) { alphabet.add_new_symbol(symbol); }
+        for (unsigned seed{ 0 }; seed < 10; ++seed) {
+            const Nfa aut{ builder::create_random_nfa_tabakov_vardi(16, ALPHABET_SIZE, 3.0, 0.8, seed) };
+            for (const std::string& strategy : STRATEGIES) {
+                Run expected_cex{};
+                const bool expected{ aut.is_universal(
+                    alphabet, &expected_cex, { { "algorithm", "antichains" }, { "strategy", strategy } }) };
+                if (!expected) { CHECK(!aut.is_in_lang(expected_cex.word)); }
+                for (const std::string threads : { "2", "4", "8" }) {
+                    Run cex{};
+                    const ParameterMap params{
+                        { "algorithm", "antichains" }, { "strategy", strategy }, { "threads", threads }
+                    };
+                    CHECK(aut.is_universal(alphabet, &cex, params) == expected);
+                    if (!expected) { CHECK(cex.word == expected_cex.word); }
+                }
+            }
+        }
+    }
+
+    SECTION("huge alphabet") {
+        // The automaton accepts the words with at most n symbols after the last symbol 0.
+        constexpr Symbol ALPHABET_SIZE{ 2000 };
+        constexpr State N{ 3 };
+        EnumAlphabet alphabet{};
+        Nfa aut{ N + 1, { 0 }, { 0, 1, 2, 3 } };
+        for (Symbol symbol{ 0 }; symbol < ALPHABET_SIZE; ++symbol) {
+            alphabet.add_new_symbol(symbol);
+            aut.delta.add(0, symbol, 0);
+            for (State state{ 0 }; state < N; ++state) {
+                aut.delta.add(state, symbol, state + 1);
+                if (symbol == 0) { aut.delta.add(state + 1, symbol, 0); }
+            }
+        }
+        for (const std::string& strategy : STRATEGIES) {
+            for (const std::string threads : { "1", "0" }) {
+                const ParameterMap params{
+                    { "algorithm", "antichains" }, { "strategy", strategy }, { "threads", threads }
+                };
+                CHECK(aut.is_universal(alphabet, params));
+            }
+        }
+
+        alphabet.add_new_symbol(ALPHABET_SIZE);
+        for (const std::string threads : { "1", "0" }) {
+            Run cex{};
+            CHECK(!aut.is_universal(alphabet, &cex, { { "algorithm", "antichains" }, { "threads", threads } }));
+            CHECK(cex.word == Word{ ALPHABET_SIZE });
+        }
+    }
+
+    SECTION("wrong strategy") {
+        const Nfa aut{ 1, { 0 }, { 0 } };
+        CHECK_THROWS_WITH(
+            aut.is_universal(EnumAlphabet{ 0 }, { { "algorithm", "antichains" }, { "strategy", "foo" } }),
+            Catch::Matchers::ContainsSubstring("unknown value of the \"strategy\" key")
+        );
+    }
+}
+
 TEST_CASE("mata::nfa::is_included()")
 { // {{{
     Nfa smaller(10);
@@ -2560,6 +2675,31 @@ q10 67 q5
     }
 } // }}}
 
+TEST_CASE("mata::nfa::is_included_many()") {
+    const Nfa bigger{ builder::create_from_regex("(a|b)*a") };
+    std::vector<Nfa> automata{};
+    for (const char* const regex: { "a", "ba", "b", "(ab)*", "(b|a)*(aa)", "" }) {
+        automata.push_back(builder::create_from_regex(regex));
+    }
+    std::vector<const Nfa*> smaller{};
+    for (const Nfa& aut: automata) { smaller.push_back(&aut); }
+
+    for (const size_t num_of_threads: { 0u, 1u, 3u }) {
+        for (const std::string algorithm: { "naive", "antichains" }) {
+            const BoolVector result{
+                is_included_many(bigger, smaller, nullptr, { { "algorithm", algorithm } }, num_of_threads)
+            };
+            REQUIRE(result.size() == automata.size());
+            for (size_t i{ 0 }; i < automata.size(); ++i) {
+                CHECK(static_cast<bool>(result[i]) == is_included(automata[i], bigger));
+            }
+        }
+    }
+    CHECK(is_included_many(bigger, {}).empty());
+    CHECK_THROWS_WITH(is_included_many(bigger, smaller, nullptr, { { "algorithm", "foo" } }),
+                      Catch::Matchers::ContainsSubstring("received an unknown value"));
+}
+
 TEST_CASE("mata::nfa::are_equivalent")
 {
     Nfa smaller(10);
@@ -3780,6 +3920,64 @@ TEST_CASE("mata::nfa::remove_epsilon()")
     REQUIRE(aut.delta.contains(5, 'a', 9));
 }
 
+TEST_CASE("mata::nfa::remove_epsilon() with multiple epsilons")
+{
+    Nfa aut{6};
+    aut.initial = { 0 };
+    aut.final = { 5 };
+    // Epsilon cycle 1 -> 2 -> 3 -> 1 over two epsilon symbols.
+    aut.delta.add(0, 'e', 1);
+    aut.delta.add(1, 'f', 2);
+    aut.delta.add(2, 'e', 3);
+    aut.delta.add(3, 'f', 1);
+    aut.delta.add(1, 'a', 4);
+    aut.delta.add(3, 'b', 4);
+    aut.delta.add(2, 'a', 0);
+    aut.delta.add(4, 'e', 5);
+    const mata::utils::OrdVector<Symbol> epsilons{ 'e', 'f' };
+
+    SECTION("closure before transitions") {
+        const Nfa result{ remove_epsilon(aut, epsilons, EpsilonClosureOpt::Before) };
+        for (const State state: { 0u, 1u, 2u, 3u }) {
+            CHECK(result.delta.contains(state, 'a', 4));
+            CHECK(result.delta.contains(state, 'a', 0));
+            CHECK(result.delta.contains(state, 'b', 4));
+        }
+        CHECK(result.final.contains(4));
+        CHECK(result.final.contains(5));
+        CHECK(!result.final.contains(0));
+        CHECK(result.initial.size() == 1);
+        CHECK(result.initial.contains(0));
+        CHECK(result.delta.num_of_transitions() == 12);
+        CHECK(result.delta.get_used_symbols() == mata::utils::OrdVector<Symbol>{ 'a', 'b' });
+    }
+
+    SECTION("closure after transitions") {
+        const Nfa result{ remove_epsilon(aut, epsilons, EpsilonClosureOpt::After) };
+        CHECK(result.initial.size() == 4);
+        CHECK(result.delta.contains(1, 'a', 4));
+        CHECK(result.delta.contains(1, 'a', 5));
+        CHECK(result.delta.contains(2, 'a', 3));
+        CHECK(!result.delta.contains(0, 'a', 4));
+        CHECK(result.final.size() == 1);
+        CHECK(result.delta.get_used_symbols() == mata::utils::OrdVector<Symbol>{ 'a', 'b' });
+        CHECK(are_equivalent(result, remove_epsilon(aut, epsilons, EpsilonClosureOpt::Before)));
+    }
+
+    SECTION("single epsilon is equivalent to the general version") {
+        aut.delta.add(0, 'f', 5);
+        const Nfa result{ remove_epsilon(aut, 'e') };
+        CHECK(result.delta.contains(0, 'f', 5));
+        CHECK(result.delta.contains(0, 'f', 2));
+        CHECK(result.is_identical(remove_epsilon(aut, mata::utils::OrdVector<Symbol>{ 'e' })));
+    }
+
+    SECTION("invalid closure option") {
+        CHECK_THROWS_AS(remove_epsilon(aut, epsilons, EpsilonClosureOpt::None), std::runtime_error);
+        CHECK_THROWS_AS(remove_epsilon(aut, epsilons, EpsilonClosureOpt::BeforeAndAfter), std::runtime_error);
+    }
+}
+
 TEST_CASE("Profile mata::nfa::remove_epsilon()", "[.profiling]")
 {
     for (size_t n{}; n < 100'000; ++n) {
@@ -4402,6 +4600,75 @@ TEST_CASE("mata::nfa::get_useful_states_tarjan") {
     }
 }
 
+TEST_CASE("mata::nfa::algorithms::get_useful_states_bit_parallel()") {
+    SECTION("Small automata") {
+        Nfa aut(6, {0, 1}, {2, 5});
+        aut.delta.add(0, 'a', 2);
+        aut.delta.add(2, 'b', 3);
+        aut.delta.add(1, 'b', 4);
+        aut.delta.add(4, 'a', 3);
+        aut.delta.add(3, 'a', 3);
+        aut.delta.add(5, 'a', 2);
+        CHECK(get_useful_states_bit_parallel(aut, aut.initial, aut.final) == mata::BoolVector({ 1, 0, 1, 0, 0, 0 }));
+        CHECK(get_reachable_states_bit_parallel(aut, aut.initial) == mata::BoolVector({ 1, 1, 1, 1, 1, 0 }));
+        CHECK(get_reachable_states_bit_parallel(aut, aut.final, true) == mata::BoolVector({ 1, 0, 1, 0, 0, 1 }));
+        CHECK(!is_lang_empty_bit_parallel(aut));
+        aut.final = { 5 };
+        CHECK(is_lang_empty_bit_parallel(aut));
+        CHECK(get_useful_states_bit_parallel(Nfa{}, {}, {}).empty());
+    }
+
+    SECTION("Dense automaton") {
+        // States 0 to 198 form a dense random graph, states 200 to 299 are unreachable and reach the dense part.
+        // State 199 is reachable, but cannot reach any final state.
+        constexpr State num_of_states{ 300 };
+        Nfa aut(num_of_states, { 0 }, { 150, 250 });
+        std::mt19937 generator{ 42 };
+        std::uniform_int_distribution<State> dense_states{ 0, 198 };
+        for (State source{ 0 }; source < 199; ++source) {
+            for (Symbol i{ 0 }; i < 40; ++i) { aut.delta.add(source, 'a' + i % 3, dense_states(generator)); }
+        }
+        for (State source{ 200 }; source < num_of_states; ++source) {
+            for (Symbol i{ 0 }; i < 40; ++i) { aut.delta.add(source, 'a', dense_states(generator)); }
+        }
+        aut.delta.add(0, 'd', 199);
+        REQUIRE(is_dense(aut));
+
+        // Reference computation by a plain worklist search.
+        auto search = [&](const Nfa& nfa, const mata::utils::SparseSet<State>& sources) {
+            mata::BoolVector reached(num_of_states, false);
+            std::vector<State> worklist(sources.begin(), sources.end());
+            for (const State state : worklist) { reached[state] = true; }
+            while (!worklist.empty()) {
+                const State state{ worklist.back() };
+                worklist.pop_back();
+                for (const Move& move : nfa.delta[state].moves()) {
+                    if (!reached[move.target]) {
+                        reached[move.target] = true;
+                        worklist.push_back(move.target);
+                    }
+                }
+            }
+            return reached;
+        };
+        const mata::BoolVector reachable{ search(aut, aut.initial) };
+        const mata::BoolVector reaching{ search(revert(aut), aut.final) };
+        mata::BoolVector expected(num_of_states, false);
+        for (State state{ 0 }; state < num_of_states; ++state) { expected[state] = reachable[state] && reaching[state]; }
+        CHECK(!expected[199]);
+        CHECK(!expected[250]);
+
+        CHECK(get_reachable_states_bit_parallel(aut, aut.initial) == reachable);
+        CHECK(get_reachable_states_bit_parallel(aut, aut.final, true) == reaching);
+        CHECK(aut.get_useful_states() == expected);
+        CHECK(!aut.is_lang_empty());
+        CHECK(Nfa{ aut }.trim().num_of_states() == expected.count());
+        aut.final = { 250 };
+        CHECK(aut.is_lang_empty());
+        CHECK(aut.is_lang_empty_scc());
+    }
+}
+
 TEST_CASE("mata::nfa::Nfa::get_words") {
     SECTION("empty") {
         Nfa aut;
@@ -4479,6 +4746,84 @@ TEST_CASE("mata::nfa::Nfa::get_words") {
     }
 }
 
+TEST_CASE("mata::nfa::WordEnumerator") {
+    const auto get_all_words = [](const Nfa& aut, size_t max_length = std::numeric_limits<size_t>::max(),
+                                  size_t max_num_of_words = std::numeric_limits<size_t>::max()) {
+        std::vector<Word> words{};
+        WordEnumerator enumerator{ aut, max_length, max_num_of_words };
+        while (std::optional<Word> word{ enumerator.next() }) { words.push_back(*word); }
+        CHECK(enumerator.finished());
+        CHECK(!enumerator.next().has_value());
+        return words;
+    };
+
+    SECTION("empty") {
+        Nfa aut;
+        CHECK(get_all_words(aut).empty());
+        aut = Nfa{ 2, { 0 }, { 1 } };
+        CHECK(get_all_words(aut).empty());
+    }
+
+    SECTION("empty word") {
+        Nfa aut(1, { 0 }, { 0 });
+        CHECK(get_all_words(aut) == std::vector<Word>{ {} });
+    }
+
+    SECTION("length-lexicographic order") {
+        Nfa aut(6, { 0, 1 }, { 1, 3, 4, 5 });
+        aut.delta.add(0, 0, 3);
+        aut.delta.add(3, 1, 4);
+        aut.delta.add(0, 2, 2);
+        aut.delta.add(3, 3, 2);
+        aut.delta.add(1, 4, 2);
+        aut.delta.add(2, 5, 5);
+        CHECK(get_all_words(aut) == std::vector<Word>{ {}, { 0 }, { 0, 1 }, { 2, 5 }, { 4, 5 }, { 0, 3, 5 } });
+        CHECK(get_all_words(aut, 2) == std::vector<Word>{ {}, { 0 }, { 0, 1 }, { 2, 5 }, { 4, 5 } });
+        CHECK(get_all_words(aut, 5, 3) == std::vector<Word>{ {}, { 0 }, { 0, 1 } });
+    }
+
+    SECTION("each word exactly once") {
+        // Many accepting runs over the same words.
+        Nfa aut(4, { 0, 1 }, { 2, 3 });
+        aut.delta.add(0, 'a', 2);
+        aut.delta.add(0, 'a', 3);
+        aut.delta.add(1, 'a', 2);
+        aut.delta.add(2, 'a', 2);
+        aut.delta.add(2, 'a', 3);
+        aut.delta.add(3, 'a', 3);
+        aut.delta.add(3, 'b', 3);
+        const std::vector<Word> words{ get_all_words(aut, 3) };
+        CHECK(words == std::vector<Word>{ { 'a' }, { 'a', 'a' }, { 'a', 'b' }, { 'a', 'a', 'a' }, { 'a', 'a', 'b' },
+                                          { 'a', 'b', 'a' }, { 'a', 'b', 'b' } });
+        const std::set<Word> words_set{ aut.get_words(3) };
+        CHECK(words_set == std::set<Word>{ words.begin(), words.end() });
+    }
+
+    SECTION("infinite language with early stopping") {
+        Nfa aut(2, { 0 }, { 1 });
+        aut.delta.add(0, 'a', 0);
+        aut.delta.add(0, 'b', 1);
+        aut.delta.add(1, 'a', 1);
+        WordEnumerator enumerator{ aut };
+        CHECK(enumerator.next() == Word{ 'b' });
+        CHECK(enumerator.next() == Word{ 'a', 'b' });
+        CHECK(enumerator.next() == Word{ 'b', 'a' });
+        CHECK(enumerator.num_of_words() == 3);
+        CHECK(!enumerator.finished());
+    }
+
+    SECTION("gaps in word lengths") {
+        // Words of lengths divisible by 3 only, with useless states.
+        Nfa aut(6, { 0 }, { 0 });
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, 'a', 2);
+        aut.delta.add(2, 'a', 0);
+        aut.delta.add(1, 'b', 4);
+        aut.delta.add(4, 'b', 5);
+        CHECK(get_all_words(aut, 7) == std::vector<Word>{ {}, { 'a', 'a', 'a' }, { 'a', 'a', 'a', 'a', 'a', 'a' } });
+    }
+}
+
 TEST_CASE("mata::nfa::Nfa::get_word()") {
    SECTION("empty") {
        Nfa aut;
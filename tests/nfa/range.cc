@@ -0,0 +1,145 @@
+/* range.cc -- Tests for NFAs with transitions labelled by ranges of symbols
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/nfa/range.hh"
+#include "mata/parser/re2parser.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+
+namespace {
+bool is_normalized(const RangeNfa& aut) {
+    for (const RangeStatePost& state_post: aut.posts) {
+        for (size_t i{ 1 }; i < state_post.size(); ++i) {
+            if (state_post[i - 1].range.hi >= state_post[i].range.lo) { return false; }
+            if (state_post[i - 1].range.hi + 1 == state_post[i].range.lo
+                && state_post[i - 1].targets == state_post[i].targets) { return false; }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("mata::nfa::RangeNfa::from_nfa() and to_nfa()") {
+    Nfa nfa{ 3, { 0 }, { 2 } };
+    for (Symbol symbol{ 'a' }; symbol <= 'z'; ++symbol) { nfa.delta.add(0, symbol, 1); }
+    nfa.delta.add(0, '0', 2);
+    nfa.delta.add(0, '1', 2);
+    nfa.delta.add(0, '1', 1);
+    nfa.delta.add(1, 'x', 2);
+
+    const RangeNfa range_nfa{ RangeNfa::from_nfa(nfa) };
+    CHECK(is_normalized(range_nfa));
+    CHECK(range_nfa.posts[0] == RangeStatePost{
+        { { '0', '0' }, { 2 } }, { { '1', '1' }, { 1, 2 } }, { { 'a', 'z' }, { 1 } }
+    });
+    CHECK(range_nfa.num_of_range_posts() == 4);
+    CHECK(range_nfa.is_in_lang(Run{ { 'q', 'x' }, {} }));
+    CHECK(range_nfa.is_in_lang(Run{ { '0' }, {} }));
+    CHECK(!range_nfa.is_in_lang(Run{ { 'q' }, {} }));
+    CHECK(range_nfa.to_nfa().is_identical(nfa));
+}
+
+TEST_CASE("mata::nfa::RangeNfa::normalize()") {
+    RangeNfa aut{};
+    aut.initial.insert(0);
+    aut.final.insert(3);
+    aut.add(0, { 'a', 'm' }, 1);
+    aut.add(0, { 'h', 'z' }, 2);
+    aut.add(0, { 'n', 'p' }, 1);
+    aut.add(0, { 'x', 'x' }, 3);
+    aut.normalize();
+    CHECK(is_normalized(aut));
+    CHECK(aut.posts[0] == RangeStatePost{
+        { { 'a', 'g' }, { 1 } },
+        { { 'h', 'p' }, { 1, 2 } },
+        { { 'q', 'w' }, { 2 } },
+        { { 'x', 'x' }, { 2, 3 } },
+        { { 'y', 'z' }, { 2 } },
+    });
+    CHECK(aut.is_in_lang(Run{ { 'x' }, {} }));
+    CHECK(!aut.is_in_lang(Run{ { 'y' }, {} }));
+    CHECK_THROWS_AS(aut.add(0, { 'z', 'a' }, 1), std::runtime_error);
+}
+
+TEST_CASE("mata::nfa::decode_utf8_ranges()") {
+    SECTION("agrees with Nfa::decode_utf8()") {
+        for (const char* const regex: {
+                 "abc", "[\\x{70}-\\x{90}]", "[\\x{700}-\\x{900}]", "[\\x{FF90}-\\x{10090}]",
+                 "(\\x{60}*\\x{80})|(\\x{900}*\\x{600})", "\\p{Greek}+x", "" }) {
+            const Nfa bytes{ mata::parser::create_nfa(regex, false, 306, true, Encoding::Utf8) };
+            const RangeNfa range_nfa{ decode_utf8_ranges(bytes) };
+            CHECK(is_normalized(range_nfa));
+            CHECK(are_equivalent(range_nfa.to_nfa(), bytes.decode_utf8()));
+        }
+    }
+
+    SECTION("large character classes") {
+        const RangeNfa range_nfa{ mata::parser::create_range_nfa("\\p{L}") };
+        CHECK(is_normalized(range_nfa));
+        CHECK(range_nfa.num_of_range_posts() < 1'000);
+        for (const Symbol letter: { Symbol{ 'a' }, Symbol{ 0x1'00 }, Symbol{ 0x4E'00 }, Symbol{ 0x2'00'00 } }) {
+            CHECK(range_nfa.is_in_lang(Run{ { letter }, {} }));
+        }
+        for (const Symbol non_letter: { Symbol{ '1' }, Symbol{ ' ' }, Symbol{ 0x20'00 } }) {
+            CHECK(!range_nfa.is_in_lang(Run{ { non_letter }, {} }));
+        }
+        CHECK(!range_nfa.is_in_lang(Run{ { 'a', 'a' }, {} }));
+
+        const RangeNfa any{ mata::parser::create_range_nfa("[\\x{00}-\\x{10FFFF}]") };
+        for (const Symbol symbol: { 0x00u, 0x7Fu, 0x80u, 0xFF'FFu, 0x10'FF'FFu }) {
+            CHECK(any.is_in_lang(Run{ { symbol }, {} }));
+        }
+    }
+
+    SECTION("Latin1") {
+        const RangeNfa range_nfa{ mata::parser::create_range_nfa("[a-z]x", Encoding::Latin1) };
+        CHECK(range_nfa.num_of_range_posts() == 2);
+        CHECK(range_nfa.is_in_lang(Run{ { 'k', 'x' }, {} }));
+    }
+}
+
+TEST_CASE("mata::nfa::intersection() of range NFAs") {
+    const RangeNfa letters{ mata::parser::create_range_nfa("\\p{L}*") };
+    const RangeNfa greek_or_digits{ mata::parser::create_range_nfa("[\\p{Greek}0-9]*") };
+    const RangeNfa result{ intersection(letters, greek_or_digits) };
+    CHECK(is_normalized(result));
+    CHECK(result.is_in_lang(Run{ { 0x3'B1, 0x3'B2 }, {} }));
+    CHECK(result.is_in_lang(Run{ {}, {} }));
+    CHECK(!result.is_in_lang(Run{ { 'a' }, {} }));
+    CHECK(!result.is_in_lang(Run{ { '1' }, {} }));
+
+    const Nfa expected{ intersection(
+        decode_utf8_ranges(mata::parser::create_nfa("[a-m]+", false, 306, true, Encoding::Utf8)).to_nfa(),
+        decode_utf8_ranges(mata::parser::create_nfa("[h-z]+", false, 306, true, Encoding::Utf8)).to_nfa()
+    ) };
+    const RangeNfa range_result{ intersection(
+        mata::parser::create_range_nfa("[a-m]+"), mata::parser::create_range_nfa("[h-z]+")
+    ) };
+    CHECK(are_equivalent(range_result.to_nfa(), expected));
+}
+
+TEST_CASE("mata::nfa::determinize() of range NFAs") {
+    RangeNfa aut{};
+    aut.initial.insert(0);
+    aut.final.insert(2);
+    aut.add(0, { 'a', 'z' }, 0);
+    aut.add(0, { 'k', 'm' }, 1);
+    aut.add(1, { 'a', 'c' }, 2);
+    aut.normalize();
+
+    std::unordered_map<StateSet, State> subset_map{};
+    const RangeNfa result{ determinize(aut, &subset_map) };
+    CHECK(is_normalized(result));
+    for (const RangeStatePost& state_post: result.posts) {
+        for (const RangePost& range_post: state_post) { CHECK(range_post.targets.size() == 1); }
+    }
+    CHECK(result.initial.size() == 1);
+    CHECK(subset_map.size() == result.posts.size());
+    CHECK(subset_map.contains(StateSet{ 0, 1 }));
+    CHECK(are_equivalent(result.to_nfa(), aut.to_nfa()));
+    CHECK(determinize(RangeNfa{ 1 }).num_of_states() == 0);
+}
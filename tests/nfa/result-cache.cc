@@ -0,0 +1,124 @@
+/* result-cache.cc -- Tests for the cache of results of NFA operations
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/nfa/result-cache.hh"
+#include "mata/parser/re2parser.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+
+namespace {
+/// Get a path in the temporary directory named by @p name with a random suffix, so that concurrent runs do not clash.
+std::filesystem::path get_unique_temp_path(const std::string& name) {
+    return std::filesystem::temp_directory_path() / (name + "-" + std::to_string(std::random_device{}()));
+}
+} // namespace
+
+TEST_CASE("mata::nfa::ResultCache") {
+    const Nfa aut{ mata::parser::create_nfa("(a|b)*a(a|b)(a|b)") };
+    const Nfa other{ mata::parser::create_nfa("ab*") };
+    const mata::utils::OrdVector<Symbol> symbols{ 'a', 'b' };
+
+    SECTION("results agree with the operations") {
+        ResultCache cache{};
+        for (size_t i{ 0 }; i < 2; ++i) {
+            CHECK(cache.determinize(aut).is_identical(determinize(aut)));
+            CHECK(cache.minimize(aut).is_identical(minimize(aut)));
+            CHECK(cache.reduce(aut).is_identical(reduce(aut)));
+            CHECK(cache.complement(aut, symbols).is_identical(complement(aut, symbols)));
+        }
+        CHECK(cache.get_statistics().misses == 4);
+        CHECK(cache.get_statistics().hits == 4);
+        CHECK(cache.num_of_entries() == 4);
+    }
+
+    SECTION("parameters and automata distinguish the entries") {
+        ResultCache cache{};
+        cache.minimize(aut, { { "algorithm", "brzozowski" } });
+        cache.reduce(aut, { { "algorithm", "residual" }, { "type", "after" }, { "direction", "forward" } });
+        cache.complement(aut, symbols);
+        cache.complement(aut, mata::utils::OrdVector<Symbol>{ 'a', 'b', 'c' });
+        cache.minimize(other);
+        CHECK(cache.get_statistics().misses == 5);
+        CHECK(cache.get_statistics().hits == 0);
+
+        Nfa copy{ aut };
+        CHECK(cache.minimize(copy).is_identical(minimize(aut)));
+        CHECK(cache.get_statistics().hits == 1);
+        copy.final.insert(0);
+        cache.minimize(copy);
+        CHECK(cache.get_statistics().misses == 6);
+
+        Nfa with_isolated_state{ aut };
+        with_isolated_state.add_state();
+        cache.minimize(with_isolated_state);
+        CHECK(cache.get_statistics().misses == 7);
+    }
+
+    SECTION("least recently used entries are evicted") {
+        ResultCache cache{ 2 };
+        cache.determinize(aut);
+        cache.determinize(other);
+        cache.determinize(aut);
+        cache.minimize(aut);
+        CHECK(cache.num_of_entries() == 2);
+        CHECK(cache.get_statistics().evictions == 1);
+        cache.determinize(aut);
+        CHECK(cache.get_statistics().hits == 2);
+        cache.determinize(other);
+        CHECK(cache.get_statistics().misses == 4);
+
+        cache.clear();
+        CHECK(cache.num_of_entries() == 0);
+        cache.determinize(aut);
+        CHECK(cache.get_statistics().misses == 5);
+    }
+
+    SECTION("entries are stored in the cache directory") {
+        const std::filesystem::path directory{ get_unique_temp_path("mata-result-cache-test") };
+        std::filesystem::remove_all(directory);
+        {
+            ResultCache cache{ 16, directory };
+            cache.reduce(aut);
+            cache.complement(aut, symbols);
+            CHECK(cache.get_statistics().misses == 2);
+        }
+        ResultCache cache{ 16, directory };
+        CHECK(cache.reduce(aut).is_identical(reduce(aut)));
+        CHECK(cache.complement(aut, symbols).is_identical(complement(aut, symbols)));
+        CHECK(cache.get_statistics().disk_hits == 2);
+        CHECK(cache.get_statistics().misses == 0);
+        cache.reduce(aut);
+        CHECK(cache.get_statistics().hits == 1);
+
+        for (const std::filesystem::directory_entry& entry: std::filesystem::directory_iterator{ directory }) {
+            std::ofstream{ entry.path(), std::ios::binary | std::ios::trunc } << "corrupted";
+        }
+        ResultCache corrupted_cache{ 16, directory };
+        CHECK(corrupted_cache.reduce(aut).is_identical(reduce(aut)));
+        CHECK(corrupted_cache.get_statistics().misses == 1);
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION("failures to write entries are ignored") {
+        const std::filesystem::path directory{ get_unique_temp_path("mata-result-cache-test") };
+        std::filesystem::remove_all(directory);
+        ResultCache cache{ 16, directory };
+        // Replace the directory by a regular file, so that no entry can be written.
+        std::filesystem::remove_all(directory);
+        std::ofstream{ directory } << "not a directory";
+        CHECK(cache.reduce(aut).is_identical(reduce(aut)));
+        CHECK(cache.reduce(aut).is_identical(reduce(aut)));
+        CHECK(cache.get_statistics().misses == 1);
+        CHECK(cache.get_statistics().hits == 1);
+        std::filesystem::remove_all(directory);
+    }
+}
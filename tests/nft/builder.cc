@@ -382,3 +382,21 @@ TEST_CASE("mata::nft::parse_from_mata()") {
         }
     }
 }
+
+TEST_CASE("mata::nft::builder::create_random_nft_tabakov_vardi()") {
+    const Nft nft{ builder::create_random_nft_tabakov_vardi(300, 5, 4, 2.0, 0.5, 11) };
+    CHECK(nft.num_of_states() == 300);
+    CHECK(nft.levels.num_of_levels == 5);
+    CHECK(nft.delta.num_of_transitions() == 300 * 4 * 2);
+    // State 0 is final besides the 30 sampled final states.
+    CHECK((nft.final.size() == 30 || nft.final.size() == 31));
+    CHECK(nft.final.contains(0));
+    for (const State final_state: nft.final) { CHECK(nft.levels[final_state] == 0); }
+    for (const mata::nfa::Transition& transition: nft.delta.transitions()) {
+        CHECK(nft.levels[transition.target] == (nft.levels[transition.source] + 1) % 5);
+    }
+    CHECK(nft.is_identical(builder::create_random_nft_tabakov_vardi(300, 5, 4, 2.0, 0.5, 11)));
+    CHECK(builder::create_random_nft_tabakov_vardi(0, 3, 2, 1.0, 0.5).num_of_states() == 0);
+    CHECK_THROWS_AS(builder::create_random_nft_tabakov_vardi(2, 3, 2, 1.0, 0.5), std::runtime_error);
+    CHECK_THROWS_AS(builder::create_random_nft_tabakov_vardi(30, 3, 2, 11.0, 0.5), std::runtime_error);
+}
@@ -3,6 +3,7 @@
  */
 
 #include <algorithm>
+#include <random>
 #include <unordered_set>
 
 #include <catch2/catch_test_macros.hpp>
@@ -12,7 +13,9 @@
 #include "mata/nfa/nfa.hh"
 #include "mata/nft/algorithms.hh"
 #include "mata/nft/builder.hh"
+#include "mata/nft/complement.hh"
 #include "mata/nft/types.hh"
+#include "utils.hh"
 
 using namespace mata::nft;
 using namespace mata::utils;
@@ -139,3 +142,73 @@ TEST_CASE("mata::nft::complement()") {
         CHECK_SHARED();
     }
 }
+
+TEST_CASE("mata::nft::complement_implicit()") {
+    const EnumAlphabet alphabet{ 'a', 'b', 'c' };
+    const OrdVector<Symbol> symbols{ alphabet.get_alphabet_symbols() };
+    const std::vector<Symbol> transition_symbols{ 'a', 'b', DONT_CARE };
+
+    // All words over the alphabet of lengths 3 and 6.
+    std::vector<Word> words{ {} };
+    for (size_t length{ 1 }; length <= 6; ++length) {
+        for (const Word& word: std::vector<Word>(words)) {
+            if (word.size() != length - 1) { continue; }
+            for (const Symbol symbol: symbols) {
+                Word longer_word{ word };
+                longer_word.push_back(symbol);
+                words.push_back(longer_word);
+            }
+        }
+    }
+    std::erase_if(words, [](const Word& word) { return word.size() % 3 != 0 || word.empty(); });
+
+    std::mt19937 generator{ 42 };
+
+    for (const JumpMode jump_mode: { JumpMode::RepeatSymbol, JumpMode::AppendDontCares }) {
+        for (size_t i{ 0 }; i < 50; ++i) {
+            const Nft nft{ create_random_nft(generator, transition_symbols, 3, true) };
+            const mata::nfa::Nfa unwound{ nft.unwind_jumps(symbols, jump_mode).to_nfa_copy() };
+            const ImplicitComplement implicit{ complement_implicit(nft, symbols, jump_mode) };
+            const mata::nfa::Nfa materialized{ implicit.to_nft().to_nfa_copy() };
+            for (const Word& word: words) {
+                CHECK(implicit.is_in_lang(Run{ word, {} }) == !unwound.is_in_lang(word));
+                CHECK(materialized.is_in_lang(word) == !unwound.is_in_lang(word));
+            }
+
+            Run cex{};
+            const bool is_empty{ implicit.is_lang_empty(&cex) };
+            CHECK(is_empty == algorithms::is_universal_levels(nft, alphabet, nullptr, jump_mode));
+            if (!is_empty) {
+                CHECK(implicit.is_in_lang(cex));
+                CHECK(!unwound.is_in_lang(cex.word));
+            }
+        }
+    }
+
+    SECTION("large alphabet") {
+        EnumAlphabet large_alphabet{};
+        for (Symbol symbol{ 0 }; symbol < (1 << 16); ++symbol) { large_alphabet.add_new_symbol(symbol); }
+        const OrdVector<Symbol> large_symbols{ large_alphabet.get_alphabet_symbols() };
+        // Words with 'a' on the first level and anything on the other levels.
+        Nft nft{ Nft::with_levels(Levels{ 3, { 0, 1 } }, 2, { 0 }, { 0 }) };
+        nft.delta.add(0, 'a', 1);
+        nft.delta.add(1, DONT_CARE, 0);
+
+        const ImplicitComplement implicit{ complement_implicit(nft, large_symbols) };
+        CHECK(implicit.dft.delta.num_of_transitions() < 10);
+        CHECK(implicit.is_in_lang(Run{ { 'b', 'a', 'a' }, {} }));
+        CHECK(!implicit.is_in_lang(Run{ { 'a', 'b', 5'000 }, {} }));
+        CHECK(implicit.is_in_lang(Run{ { 'a', 'b', 5'000, 'c', 'a', 'a' }, {} }));
+        CHECK(!implicit.is_in_lang(Run{ { 'b' }, {} }));
+        Run cex{};
+        CHECK(!implicit.is_lang_empty(&cex));
+        CHECK(cex.word.size() == 3);
+        CHECK(cex.word[0] != 'a');
+
+        CHECK(!algorithms::is_universal_levels(nft, large_alphabet));
+        CHECK(!nft.is_universal(large_alphabet, { { "algorithm", "levels" } }));
+        nft.delta.add(0, DONT_CARE, 1);
+        CHECK(nft.is_universal(large_alphabet, { { "algorithm", "levels" } }));
+        CHECK(complement_implicit(nft, large_symbols).is_lang_empty());
+    }
+}
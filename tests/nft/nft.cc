@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <limits>
 #include <optional>
+#include <random>
 #include <ranges>
 #include <unordered_set>
 
@@ -1604,6 +1605,52 @@ TEST_CASE("mata::nft::are_equivalent") {
     }
 }
 
+TEST_CASE("mata::nft::is_included() with jumps and DONT_CARE") {
+    const EnumAlphabet alphabet{ 'a', 'b', 'c' };
+    const utils::OrdVector<Symbol> symbols{ alphabet.get_alphabet_symbols() };
+    const std::vector<Symbol> transition_symbols{ 'a', 'b', DONT_CARE };
+
+    std::mt19937 generator{ 42 };
+
+    for (const JumpMode jump_mode: { JumpMode::RepeatSymbol, JumpMode::AppendDontCares }) {
+        for (size_t i{ 0 }; i < 100; ++i) {
+            const Nft smaller{ create_random_nft(generator, transition_symbols, 2, false) };
+            const Nft bigger{ create_random_nft(generator, transition_symbols, 2, false) };
+            const Nft smaller_unwound{ smaller.unwind_jumps(symbols, jump_mode) };
+            const Nft bigger_unwound{ bigger.unwind_jumps(symbols, jump_mode) };
+
+            Run cex{};
+            const bool included{ is_included(smaller, bigger, &cex, &alphabet, jump_mode) };
+            CHECK(included == mata::nfa::algorithms::is_included_antichains(smaller_unwound, bigger_unwound));
+            if (!included) {
+                CHECK(smaller_unwound.to_nfa_copy().is_in_lang(cex.word));
+                CHECK(!bigger_unwound.to_nfa_copy().is_in_lang(cex.word));
+            }
+            CHECK(are_equivalent(smaller, bigger, &alphabet, jump_mode) ==
+                  mata::nfa::are_equivalent(smaller_unwound, bigger_unwound));
+        }
+    }
+
+    SECTION("large alphabet") {
+        EnumAlphabet large_alphabet{};
+        for (Symbol symbol{ 0 }; symbol < (1 << 16); ++symbol) { large_alphabet.add_new_symbol(symbol); }
+        // Any word of 3 symbols per transition, against a word starting with 'a' or anything else.
+        Nft smaller{ Nft::with_levels(Levels{ 3, { 0 } }, 1, { 0 }, { 0 }) };
+        smaller.delta.add(0, DONT_CARE, 0);
+        Nft bigger{ Nft::with_levels(Levels{ 3, { 0, 1, 1 } }, 3, { 0 }, { 0 }) };
+        bigger.delta.add(0, 'a', 1);
+        bigger.delta.add(1, DONT_CARE, 0);
+        CHECK(is_included(bigger, smaller, &large_alphabet, JumpMode::RepeatSymbol));
+        Run cex{};
+        CHECK(!is_included(smaller, bigger, &cex, &large_alphabet, JumpMode::RepeatSymbol));
+        REQUIRE(cex.word.size() == 3);
+        CHECK(cex.word[0] != 'a');
+        bigger.delta.add(0, DONT_CARE, 2);
+        bigger.delta.add(2, DONT_CARE, 0);
+        CHECK(are_equivalent(smaller, bigger, &large_alphabet, JumpMode::AppendDontCares));
+    }
+}
+
 TEST_CASE("mata::nft::revert()") { // {{{
     Nft aut(9);
 
@@ -3700,6 +3747,49 @@ TEST_CASE("mata::nft::Nft::get_words()") {
     }
 }
 
+
+TEST_CASE("mata::nft::WordEnumerator") {
+    Nft nft{ 7, { 0 }, { 6 }, { 3, { 0, 1, 2, 0, 1, 2, 0 } } };
+    nft.delta.add(0, 0, 1);
+    nft.delta.add(1, 1, 2);
+    nft.delta.add(2, 2, 3);
+    nft.delta.add(2, 3, 3);
+    nft.delta.add(3, 0, 4);
+    nft.delta.add(4, 1, 5);
+    nft.delta.add(5, 2, 6);
+
+    SECTION("all words") {
+        WordEnumerator enumerator{ nft };
+        CHECK(enumerator.next() == Word{ 0, 1, 2, 0, 1, 2 });
+        CHECK(enumerator.next() == Word{ 0, 1, 3, 0, 1, 2 });
+        CHECK(!enumerator.next().has_value());
+        CHECK(enumerator.finished());
+    }
+
+    SECTION("limits") {
+        WordEnumerator enumerator_length{ nft, 5 };
+        CHECK(!enumerator_length.next().has_value());
+        WordEnumerator enumerator_count{ nft, 6, 1 };
+        CHECK(enumerator_count.next() == Word{ 0, 1, 2, 0, 1, 2 });
+        CHECK(!enumerator_count.next().has_value());
+    }
+
+    SECTION("jumps") {
+        nft.delta.add(0, 4, 3);
+        WordEnumerator enumerator_repeat{ nft, 6, 1 };
+        CHECK(enumerator_repeat.next() == Word{ 0, 1, 2, 0, 1, 2 });
+        WordEnumerator enumerator_dont_cares{ nft, 6, 3, JumpMode::AppendDontCares };
+        CHECK(enumerator_dont_cares.next() == Word{ 0, 1, 2, 0, 1, 2 });
+        CHECK(enumerator_dont_cares.next() == Word{ 0, 1, 3, 0, 1, 2 });
+        CHECK(enumerator_dont_cares.next() == Word{ 4, DONT_CARE, DONT_CARE, 0, 1, 2 });
+        std::set<Word> words_repeat{};
+        WordEnumerator enumerator_all{ nft };
+        while (std::optional<Word> word{ enumerator_all.next() }) { words_repeat.insert(*word); }
+        CHECK(words_repeat == nft.get_words());
+        CHECK_THROWS_AS(WordEnumerator(nft, 6, 1, JumpMode::NoJump), std::runtime_error);
+    }
+}
+
 TEST_CASE("mata::nft::Nft::unwind_jump") {
     #define REPLACE_DONT_CARE(delta, src, trg)\
                 delta.add(src, 0, trg);\
@@ -1,6 +1,11 @@
 #ifndef UTILS_HH
 #define UTILS_HH
 
+#include <random>
+#include <vector>
+
+#include "mata/nft/nft.hh"
+
 // Automaton A
 #define FILL_WITH_AUT_A(x)                                                                                             \
 	(x).levels.num_of_levels = 1;                                                                                      \
@@ -110,4 +115,30 @@
 	(x).delta.add(2, 'a', 4);                                                                                          \
 	(x).delta.add(1, 'a', 3);
 
+/**
+ * @brief Create a random transducer with 6 states on 3 levels, where a transition leads to any state with a higher
+ *  level or with level 0.
+ *
+ * @param generator Generator of the random numbers.
+ * @param symbols Symbols of the transitions.
+ * @param num_of_tries Number of tries to add a random transition from each state.
+ * @param only_level_zero_final Whether only states with level 0 may be final.
+ */
+inline mata::nft::Nft create_random_nft(
+	std::mt19937& generator, const std::vector<mata::Symbol>& symbols, const size_t num_of_tries,
+	const bool only_level_zero_final
+) {
+	constexpr size_t NUM_OF_STATES{6};
+	mata::nft::Nft nft{mata::nft::Nft::with_levels(mata::nft::Levels{3, {0, 1, 2, 0, 1, 2}}, NUM_OF_STATES, {0})};
+	for (mata::nft::State state{0}; state < NUM_OF_STATES; ++state) {
+		if ((!only_level_zero_final || nft.levels[state] == 0) && generator() % 2 == 0) { nft.final.insert(state); }
+		for (size_t i{0}; i < num_of_tries; ++i) {
+			const mata::nft::State target{generator() % NUM_OF_STATES};
+			if (nft.levels[target] != 0 && nft.levels[target] <= nft.levels[state]) { continue; }
+			nft.delta.add(state, symbols[generator() % symbols.size()], target);
+		}
+	}
+	return nft;
+}
+
 #endif // UTILS_HH
@@ -0,0 +1,91 @@
+/* profiling.cc -- Tests for the operation-level profiling
+ */
+
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "mata/nfa/nfa.hh"
+#include "mata/parser/re2parser.hh"
+#include "mata/utils/profiling.hh"
+
+using namespace mata::nfa;
+using mata::utils::OperationStatistics;
+using mata::utils::Profiler;
+
+namespace {
+const OperationStatistics* find_record(const std::vector<OperationStatistics>& records, const std::string& name) {
+    for (const OperationStatistics& record: records) {
+        if (record.operation == name) { return &record; }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST_CASE("mata::utils::Profiler") {
+    const Nfa aut{ mata::parser::create_nfa("(a|b)*a(a|b)(a|b)") };
+    const Nfa other{ mata::parser::create_nfa("(a|b)*") };
+    Profiler::clear();
+
+    SECTION("disabled profiler records nothing") {
+        determinize(aut);
+        CHECK(Profiler::get_records().empty());
+    }
+
+    SECTION("enabled profiler records the statistics") {
+        Profiler::enable();
+        const Nfa dfa{ determinize(aut) };
+        CHECK(is_included(aut, other));
+        intersection(aut, other);
+        minimize(aut);
+        Profiler::enable(false);
+        const std::vector<OperationStatistics> records{ Profiler::get_records() };
+
+        const OperationStatistics* determinization{ find_record(records, "nfa::determinize") };
+        REQUIRE(determinization != nullptr);
+        CHECK(determinization->depth == 0);
+        CHECK(determinization->states_created == dfa.num_of_states());
+        CHECK(determinization->macrostates_explored == dfa.num_of_states());
+
+        const OperationStatistics* inclusion{ find_record(records, "nfa::is_included_antichains") };
+        REQUIRE(inclusion != nullptr);
+        CHECK(inclusion->macrostates_explored > 0);
+
+        const OperationStatistics* product{ find_record(records, "nfa::product") };
+        REQUIRE(product != nullptr);
+        CHECK(product->product_pairs > 0);
+
+        const OperationStatistics* minimization{ find_record(records, "nfa::minimize") };
+        REQUIRE(minimization != nullptr);
+        CHECK(minimization->depth == 0);
+        // Minimization nests the determinizations of its algorithm.
+        CHECK(minimization->states_created == minimize(aut).num_of_states());
+        CHECK(records.back().operation == "nfa::minimize");
+        CHECK(records[records.size() - 2].depth == 1);
+
+        std::ostringstream json{};
+        Profiler::write_json(json);
+        CHECK_THAT(json.str(), Catch::Matchers::ContainsSubstring("\"summary\""));
+        CHECK_THAT(json.str(), Catch::Matchers::ContainsSubstring("\"nfa::determinize\": {\"calls\": "));
+        Profiler::clear();
+        CHECK(Profiler::get_records().empty());
+    }
+
+    SECTION("callback receives the statistics") {
+        std::vector<std::string> operations{};
+        Profiler::set_callback([&](const OperationStatistics& statistics) {
+            operations.push_back(statistics.operation);
+        });
+        Profiler::enable();
+        determinize(aut);
+        Profiler::enable(false);
+        Profiler::set_callback({});
+        CHECK(operations == std::vector<std::string>{ "nfa::determinize" });
+        CHECK(Profiler::get_records().empty());
+    }
+
+    Profiler::enable(false);
+    Profiler::set_callback({});
+    Profiler::clear();
+}
@@ -1928,3 +1928,56 @@ TEST_CASE("Foldcase") {
         CHECK(are_equivalent(nfa, result));
     }
 }
+
+TEST_CASE("mata::parser::create_nfa() Glushkov construction") {
+    constexpr Symbol EPSILON_VALUE{ 306 };
+
+    SECTION("Position automaton") {
+        // 4 positions: [ab] (RE2 turns a|b into a class), a, b, b.
+        const Nfa aut{ mata::parser::create_nfa(
+            "(a|b)*abb", false, EPSILON_VALUE, false, Encoding::Latin1, mata::parser::RegexConstruction::Glushkov
+        ) };
+        CHECK(aut.num_of_states() == 5);
+        CHECK(aut.initial.size() == 1);
+        CHECK(aut.final.size() == 1);
+        CHECK(aut.delta.num_of_transitions() == 8);
+        CHECK(aut.is_in_lang(Word{ 'a', 'b', 'a', 'b', 'b' }));
+        CHECK(!aut.is_in_lang(Word{ 'a', 'b', 'b', 'a' }));
+    }
+
+    SECTION("Agrees with the construction through the RE2 program") {
+        const std::vector<std::string> regexes{
+            "", "abcd", "a*b+c?", "(ab|cd)*e", "[a-z0-9_]+@[a-z]+\\.(com|org)", "x{2,4}y{3}z{2,}", "(?i)hello",
+            "^a.b$", "\\bword\\b", "[^abc]x", "\\x{7f}|\\x{80}|\\x{ff}", "(a|)*b", "(?s).", "a{0}b", "(((a*)*)*)*"
+        };
+        const std::vector<std::string> unicode_regexes{
+            "[\\x{100}-\\x{10FFFF}]", "\\x{7FF}\\x{800}\\x{FFFF}\\x{10000}", "\\p{Greek}+|[\\x{700}-\\x{900}]", "(?i)\\x{3A3}"
+        };
+        const std::set<std::string> permissive_utf8_regexes{ "^a.b$", "[^abc]x", "(?s)." };
+        for (const Encoding encoding: { Encoding::Latin1, Encoding::Utf8 }) {
+            std::vector<std::string> encoding_regexes{ regexes };
+            if (encoding == Encoding::Utf8) {
+                encoding_regexes.insert(encoding_regexes.end(), unicode_regexes.begin(), unicode_regexes.end());
+            }
+            for (const std::string& regex: encoding_regexes) {
+                CAPTURE(regex, static_cast<int>(encoding));
+                const Nfa glushkov{ mata::parser::create_nfa(
+                    regex, false, EPSILON_VALUE, true, encoding, mata::parser::RegexConstruction::Glushkov
+                ) };
+                const Nfa glushkov_unreduced{ mata::parser::create_nfa(
+                    regex, false, EPSILON_VALUE, false, encoding, mata::parser::RegexConstruction::Glushkov
+                ) };
+                const Nfa prog{ mata::parser::create_nfa(regex, false, EPSILON_VALUE, true, encoding) };
+                CHECK(!glushkov_unreduced.delta.get_used_symbols().contains(EPSILON_VALUE));
+                CHECK(is_included(glushkov, prog));
+                CHECK(is_included(glushkov_unreduced, prog));
+                // RE2 compiles classes containing [\x{80}-\x{10FFFF}] permissively, accepting also some invalid UTF-8
+                //  sequences. The Glushkov construction accepts only valid ones.
+                if (encoding == Encoding::Latin1 || permissive_utf8_regexes.count(regex) == 0) {
+                    CHECK(are_equivalent(glushkov, prog));
+                    CHECK(are_equivalent(glushkov_unreduced, prog));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/* regex-derivatives.cc -- Tests for the lazy derivative-based regex matcher
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/nfa/builder.hh"
+#include "mata/nfa/nfa.hh"
+#include "mata/parser/re2parser.hh"
+#include "mata/parser/regex-derivatives.hh"
+
+using namespace mata::nfa;
+using mata::parser::DerivativeMatcher;
+using mata::Symbol;
+using mata::Word;
+
+TEST_CASE("mata::parser::DerivativeMatcher::is_in_lang()") {
+    SECTION("Basic") {
+        DerivativeMatcher matcher{ "(a|b)*abb" };
+        CHECK(matcher.is_in_lang(Word{ 'a', 'b', 'b' }));
+        CHECK(matcher.is_in_lang(Word{ 'b', 'a', 'b', 'a', 'b', 'b' }));
+        CHECK(!matcher.is_in_lang(Word{ 'a', 'b', 'b', 'a' }));
+        CHECK(!matcher.is_in_lang(Word{}));
+        CHECK(!matcher.is_in_lang(Word{ 'c' }));
+    }
+
+    SECTION("Agrees with create_nfa()") {
+        for (const char* const regex: {
+                 "", "abcd", "a*b+c?", "(ab|cd)*e", "[a-c0-1_]+@[a-b]+\\.(com|org)", "x{2,4}y{3}z{2,}", "(?i)ab",
+                 "^a.b$", "[^abc]x", "(a|)*b", "a{0}b", "(((a*)*)*)*", "(a|ab)(c|bcd)(d*)" }) {
+            CAPTURE(regex);
+            DerivativeMatcher matcher{ regex };
+            const Nfa nfa{ mata::parser::create_nfa(regex) };
+            // All words up to length 4 over a small alphabet.
+            const std::vector<Symbol> alphabet{ 'a', 'b', 'c', 'd', 'x', 'y', 'z', 'A', 'B', '@', '.', '\n' };
+            std::vector<Word> words{ Word{} };
+            std::vector<Word> mismatches{};
+            for (size_t index{ 0 }; index < words.size(); ++index) {
+                if (matcher.is_in_lang(words[index]) != nfa.is_in_lang(words[index])) {
+                    mismatches.push_back(words[index]);
+                }
+                if (words[index].size() == 4) { continue; }
+                for (const Symbol symbol: alphabet) {
+                    Word word{ words[index] };
+                    word.push_back(symbol);
+                    words.push_back(std::move(word));
+                }
+            }
+            CHECK(mismatches.empty());
+            CHECK(matcher.is_in_lang(Word{ 'x', 'x', 'y', 'y', 'y', 'z', 'z', 'z', 'z', 'z' })
+                  == nfa.is_in_lang(Word{ 'x', 'x', 'y', 'y', 'y', 'z', 'z', 'z', 'z', 'z' }));
+        }
+    }
+
+    SECTION("UTF8 matches code points") {
+        DerivativeMatcher matcher{ "\\p{Greek}+[\\x{10000}-\\x{10FFFF}]", Encoding::Utf8 };
+        CHECK(matcher.is_in_lang(Word{ 0x3'B1, 0x3'B2, 0x1'00'00 }));
+        CHECK(matcher.is_in_lang(Word{ 0x3'B1, 0x10'FF'FF }));
+        CHECK(!matcher.is_in_lang(Word{ 'a', 0x1'00'00 }));
+        CHECK(!matcher.is_in_lang(Word{ 0x3'B1 }));
+    }
+
+    SECTION("Lazy construction") {
+        DerivativeMatcher matcher{ "(a|b)*a(a|b){20}" };
+        CHECK(matcher.is_in_lang(Word(21, 'a')));
+        CHECK(!matcher.is_in_lang(Word(20, 'b')));
+        // The minimal DFA has 2^21 states, only the derivatives on the way are created.
+        CHECK(matcher.num_of_terms() < 1'000);
+    }
+
+    SECTION("Bounded cache of transitions") {
+        DerivativeMatcher matcher{ "[a-z]*", Encoding::Latin1, 4 };
+        Word word{};
+        for (Symbol symbol{ 'a' }; symbol <= 'z'; ++symbol) { word.push_back(symbol); }
+        CHECK(matcher.is_in_lang(word));
+        CHECK(matcher.num_of_cached_transitions() <= 4);
+        CHECK(matcher.is_in_lang(word));
+    }
+
+    SECTION("Bounded store of terms") {
+        // Each word reaches new derivatives; the terms are released together with the cache of transitions.
+        const char* const regex{ "(a|b)*a(a|b){20}" };
+        DerivativeMatcher matcher{ regex, Encoding::Latin1, 256 };
+        const Nfa nfa{ mata::parser::create_nfa(regex) };
+        std::mt19937 generator{ 42 };
+        std::bernoulli_distribution coin{};
+        size_t max_num_of_terms{ 0 };
+        for (size_t index{ 0 }; index < 500; ++index) {
+            Word word(24);
+            for (Symbol& symbol: word) { symbol = coin(generator) ? 'a' : 'b'; }
+            CHECK(matcher.is_in_lang(word) == nfa.is_in_lang(word));
+            max_num_of_terms = std::max(max_num_of_terms, matcher.num_of_terms());
+        }
+        CHECK(max_num_of_terms < 5'000);
+        CHECK(matcher.num_of_cached_transitions() <= 256);
+    }
+
+    SECTION("Invalid regex") {
+        CHECK_THROWS_AS(DerivativeMatcher{ "(a" }, std::runtime_error);
+    }
+}
+
+TEST_CASE("mata::parser::DerivativeMatcher lazy states") {
+    DerivativeMatcher matcher{ "ab*" };
+    const DerivativeMatcher::State initial{ matcher.initial_state() };
+    CHECK(!matcher.is_final(initial));
+    const DerivativeMatcher::State after_a{ matcher.next_state(initial, 'a') };
+    CHECK(matcher.is_final(after_a));
+    CHECK(matcher.next_state(after_a, 'b') == after_a);
+    CHECK(matcher.is_sink(matcher.next_state(after_a, 'a')));
+    CHECK(!matcher.is_sink(after_a));
+}
+
+TEST_CASE("mata::parser::DerivativeMatcher::is_lang_empty()") {
+    Run cex{};
+    DerivativeMatcher matcher{ "x[a-c]{3}(d|e)" };
+    REQUIRE(!matcher.is_lang_empty(&cex));
+    CHECK(cex.word.size() == 5);
+    CHECK(matcher.is_in_lang(cex.word));
+
+    CHECK(DerivativeMatcher{ "[^\\x00-\\xff]" }.is_lang_empty());
+    CHECK(DerivativeMatcher{ "a[^\\x00-\\xff]*b" }.is_lang_empty() == false);
+    CHECK(DerivativeMatcher{ "a[^\\x00-\\xff]b" }.is_lang_empty());
+    CHECK(!DerivativeMatcher{ "" }.is_lang_empty());
+}
+
+TEST_CASE("mata::parser::DerivativeMatcher intersection with an NFA") {
+    DerivativeMatcher matcher{ "(ab)*c" };
+    const Nfa nfa{ mata::parser::create_nfa("a*(ba)*b*c") };
+
+    Run cex{};
+    REQUIRE(!matcher.is_intersection_empty(nfa, &cex));
+    CHECK(matcher.is_in_lang(cex.word));
+    CHECK(nfa.is_in_lang(cex.word));
+    CHECK(cex.path.size() == cex.word.size() + 1);
+
+    const Nfa product{ matcher.intersection(nfa) };
+    CHECK(are_equivalent(product, intersection(nfa, mata::parser::create_nfa("(ab)*c"))));
+
+    CHECK(matcher.is_intersection_empty(mata::parser::create_nfa("(ab)*d")));
+    CHECK(matcher.intersection(mata::parser::create_nfa("a+")).is_lang_empty());
+}
@@ -1,6 +1,8 @@
 /* two-dimensional-map.cc -- tests of TwoDimensionalMap
  */
 
+#include <thread>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -124,3 +126,46 @@ TEST_CASE("mata::utils::TwoDimensionalMap::large_map == true") {
         }
     }
 }
+
+TEST_CASE("mata::utils::ConcurrentTwoDimensionalMap") {
+    auto fill_concurrently = [](auto& map) {
+        std::atomic<unsigned> next_value{ 0 };
+        std::atomic<unsigned> num_of_inserted{ 0 };
+        std::vector<std::thread> threads{};
+        for (unsigned thread_index = 0; thread_index < 4; ++thread_index) {
+            threads.emplace_back([&] {
+                for (unsigned i = 0; i < 100; ++i) {
+                    for (unsigned j = 0; j < 100; ++j) {
+                        // Catch2 assertions are not thread-safe, the values are checked after joining the threads.
+                        if (map.get_or_insert(i, j, [&] { return next_value++; }).second) { ++num_of_inserted; }
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) { thread.join(); }
+        // Each pair got exactly one value.
+        CHECK(num_of_inserted == 10'000);
+        CHECK(next_value == 10'000);
+        std::vector<bool> is_used(10'000, false);
+        for (unsigned i = 0; i < 100; ++i) {
+            for (unsigned j = 0; j < 100; ++j) {
+                REQUIRE(map.get(i, j) < 10'000);
+                CHECK(!is_used[map.get(i, j)]);
+                is_used[map.get(i, j)] = true;
+            }
+        }
+        CHECK(map.get_or_insert(1, 2, [] { return 42u; }).second == false);
+    };
+
+    SECTION("matrix") {
+        ConcurrentTwoDimensionalMap<unsigned> map(100, 100);
+        CHECK(map.get(1, 2) == std::numeric_limits<unsigned>::max());
+        fill_concurrently(map);
+    }
+
+    SECTION("hash maps") {
+        ConcurrentTwoDimensionalMap<unsigned, 10> map(100, 100);
+        CHECK(map.get(1, 2) == std::numeric_limits<unsigned>::max());
+        fill_concurrently(map);
+    }
+}